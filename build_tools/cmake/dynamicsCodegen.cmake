@@ -0,0 +1,22 @@
+function(addDynamicsBackend target urdf_path has_freeflyer backend_name)
+    # \brief    Generate a dynamics backend specialized for the kinematic tree of a URDF file,
+    #           and add it to the sources of a given target.
+    #
+    # \details  The backend is registered automatically when the target is loaded, so that it is
+    #           used transparently by every robot whose model has the same topology. The target
+    #           must link against jiminy core library. Note that the model must not have any
+    #           flexibility for the backend to be compatible.
+    #
+    # \remark   ${CMAKE_CURRENT_BINARY_DIR} is the path of generated files.
+
+    set(output_file "${CMAKE_CURRENT_BINARY_DIR}/dynamics_backend_${backend_name}.cc")
+    add_custom_command(
+        OUTPUT  ${output_file}
+        COMMAND $<TARGET_FILE:${LIBRARY_NAME}_dynamics_codegen>
+                ${urdf_path} ${has_freeflyer} ${backend_name} ${output_file}
+        MAIN_DEPENDENCY ${urdf_path}
+        DEPENDS ${LIBRARY_NAME}_dynamics_codegen
+        COMMENT "Generating dynamics backend '${backend_name}' from ${urdf_path}"
+    )
+    target_sources(${target} PRIVATE ${output_file})
+endfunction()
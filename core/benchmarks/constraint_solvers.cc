@@ -0,0 +1,94 @@
+// Benchmark of the constraint solvers on a scene with many simultaneous contacts: a passive
+// quadruped falling on flat ground, with contact points on its feet, shanks and trunk.
+// Every solver integrates the same scene with a fixed time step, so that the wall-clock time
+// only depends on the cost of solving the constrained dynamics.
+
+#include <chrono>
+#include <iostream>
+
+#include "pinocchio/algorithm/joint-configuration.hpp"
+
+#include "jiminy/core/engine/Engine.h"
+#include "jiminy/core/Types.h"
+
+
+using namespace jiminy;
+
+uint32_t const N_REPEAT = 5U;
+float64_t const SIMULATION_DURATION = 2.0;
+
+bool_t callback(float64_t const & /* t */,
+                vectorN_t const & /* q */,
+                vectorN_t const & /* v */)
+{
+    return true;
+}
+
+int main(int /* argc */, char_t * /* argv */[])
+{
+    // Load the quadruped, without any motor so that it collapses on the ground
+    std::string const robotDirPath = std::string(ROBOTS_DATA_DIR) + "quadrupedal_robots/anymal";
+    auto robot = std::make_shared<Robot>();
+    if (robot->initialize(robotDirPath + "/anymal.urdf", true, {robotDirPath}) != hresult_t::SUCCESS)
+    {
+        return -1;
+    }
+    robot->addContactPoints({"LF_FOOT", "RF_FOOT", "LH_FOOT", "RH_FOOT",
+                             "LF_SHANK", "RF_SHANK", "LH_SHANK", "RH_SHANK",
+                             "face_front", "face_rear", "battery", "hatch"});
+    auto engine = std::make_shared<Engine>();
+    engine->initialize(robot, callback);
+
+    // Drop it slightly above the ground
+    vectorN_t q0 = pinocchio::neutral(robot->pncModel_);
+    q0[2] = 0.6;
+    vectorN_t const v0 = vectorN_t::Zero(robot->nv());
+
+    float64_t finalHeightRef = 0.0;
+    for (std::string const & solver : {"PGS", "BlockPGS", "ADMM"})
+    {
+        // Integrate with a fixed time step, without any logging overhead
+        configHolder_t simuOptions = engine->getDefaultEngineOptions();
+        configHolder_t & stepperOptions = boost::get<configHolder_t>(simuOptions.at("stepper"));
+        boost::get<std::string>(stepperOptions.at("odeSolver")) = "runge_kutta_4";
+        boost::get<float64_t>(stepperOptions.at("dtMax")) = 1.0e-3;
+        boost::get<configHolder_t>(simuOptions.at("constraints")).at("solver") = solver;
+        configHolder_t & telemetryOptions = boost::get<configHolder_t>(simuOptions.at("telemetry"));
+        for (auto & telemetryOption : telemetryOptions)
+        {
+            if (telemetryOption.first.rfind("enable", 0) == 0)
+            {
+                telemetryOption.second = false;
+            }
+        }
+        engine->setOptions(simuOptions);
+
+        // Run the simulation several times, keeping the best time to mitigate the system noise
+        float64_t dtBest = INF;
+        float64_t finalHeight = 0.0;
+        for (uint32_t i = 0; i < N_REPEAT; ++i)
+        {
+            auto const tStart = std::chrono::steady_clock::now();
+            if (engine->simulate(SIMULATION_DURATION, q0, v0) != hresult_t::SUCCESS)
+            {
+                std::cout << solver << ": simulation failed" << std::endl;
+                break;
+            }
+            std::chrono::duration<float64_t, std::milli> const dt = std::chrono::steady_clock::now() - tStart;
+            dtBest = std::min(dtBest, dt.count());
+            systemState_t const * systemState;
+            engine->getSystemState(systemState);
+            finalHeight = systemState->q[2];
+        }
+        if (solver == std::string("PGS"))
+        {
+            finalHeightRef = finalHeight;
+        }
+
+        std::cout << solver << ": " << dtBest << "ms for " << SIMULATION_DURATION << "s simulated, "
+                  << "final base height " << finalHeight << "m "
+                  << "(" << finalHeight - finalHeightRef << "m wrt. PGS)" << std::endl;
+    }
+
+    return 0;
+}
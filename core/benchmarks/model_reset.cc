@@ -0,0 +1,67 @@
+// Benchmark of the reset of a model, when the model is left unchanged and only new biases
+// are drawn, against the full regeneration of the model. Their behavior is checked by the
+// unit tests.
+
+#include <chrono>
+#include <iostream>
+
+#include "pinocchio/parsers/urdf.hpp"
+
+#include "jiminy/core/robot/Model.h"
+#include "jiminy/core/Types.h"
+
+
+using namespace jiminy;
+
+uint32_t const N_ITER = 1000U;
+
+template<typename F>
+float64_t timeIt(F const & fct)
+{
+    auto const tStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N_ITER; ++i)
+    {
+        fct();
+    }
+    std::chrono::duration<float64_t, std::micro> const dt = std::chrono::steady_clock::now() - tStart;
+    return dt.count() / N_ITER;
+}
+
+int main(int /* argc */, char_t * /* argv */[])
+{
+    // Load a humanoid, without collision nor visual meshes since they are irrelevant here
+    std::string const urdfName = "bipedal_robots/atlas/atlas_v4.urdf";
+    std::string const urdfPath = std::string(ROBOTS_DATA_DIR) + urdfName;
+    pinocchio::Model pncModel;
+    pinocchio::urdf::buildModel(urdfPath, pinocchio::JointModelFreeFlyer(), pncModel);
+    auto model = std::make_shared<Model>();
+    if (model->initialize(pncModel, pinocchio::GeometryModel(), pinocchio::GeometryModel())
+        != hresult_t::SUCCESS)
+    {
+        std::cout << "Impossible to load " << urdfName << std::endl;
+        return 1;
+    }
+
+    // Randomize the mass of the bodies, so that new biases are drawn at every reset
+    configHolder_t options = model->getOptions();
+    boost::get<float64_t>(boost::get<configHolder_t>(options.at("dynamics")).at("massBodiesBiasStd")) = 0.1;
+    model->setOptions(options);
+    model->reset();
+
+    // Reset without any change of the model, only drawing new biases in place
+    float64_t const dtFast = timeIt([&]() { model->reset(); });
+
+    // Reset after modifying the original model, which triggers its full regeneration
+    float64_t const dtFull = timeIt(
+        [&]()
+        {
+            model->pncModelOrig_.gravity.linear() *= -1.0;
+            model->reset();
+        });
+
+    std::cout << "Model::reset - " << urdfName << " (nv=" << model->pncModel_.nv << "): "
+              << "full " << dtFull << "us, fast " << dtFast << "us, "
+              << "speedup x" << dtFull / dtFast << std::endl;
+
+    return 0;
+}
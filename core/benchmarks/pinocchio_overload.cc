@@ -0,0 +1,125 @@
+// Benchmark of the custom algorithms of PinocchioOverloadAlgorithms against their reference
+// implementation. Their numerical consistency is checked by the unit tests.
+
+#include <chrono>
+#include <iostream>
+
+#include "pinocchio/parsers/urdf.hpp"
+#include "pinocchio/algorithm/kinematics.hpp"
+#include "pinocchio/algorithm/jacobian.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+
+#include "jiminy/core/robot/PinocchioOverloadAlgorithms.h"
+#include "jiminy/core/robot/DynamicsBackend.h"
+#include "jiminy/core/Types.h"
+
+
+using namespace jiminy;
+
+uint32_t const N_ITER = 10000U;
+
+template<typename F>
+float64_t timeIt(F const & fct)
+{
+    auto const tStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N_ITER; ++i)
+    {
+        fct();
+    }
+    std::chrono::duration<float64_t, std::micro> const dt = std::chrono::steady_clock::now() - tStart;
+    return dt.count() / N_ITER;
+}
+
+void benchmarkGeneralizedForces(std::string const & urdfName)
+{
+    // Load the model of the robot
+    std::string const urdfPath = std::string(ROBOTS_DATA_DIR) + urdfName;
+    pinocchio::Model model;
+    pinocchio::urdf::buildModel(urdfPath, pinocchio::JointModelFreeFlyer(), model);
+    pinocchio::Data data(model);
+
+    // Update the kinematics for a random configuration
+    vectorN_t q = pinocchio::randomConfiguration(
+        model, -vectorN_t::Ones(model.nq), vectorN_t::Ones(model.nq));
+    pinocchio::forwardKinematics(model, data, q);
+    pinocchio::computeJointJacobians(model, data);
+
+    // Generate random external forces applied on every joints
+    forceVector_t fext(static_cast<std::size_t>(model.njoints), pinocchio::Force::Zero());
+    for (int32_t i = 1; i < model.njoints; ++i)
+    {
+        fext[i] = pinocchio::Force::Random();
+    }
+
+    // Reference implementation, projecting the forces one joint at a time
+    vectorN_t tau(model.nv);
+    matrix6N_t jointJacobian(6, model.nv);
+    float64_t const dtRef = timeIt(
+        [&]()
+        {
+            tau.setZero();
+            for (int32_t i = 1; i < model.njoints; ++i)
+            {
+                jointJacobian.setZero();
+                pinocchio::getJointJacobian(model, data, i, pinocchio::LOCAL, jointJacobian);
+                tau.noalias() += jointJacobian.transpose() * fext[i].toVector();
+            }
+        });
+
+    // Single backward pass
+    float64_t const dt = timeIt(
+        [&]()
+        {
+            tau.setZero();
+            pinocchio_overload::computeGeneralizedForces(model, data, fext, tau);
+        });
+
+    std::cout << "computeGeneralizedForces - " << urdfName << " (nv=" << model.nv << "): "
+              << "jacobian " << dtRef << "us, backward pass " << dt << "us, "
+              << "speedup x" << dtRef / dt << std::endl;
+}
+
+void benchmarkDynamicsBackend(std::string const & urdfName)
+{
+    // Load the model of the robot for which a backend has been generated
+    std::string const urdfPath = std::string(ROBOTS_DATA_DIR) + urdfName;
+    pinocchio::Model model;
+    pinocchio::urdf::buildModel(urdfPath, pinocchio::JointModelFreeFlyer(), model);
+    pinocchio::Data data(model), dataRef(model);
+    std::shared_ptr<AbstractDynamicsBackend const> backend = findDynamicsBackend(model);
+    if (!backend)
+    {
+        std::cout << "No dynamics backend registered for " << urdfName << std::endl;
+        return;
+    }
+
+    // Generate a random state
+    vectorN_t const q = pinocchio::randomConfiguration(
+        model, -vectorN_t::Ones(model.nq), vectorN_t::Ones(model.nq));
+    vectorN_t const v = vectorN_t::Random(model.nv);
+    vectorN_t const tau = vectorN_t::Random(model.nv);
+    forceVector_t fext(static_cast<std::size_t>(model.njoints), pinocchio::Force::Zero());
+    for (int32_t i = 1; i < model.njoints; ++i)
+    {
+        fext[i] = pinocchio::Force::Random();
+    }
+
+    // Compare the generic and specialized implementations of aba
+    float64_t const dtRef = timeIt([&]() { pinocchio_overload::aba(model, dataRef, q, v, tau, fext); });
+    float64_t const dt = timeIt([&]() { backend->aba(model, data, q, v, tau, fext); });
+    std::cout << "aba - " << urdfName << " (nv=" << model.nv << "): "
+              << "generic " << dtRef << "us, specialized " << dt << "us, "
+              << "speedup x" << dtRef / dt << std::endl;
+}
+
+int main(int /* argc */, char_t * /* argv */[])
+{
+    for (std::string const & urdfName : {"bipedal_robots/atlas/atlas_v4.urdf",
+                                          "bipedal_robots/cassie/cassie.urdf"})
+    {
+        benchmarkGeneralizedForces(urdfName);
+    }
+    benchmarkDynamicsBackend("bipedal_robots/atlas/atlas_v4.urdf");
+
+    return 0;
+}
@@ -0,0 +1,261 @@
+// Generate a translation unit defining a dynamics backend specialized for the kinematic tree
+// of a given URDF file. The joint loops of forward kinematics, ABA and CRBA are fully unrolled,
+// and the computations of every joint are called directly for its actual type, instead of going
+// through a visitor over the variant of all the joint types as the generic algorithms do. The
+// numerical parameters of the model are still read at runtime.
+//
+// Usage: jiminy_dynamics_codegen <urdf_path> <has_freeflyer> <backend_name> <output_path>
+
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+
+#include "pinocchio/parsers/urdf.hpp"
+
+#include "jiminy/core/robot/DynamicsBackend.h"
+#include "jiminy/core/Types.h"
+
+
+using namespace jiminy;
+
+namespace
+{
+    // Short name of the joints that cannot be specialized, because their type is not fixed
+    std::vector<std::string> const UNSUPPORTED_JOINTS{"JointModelComposite", "JointModelMimic"};
+
+    bool_t isValidIdentifier(std::string const & name)
+    {
+        return !name.empty() && !std::isdigit(static_cast<unsigned char>(name[0]))
+            && std::all_of(name.begin(), name.end(),
+                           [](char_t const & c)
+                           {
+                               return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+                           });
+    }
+
+    std::string getJointDataShortname(std::string const & jointModelShortname)
+    {
+        // The naming of pinocchio joint typedefs is consistent: 'JointModelXXX' <-> 'JointDataXXX'
+        return "JointData" + jointModelShortname.substr(std::string("JointModel").size());
+    }
+
+    void writeJointsProxies(std::ostream          & out,
+                            modelTopology_t const & topology)
+    {
+        for (std::size_t i = 0; i < topology.jointsShortname.size(); ++i)
+        {
+            std::string const & jointModelShortname = topology.jointsShortname[i];
+            std::size_t const jointIdx = i + 1;
+            out << "            auto const & jmodel" << jointIdx << " = boost::get<pinocchio::"
+                << jointModelShortname << ">(model.joints[" << jointIdx << "].toVariant());\n";
+            out << "            auto & jdata" << jointIdx << " = boost::get<pinocchio::"
+                << getJointDataShortname(jointModelShortname) << ">(data.joints[" << jointIdx << "].toVariant());\n";
+        }
+    }
+
+    void writeJointsPass(std::ostream          & out,
+                         modelTopology_t const & topology,
+                         std::string     const & pass,
+                         std::string     const & args,
+                         bool_t          const & isBackward,
+                         std::string     const & postprocessing = "")
+    {
+        std::size_t const njoints = topology.jointsShortname.size();
+        for (std::size_t k = 0; k < njoints; ++k)
+        {
+            std::size_t const jointIdx = isBackward ? njoints - k : k + 1;
+            out << "            " << pass << "::algo(jmodel" << jointIdx << ", jdata" << jointIdx
+                << ", " << args << ");\n";
+            if (!postprocessing.empty())
+            {
+                std::string line = postprocessing;
+                for (std::size_t pos = line.find("%i"); pos != std::string::npos; pos = line.find("%i"))
+                {
+                    line.replace(pos, 2, std::to_string(jointIdx));
+                }
+                out << "            " << line << "\n";
+            }
+        }
+    }
+
+    void writeBackend(std::ostream          & out,
+                      std::string     const & urdfPath,
+                      std::string     const & backendName,
+                      modelTopology_t const & topology)
+    {
+        out << "// Generated by jiminy_dynamics_codegen from '" << urdfPath << "'. Do not edit.\n"
+               "\n"
+               "#include \"pinocchio/multibody/model.hpp\"\n"
+               "#include \"pinocchio/multibody/data.hpp\"\n"
+               "#include \"pinocchio/algorithm/kinematics.hpp\"\n"
+               "#include \"pinocchio/algorithm/crba.hpp\"\n"
+               "\n"
+               "#include \"jiminy/core/robot/PinocchioOverloadAlgorithms.h\"\n"
+               "#include \"jiminy/core/robot/DynamicsBackend.h\"\n"
+               "\n"
+               "\n"
+               "namespace jiminy\n"
+               "{\n"
+               "namespace\n"
+               "{\n"
+               "    using ForwardKinematicsPass = pinocchio::ForwardKinematicSecondStep<\n"
+               "        float64_t, 0, pinocchio::JointCollectionDefaultTpl, vectorN_t, vectorN_t, vectorN_t>;\n"
+               "    using AbaPass1 = pinocchio::AbaForwardStep1<\n"
+               "        float64_t, 0, pinocchio::JointCollectionDefaultTpl, vectorN_t, vectorN_t>;\n"
+               "    using AbaPass2 = pinocchio_overload::AbaBackwardStep<\n"
+               "        float64_t, 0, pinocchio::JointCollectionDefaultTpl>;\n"
+               "    using AbaPass3 = pinocchio::AbaForwardStep2<\n"
+               "        float64_t, 0, pinocchio::JointCollectionDefaultTpl>;\n"
+               "    using CrbaPass1 = pinocchio::CrbaForwardStep<\n"
+               "        float64_t, 0, pinocchio::JointCollectionDefaultTpl, vectorN_t>;\n"
+               "    using CrbaPass2 = pinocchio::CrbaBackwardStep<\n"
+               "        float64_t, 0, pinocchio::JointCollectionDefaultTpl>;\n"
+               "\n"
+               "    modelTopology_t getTopology(void)\n"
+               "    {\n"
+               "        modelTopology_t topology;\n"
+               "        topology.jointsShortname = {\n";
+        for (std::string const & jointShortname : topology.jointsShortname)
+        {
+            out << "            \"" << jointShortname << "\",\n";
+        }
+        out << "        };\n"
+               "        topology.parents = {";
+        for (std::size_t i = 0; i < topology.parents.size(); ++i)
+        {
+            out << (i > 0 ? ", " : "") << topology.parents[i];
+        }
+        out << "};\n"
+               "        topology.nq = " << topology.nq << ";\n"
+               "        topology.nv = " << topology.nv << ";\n"
+               "        return topology;\n"
+               "    }\n"
+               "\n"
+               "    class GeneratedDynamicsBackend : public AbstractDynamicsBackend\n"
+               "    {\n"
+               "    public:\n"
+               "        GeneratedDynamicsBackend(void) :\n"
+               "        AbstractDynamicsBackend(\"" << backendName << "\", getTopology())\n"
+               "        {\n"
+               "            // Empty on purpose\n"
+               "        }\n"
+               "\n"
+               "        virtual void forwardKinematics(pinocchio::Model const & model,\n"
+               "                                       pinocchio::Data        & data,\n"
+               "                                       vectorN_t        const & q,\n"
+               "                                       vectorN_t        const & v,\n"
+               "                                       vectorN_t        const & a) const override final\n"
+               "        {\n";
+        writeJointsProxies(out, topology);
+        out << "\n"
+               "            data.v[0].setZero();\n"
+               "            data.a[0].setZero();\n";
+        writeJointsPass(out, topology, "ForwardKinematicsPass", "model, data, q, v, a", false);
+        out << "        }\n"
+               "\n"
+               "        virtual vectorN_t const & aba(pinocchio::Model const & model,\n"
+               "                                      pinocchio::Data        & data,\n"
+               "                                      vectorN_t        const & q,\n"
+               "                                      vectorN_t        const & v,\n"
+               "                                      vectorN_t        const & tau,\n"
+               "                                      forceVector_t    const & fext) const override final\n"
+               "        {\n";
+        writeJointsProxies(out, topology);
+        out << "\n"
+               "            data.v[0].setZero();\n"
+               "            data.a_gf[0] = -model.gravity;\n"
+               "            data.u = tau;\n";
+        writeJointsPass(out, topology, "AbaPass1", "model, data, q, v", false, "data.f[%i] -= fext[%i];");
+        writeJointsPass(out, topology, "AbaPass2", "model, data", true);
+        writeJointsPass(out, topology, "AbaPass3", "model, data", false);
+        out << "\n"
+               "            return data.ddq;\n"
+               "        }\n"
+               "\n"
+               "        virtual matrixN_t const & crba(pinocchio::Model const & model,\n"
+               "                                       pinocchio::Data        & data,\n"
+               "                                       vectorN_t        const & q) const override final\n"
+               "        {\n";
+        writeJointsProxies(out, topology);
+        out << "\n";
+        writeJointsPass(out, topology, "CrbaPass1", "model, data, q", false);
+        writeJointsPass(out, topology, "CrbaPass2", "model, data", true);
+        out << "\n"
+               "            data.M.diagonal() += model.rotorInertia;\n"
+               "            return data.M;\n"
+               "        }\n"
+               "    };\n"
+               "\n"
+               "    [[maybe_unused]] bool_t const isRegistered = registerDynamicsBackend(\n"
+               "        std::make_shared<GeneratedDynamicsBackend>()) == hresult_t::SUCCESS;\n"
+               "}\n"
+               "}\n";
+    }
+}
+
+int main(int argc, char_t * argv[])
+{
+    if (argc != 5)
+    {
+        std::cerr << "Usage: " << argv[0] << " <urdf_path> <has_freeflyer> <backend_name> <output_path>" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::string const urdfPath(argv[1]);
+    bool_t const hasFreeflyer = (std::string(argv[2]) == "1" || std::string(argv[2]) == "ON"
+                              || std::string(argv[2]) == "true" || std::string(argv[2]) == "TRUE");
+    std::string const backendName(argv[3]);
+    std::string const outputPath(argv[4]);
+
+    if (!isValidIdentifier(backendName))
+    {
+        std::cerr << "The backend name '" << backendName << "' must be a valid identifier." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Build the model the same way as the robots do, without flexibilities
+    pinocchio::Model model;
+    try
+    {
+        if (hasFreeflyer)
+        {
+            pinocchio::urdf::buildModel(urdfPath, pinocchio::JointModelFreeFlyer(), model);
+        }
+        else
+        {
+            pinocchio::urdf::buildModel(urdfPath, model);
+        }
+    }
+    catch (std::exception const & e)
+    {
+        std::cerr << "Impossible to build a model from the URDF '" << urdfPath << "': " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    modelTopology_t const topology = getModelTopology(model);
+    for (std::string const & jointShortname : topology.jointsShortname)
+    {
+        if (std::find(UNSUPPORTED_JOINTS.begin(), UNSUPPORTED_JOINTS.end(), jointShortname)
+            != UNSUPPORTED_JOINTS.end())
+        {
+            std::cerr << "Joints of type '" << jointShortname << "' are not supported." << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::ofstream out(outputPath, std::ios::out | std::ios::trunc);
+    if (!out.is_open())
+    {
+        std::cerr << "Impossible to open the output file '" << outputPath << "'." << std::endl;
+        return EXIT_FAILURE;
+    }
+    writeBackend(out, urdfPath, backendName, topology);
+    out.close();
+    if (out.fail())
+    {
+        std::cerr << "Impossible to write the output file '" << outputPath << "'." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
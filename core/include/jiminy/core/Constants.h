@@ -29,7 +29,6 @@ namespace jiminy
     extern float64_t const TELEMETRY_DEFAULT_TIME_UNIT;
 
     extern uint8_t const DELAY_MIN_BUFFER_RESERVE;  ///< Minimum memory allocation is memory is full and the older data stored is dated less than the desired delay
-    extern uint8_t const DELAY_MAX_BUFFER_EXCEED;   ///< Maximum number of data stored allowed to be dated more than the desired delay
 
     extern float64_t const STEPPER_MIN_TIMESTEP;
     extern float64_t const SIMULATION_MIN_TIMESTEP;
@@ -38,6 +37,7 @@ namespace jiminy
     extern uint32_t const INIT_ITERATIONS;
     extern uint32_t const PGS_MAX_ITERATIONS;
     extern float64_t const PGS_MIN_REGULARIZER;
+    extern uint32_t const ADMM_MAX_ITERATIONS;
 }
 
 #endif  // JIMINY_CONSTANTS_H
@@ -63,6 +63,7 @@ namespace jiminy
 
     // Eigen types
     using matrixN_t = Eigen::Matrix<float64_t, Eigen::Dynamic, Eigen::Dynamic>;
+    using matrix3N_t = Eigen::Matrix<float64_t, 3, Eigen::Dynamic>;
     using matrix6N_t = Eigen::Matrix<float64_t, 6, Eigen::Dynamic>;
     using matrix2_t = Eigen::Matrix<float64_t, 2, 2>;
     using matrix3_t = Eigen::Matrix<float64_t, 3, 3>;
@@ -89,6 +89,28 @@ namespace jiminy
         ///////////////////////////////////////////////////////////////////////////////////////////////
         vectorN_t const & getDrift(void) const;
 
+        ///////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief    Return the column support of the jacobian of the constraint.
+        ///
+        /// \details  It is a list of contiguous slices (first column, number of columns) outside of
+        ///           which the jacobian is always zero. It is empty if unknown, in which case the
+        ///           jacobian must be considered dense.
+        ///
+        /// \remark   The support is always closed under the supporting joints, ie it includes the
+        ///           velocity indices of all the ancestors of every joint it involves.
+        ///////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::pair<Eigen::Index, Eigen::Index> > const & getJacobianSupport(void) const;
+
+    protected:
+        ///////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief    Set the column support of the jacobian to the kinematic branches going from
+        ///           the root of the model to the given joints.
+        ///
+        /// \remark   This method must be called by `reset` once the model has been updated, since
+        ///           the velocity indices of the joints may have changed.
+        ///////////////////////////////////////////////////////////////////////////////////////////////
+        void setJacobianSupportFromBranches(std::vector<jointIndex_t> const & jointsIdx);
+
     private:
         ///////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief      Link the constraint on the given model, and initialize it.
@@ -114,6 +136,7 @@ namespace jiminy
         float64_t kd_;                      ///< Velocity-related baumgarte stabilization gain.
         matrixN_t jacobian_;                ///< Jacobian of the constraint.
         vectorN_t drift_;                   ///< Drift of the constraint.
+        std::vector<std::pair<Eigen::Index, Eigen::Index> > jacobianSupport_;  ///< Column support of the jacobian.
     };
 
     template<class T>
@@ -13,6 +13,7 @@ namespace jiminy
     class TelemetryData;
     class Robot;
     class Engine;
+    class StateArchive;
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
     ///
@@ -251,6 +252,20 @@ namespace jiminy
         ///////////////////////////////////////////////////////////////////////////////////////////////
         virtual hresult_t reset(bool_t const & resetDynamicTelemetry = false);
 
+        ///////////////////////////////////////////////////////////////////////////////////////////////
+        ///
+        /// \brief      Save or restore the internal state of the controller.
+        ///
+        /// \details    The controllers are stateless by default. Those having an internal state,
+        ///             such as integrators or filters, must override this method, so that branching
+        ///             a simulation from a saved state is deterministic.
+        ///
+        /// \remark     This method is not intended to be called manually. The Engine is taking care
+        ///             of it when its own `saveState` and `restoreState` methods are called.
+        ///
+        ///////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void processState(StateArchive & archive);
+
         ///////////////////////////////////////////////////////////////////////////////////////////////
         ///
         /// \brief      Get isInitialized_.
@@ -290,6 +305,10 @@ namespace jiminy
                      std::variant<float64_t const *, int64_t const *>
                      > registeredVariables_;                            ///< Vector of dynamically registered telemetry variables
         static_map_t<std::string, std::string> registeredConstants_;    ///< Vector of dynamically registered telemetry constants
+        std::vector<std::pair<float64_t const *,
+                              telemetryHandle_t<float64_t> > > floatsHandles_;  ///< Handles of the registered float64_t variables
+        std::vector<std::pair<int64_t const *,
+                              telemetryHandle_t<int64_t> > > intsHandles_;  ///< Handles of the registered int64_t variables
     };
 }
 
@@ -0,0 +1,101 @@
+#ifndef JIMINY_COLLISION_WORLD_H
+#define JIMINY_COLLISION_WORLD_H
+
+#include "hpp/fcl/collision_data.h"  // `hpp::fcl::CollisionRequest`, `hpp::fcl::CollisionResult`
+
+#include "jiminy/core/Macros.h"
+#include "jiminy/core/Types.h"
+
+
+namespace jiminy
+{
+    class Robot;
+
+    struct collisionContact_t
+    {
+        std::size_t systemIdx1;  ///< Index of the system of the first body
+        jointIndex_t jointIdx1;  ///< Index of the parent joint of the first body
+        std::size_t systemIdx2;  ///< Index of the system of the second body
+        jointIndex_t jointIdx2;  ///< Index of the parent joint of the second body
+        vector3_t position;      ///< Position of the contact point in world frame
+        vector3_t normal;        ///< Normal of the contact in world frame, from the first body to the second one
+        float64_t depth;         ///< Penetration depth (signed, so always negative)
+    };
+
+    /// \brief Collisions between the collision bodies of every systems, either of the same
+    ///        system (self-collisions) or of different ones.
+    ///
+    /// \details The collision with the ground is not handled here, since it is specific to each
+    ///          system. The candidate pairs are found by a sweep-and-prune broadphase on the
+    ///          bounding boxes of the geometries. The geometries are kept sorted along x-axis
+    ///          by insertion sort, which is almost linear since they move only a little between
+    ///          two successive calls. Only the candidate pairs are passed to hpp-fcl narrowphase,
+    ///          so that the cost scales with the number of bodies close to each other.
+    class CollisionWorld
+    {
+    public:
+        CollisionWorld(void);
+        ~CollisionWorld(void) = default;
+
+        /// \brief Register the collision bodies of every systems.
+        ///
+        /// \details The geometries of a given system are those for which collision pairs with
+        ///          the ground are defined. Their placement is assumed to be up-to-date when
+        ///          computing the contacts. The robots must not change until `clear` is called.
+        ///
+        /// \param[in] robots Robot of every system, whose index is used to identify the system.
+        /// \param[in] enableSelfCollisions Whether to handle the collisions between the bodies
+        ///                                 of the same system. The bodies attached to the same
+        ///                                 joint or to adjacent joints are always ignored.
+        /// \param[in] enableSystemsCollisions Whether to handle the collisions between the bodies
+        ///                                    of different systems.
+        hresult_t initialize(std::vector<Robot const *> const & robots,
+                             bool_t                     const & enableSelfCollisions,
+                             bool_t                     const & enableSystemsCollisions);
+        void clear(void);
+
+        /// \brief Whether some collisions may occur at all.
+        bool_t getIsEmpty(void) const;
+
+        /// \brief Update the bounding boxes of the geometries, then compute the contacts between
+        ///        all the bodies whose bounding boxes overlap.
+        ///
+        /// \details The output buffer is owned by the world, and it is valid until the next call.
+        std::vector<collisionContact_t> const & computeContacts(void);
+
+        /// \brief Pairs of geometries whose bounding boxes overlap, found by the last call.
+        std::vector<std::pair<std::size_t, std::size_t> > const & getCandidatePairs(void) const;
+
+    private:
+        struct geometry_t
+        {
+            std::size_t systemIdx;
+            geomIndex_t geomIdx;
+            jointIndex_t jointIdx;
+            jointIndex_t parentJointIdx;                   ///< Parent of the joint of the geometry, to ignore adjacent bodies
+            hpp::fcl::CollisionGeometry const * shape;
+            vector3_t center;                              ///< Center of the bounding sphere in the frame of the geometry
+            float64_t radius;                              ///< Radius of the bounding sphere of the geometry
+            vector3_t boxMin;                              ///< Lower bound of the bounding box in world frame
+            vector3_t boxMax;                              ///< Upper bound of the bounding box in world frame
+        };
+
+        void updateBoundingBoxes(void);
+        void sweepAndPrune(void);
+        bool_t isPairEnabled(geometry_t const & geom1,
+                             geometry_t const & geom2) const;
+
+    private:
+        std::vector<Robot const *> robots_;
+        std::vector<geometry_t> geometries_;
+        std::vector<std::size_t> geometriesSortedIdx_;  ///< Geometries sorted by lower bound along x-axis
+        std::vector<std::pair<std::size_t, std::size_t> > candidatePairs_;
+        std::vector<collisionContact_t> contacts_;
+        hpp::fcl::CollisionRequest collisionRequest_;
+        hpp::fcl::CollisionResult collisionResult_;
+        bool_t enableSelfCollisions_;
+        bool_t enableSystemsCollisions_;
+    };
+}
+
+#endif  // JIMINY_COLLISION_WORLD_H
@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// \brief      Batch of independent single-robot engines stepped in lock-step.
+///
+/// \details    Every engine simulates its own robot, but all the robots must share the
+///             same model, so that the actions of the whole batch can be stored in a
+///             single matrix. The engines are stepped concurrently over a thread pool.
+///
+/// \warning    The engines are running in parallel. Therefore, every callback involved in
+///             the simulation (controller, force profiles, heightmap...) must be thread-safe,
+///             which is not the case of the ones implemented in Python.
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef JIMINY_ENGINE_BATCH_H
+#define JIMINY_ENGINE_BATCH_H
+
+#include "jiminy/core/engine/Engine.h"
+#include "jiminy/core/utilities/ThreadPool.h"
+#include "jiminy/core/Macros.h"
+#include "jiminy/core/Types.h"
+
+
+namespace jiminy
+{
+    class EngineBatch
+    {
+    public:
+        // Disable the copy of the class
+        EngineBatch(EngineBatch const & engine) = delete;
+        EngineBatch & operator = (EngineBatch const & other) = delete;
+
+    public:
+        EngineBatch(void);
+        ~EngineBatch(void);
+
+        /// \brief Create one engine per robot.
+        ///
+        /// \details The command of the motors of the i-th robot is the i-th row of the
+        ///          actions provided to `stepBatch`. The robots must have been initialized
+        ///          beforehand, they must be distinct and share the same model.
+        ///
+        /// \param[in] robots Robots to simulate.
+        /// \param[in] threadsNum Number of threads of the pool, including the calling one.
+        ///                       Use the number of hardware threads if 0.
+        hresult_t initialize(std::vector<std::shared_ptr<Robot> > const & robots,
+                             uint32_t                             const & threadsNum = 0U);
+
+        /// \brief Set the options of every engine at once.
+        ///
+        /// \details The random seed of the i-th engine is derived from the one of the options
+        ///          as `randomSeed + i * 0x9E3779B9`, so that the engines draw independent
+        ///          random numbers, while the first one uses the seed of the options as is.
+        hresult_t setOptions(configHolder_t const & engineOptions);
+        configHolder_t getOptions(void) const;
+
+        /// \brief Start the simulation of every engine.
+        ///
+        /// \param[in] qInit Initial configuration of each engine, one per row.
+        /// \param[in] vInit Initial velocity of each engine, one per row.
+        hresult_t start(matrixN_t const & qInit,
+                        matrixN_t const & vInit);
+
+        /// \brief Integrate every running engine over a given timestep.
+        ///
+        /// \details The return code of each engine is available through `getReturnCodes`.
+        ///          The engines for which the integration failed are stopped, and must be
+        ///          restarted by calling `resetBatch`.
+        ///
+        /// \param[in] actions Command of the motors of each engine, one per row.
+        /// \param[in] stepSize Duration of the step. See `EngineMultiRobot::step`.
+        hresult_t stepBatch(matrixN_t const & actions,
+                            float64_t const & stepSize = -1);
+
+        /// \brief Restart the simulation of a subset of engines.
+        ///
+        /// \details It does not re-seed the random number generators of the engines, so that
+        ///          the restarted simulations are not replicas of the previous ones.
+        ///
+        /// \param[in] mask Whether to restart each engine.
+        /// \param[in] qInit Initial configuration of each engine, one per row.
+        /// \param[in] vInit Initial velocity of each engine, one per row.
+        hresult_t resetBatch(std::vector<bool_t> const & mask,
+                             matrixN_t           const & qInit,
+                             matrixN_t           const & vInit);
+
+        /// \brief Stop the simulation of every engine.
+        void stop(void);
+
+        std::size_t getBatchSize(void) const;
+        hresult_t getEngine(std::size_t             const & engineIdx,
+                            std::shared_ptr<Engine>       & engine);
+        std::vector<hresult_t> const & getReturnCodes(void) const;
+        bool_t const & getIsInitialized(void) const;
+
+    private:
+        hresult_t checkBatchInput(matrixN_t   const & data,
+                                  Eigen::Index const & cols,
+                                  std::string const & name) const;
+        hresult_t gatherReturnCodes(void) const;
+
+    private:
+        bool_t isInitialized_;
+        std::vector<std::shared_ptr<Engine> > engines_;
+        std::unique_ptr<ThreadPool> pool_;
+        matrixN_t actions_;  ///< Command of the motors of each engine, stored column-wise for contiguous access
+        std::vector<hresult_t> returnCodes_;
+        int32_t nq_;
+        int32_t nv_;
+        uint64_t nmotors_;
+    };
+}
+
+#endif  // JIMINY_ENGINE_BATCH_H
@@ -4,10 +4,13 @@
 #include <functional>
 
 #include "jiminy/core/telemetry/TelemetrySender.h"
+#include "jiminy/core/utilities/Random.h"
 #include "jiminy/core/Types.h"
 #include "jiminy/core/Constants.h"
 
 #include "jiminy/core/engine/System.h"
+#include "jiminy/core/engine/CollisionWorld.h"
+#include "jiminy/core/stepper/LieGroup.h"
 
 
 namespace jiminy
@@ -24,7 +27,9 @@ namespace jiminy
     enum class constraintSolver_t : uint8_t
     {
         NONE = 0,
-        PGS = 1  // Projected Gauss-Seidel
+        PGS = 1,        // Projected Gauss-Seidel
+        BLOCK_PGS = 2,  // Projected Gauss-Seidel updating each friction cone at once
+        ADMM = 3        // Alternating Direction Method of Multipliers
     };
 
     std::map<std::string, contactModel_t> const CONTACT_MODELS_MAP {
@@ -33,11 +38,15 @@ namespace jiminy
     };
 
     std::map<std::string, constraintSolver_t> const CONSTRAINT_SOLVERS_MAP {
-        {"PGS", constraintSolver_t::PGS}
+        {"PGS", constraintSolver_t::PGS},
+        {"BlockPGS", constraintSolver_t::BLOCK_PGS},
+        {"ADMM", constraintSolver_t::ADMM}
     };
 
     std::set<std::string> const STEPPERS {
         "euler_explicit",
+        "euler_semi_implicit",
+        "euler_linear_implicit",
         "runge_kutta_4",
         "runge_kutta_dopri5"
     };
@@ -49,6 +58,8 @@ namespace jiminy
     class AbstractStepper;
     class TelemetryData;
     class TelemetryRecorder;
+    class ThreadPool;
+    class StateArchive;
     struct logData_t;
 
     using forceCouplingRegister_t = std::vector<forceCoupling_t>;
@@ -56,10 +67,11 @@ namespace jiminy
     struct stepperState_t
     {
     public:
-        void reset(float64_t              const & dtInit,
-                   std::vector<vectorN_t> const & qSplitInit,
-                   std::vector<vectorN_t> const & vSplitInit,
-                   std::vector<vectorN_t> const & aSplitInit)
+        void reset(float64_t                  const & dtInit,
+                   std::vector<Robot const *> const & robots,
+                   std::vector<vectorN_t>     const & qSplitInit,
+                   std::vector<vectorN_t>     const & vSplitInit,
+                   std::vector<vectorN_t>     const & aSplitInit)
         {
             iter = 0U;
             iterFailed = 0U;
@@ -69,9 +81,8 @@ namespace jiminy
             dtLargest = dtInit;
             dtLargestPrev = dtInit;
             tError = 0.0;
-            qSplit = qSplitInit;
-            vSplit = vSplitInit;
-            aSplit = aSplitInit;
+            state = state_t(robots, qSplitInit, vSplitInit);
+            stateDerivative = stateDerivative_t(robots, vSplitInit, aSplitInit);
         }
 
     public:
@@ -83,9 +94,23 @@ namespace jiminy
         float64_t dt;
         float64_t dtLargest;
         float64_t dtLargestPrev;
-        std::vector<vectorN_t> qSplit;
-        std::vector<vectorN_t> vSplit;
-        std::vector<vectorN_t> aSplit;
+        state_t state;                      ///< Configuration and velocity of every system, integrated in place by the stepper
+        stateDerivative_t stateDerivative;  ///< Velocity and acceleration of every system, integrated in place by the stepper
+    };
+
+    /// \brief Group of systems integrated together, independently from the other groups.
+    ///
+    /// \details The systems of a group are coupled through coupling forces, directly or not,
+    ///          whereas they are not coupled with the systems of any other group.
+    struct systemsGroup_t
+    {
+    public:
+        std::vector<std::size_t> systemsIdx;       ///< Indices of the systems in the group, in increasing order
+        std::vector<std::size_t> couplingsIdx;     ///< Indices of the coupling forces between these systems
+        std::unique_ptr<AbstractStepper> stepper;  ///< Stepper dedicated to the group
+        stepperState_t stepperState;               ///< State of the stepper, with its own time step
+        uint32_t successiveIterFailed;             ///< Number of successive failed steps of the group
+        bool_t isNan;                              ///< Whether the integration of the group diverged
     };
 
     class EngineMultiRobot
@@ -97,7 +122,7 @@ namespace jiminy
         configHolder_t getDefaultConstraintOptions()
         {
             configHolder_t config;
-            config["solver"] = std::string("PGS");   // ["PGS",]
+            config["solver"] = std::string("PGS");   // ["PGS", "BlockPGS", "ADMM"]
             config["regularization"] = 1.0e-3;       // Relative inverse damping wrt. diagonal of J.Minv.J.t. 0.0 to enforce the minimum absolute regularizer.
 
             return config;
@@ -114,6 +139,8 @@ namespace jiminy
             config["transitionEps"] = 1.0e-3;        // [m]
             config["transitionVelocity"] = 1.0e-2;   // [m.s-1]
             config["stabilizationFreq"] = 20.0;      // [s-1]: 0.0 to disable
+            config["enableSelfCollisions"] = false;
+            config["enableSystemsCollisions"] = false;
 
             return config;
         };
@@ -145,7 +172,7 @@ namespace jiminy
             configHolder_t config;
             config["verbose"] = false;
             config["randomSeed"] = 0U;
-            config["odeSolver"] = std::string("runge_kutta_dopri5");  // ["runge_kutta_dopri5", "runge_kutta_4", "euler_explicit"]
+            config["odeSolver"] = std::string("runge_kutta_dopri5");  // ["runge_kutta_dopri5", "runge_kutta_4", "euler_explicit", "euler_semi_implicit", "euler_linear_implicit"]
             config["tolAbs"] = 1.0e-5;
             config["tolRel"] = 1.0e-4;
             config["dtMax"] = SIMULATION_MAX_TIMESTEP;
@@ -156,6 +183,9 @@ namespace jiminy
             config["sensorsUpdatePeriod"] = 0.0;
             config["controllerUpdatePeriod"] = 0.0;
             config["logInternalStepperSteps"] = false;
+            config["useDenseOutput"] = false;  // Interpolate sensors and telemetry within steps instead of stopping there, if supported by the stepper
+            config["multiRate"] = false;  // Integrate every group of coupled systems with its own time step, synchronizing them only at breakpoints. Only breakpoints are logged in this case.
+            config["threadsNum"] = 1U;  // 1: serial, 0: as many as hardware threads
 
             return config;
         };
@@ -171,6 +201,11 @@ namespace jiminy
             config["enableCommand"] = true;
             config["enableMotorEffort"] = true;
             config["enableEnergy"] = true;
+            config["enableConstraintSolverIter"] = false;
+            config["streamingPath"] = std::string("");  // Binary log file to which the data are streamed during the simulation. Keep everything in memory if empty.
+            config["maxInFlightChunks"] = 4U;  // Maximum number of chunks of memory in streaming mode, which bounds the memory usage
+            config["compression"] = std::string("gzip");  // Compression of the HDF5 log files, either "gzip" or "none"
+            config["chunkSize"] = 65536U;  // Number of samples per chunk of the HDF5 log files, which bounds the memory usage when writing them
             return config;
         };
 
@@ -210,6 +245,8 @@ namespace jiminy
             float64_t const transitionEps;
             float64_t const transitionVelocity;
             float64_t const stabilizationFreq;
+            bool_t const enableSelfCollisions;     ///< Collisions between the collision bodies of the same system
+            bool_t const enableSystemsCollisions;  ///< Collisions between the collision bodies of different systems
 
             contactOptions_t(configHolder_t const & options) :
             model(boost::get<std::string>(options.at("model"))),
@@ -219,7 +256,9 @@ namespace jiminy
             torsion(boost::get<float64_t>(options.at("torsion"))),
             transitionEps(boost::get<float64_t>(options.at("transitionEps"))),
             transitionVelocity(boost::get<float64_t>(options.at("transitionVelocity"))),
-            stabilizationFreq(boost::get<float64_t>(options.at("stabilizationFreq")))
+            stabilizationFreq(boost::get<float64_t>(options.at("stabilizationFreq"))),
+            enableSelfCollisions(boost::get<bool_t>(options.at("enableSelfCollisions"))),
+            enableSystemsCollisions(boost::get<bool_t>(options.at("enableSystemsCollisions")))
             {
                 // Empty on purpose
             }
@@ -266,6 +305,9 @@ namespace jiminy
             float64_t   const sensorsUpdatePeriod;
             float64_t   const controllerUpdatePeriod;
             bool_t      const logInternalStepperSteps;
+            bool_t      const useDenseOutput;
+            bool_t      const multiRate;
+            uint32_t    const threadsNum;
 
             stepperOptions_t(configHolder_t const & options) :
             verbose(boost::get<bool_t>(options.at("verbose"))),
@@ -280,7 +322,10 @@ namespace jiminy
             timeout(boost::get<float64_t>(options.at("timeout"))),
             sensorsUpdatePeriod(boost::get<float64_t>(options.at("sensorsUpdatePeriod"))),
             controllerUpdatePeriod(boost::get<float64_t>(options.at("controllerUpdatePeriod"))),
-            logInternalStepperSteps(boost::get<bool_t>(options.at("logInternalStepperSteps")))
+            logInternalStepperSteps(boost::get<bool_t>(options.at("logInternalStepperSteps"))),
+            useDenseOutput(boost::get<bool_t>(options.at("useDenseOutput"))),
+            multiRate(boost::get<bool_t>(options.at("multiRate"))),
+            threadsNum(boost::get<uint32_t>(options.at("threadsNum")))
             {
                 // Empty on purpose
             }
@@ -296,6 +341,11 @@ namespace jiminy
             bool_t const enableCommand;
             bool_t const enableMotorEffort;
             bool_t const enableEnergy;
+            bool_t const enableConstraintSolverIter;
+            std::string const streamingPath;
+            uint32_t const maxInFlightChunks;
+            std::string const compression;
+            uint32_t const chunkSize;
 
             telemetryOptions_t(configHolder_t const & options) :
             isPersistent(boost::get<bool_t>(options.at("isPersistent"))),
@@ -305,7 +355,12 @@ namespace jiminy
             enableForceExternal(boost::get<bool_t>(options.at("enableForceExternal"))),
             enableCommand(boost::get<bool_t>(options.at("enableCommand"))),
             enableMotorEffort(boost::get<bool_t>(options.at("enableMotorEffort"))),
-            enableEnergy(boost::get<bool_t>(options.at("enableEnergy")))
+            enableEnergy(boost::get<bool_t>(options.at("enableEnergy"))),
+            enableConstraintSolverIter(boost::get<bool_t>(options.at("enableConstraintSolverIter"))),
+            streamingPath(boost::get<std::string>(options.at("streamingPath"))),
+            maxInFlightChunks(boost::get<uint32_t>(options.at("maxInFlightChunks"))),
+            compression(boost::get<std::string>(options.at("compression"))),
+            chunkSize(boost::get<uint32_t>(options.at("chunkSize")))
             {
                 // Empty on purpose
             }
@@ -459,6 +514,26 @@ namespace jiminy
         ///          variables or forces.
         void stop(void);
 
+        /// \brief Save the whole internal state of the running simulation.
+        ///
+        /// \details It includes the state of the steppers, the state of every system and its
+        ///          external forces, the constraint multipliers, the past data of the sensors, the
+        ///          random number generators and the state of the controllers. Every quantity is
+        ///          copied as is in a flat buffer, so that it is cheap enough to branch simulations
+        ///          at high rate. The buffer is reused without allocating memory if possible.
+        ///
+        /// \param[out] state Buffer in which to save the state.
+        hresult_t saveState(std::vector<uint8_t> & state);
+
+        /// \brief Restore the internal state of the running simulation from a saved one.
+        ///
+        /// \details The state must have been saved from a simulation of the same systems, with the
+        ///          same forces and constraints. Nothing is modified if it is not the case. The
+        ///          telemetry is not rewound, so the log keeps going from the restored time.
+        ///
+        /// \param[in] state Buffer from which to restore the state.
+        hresult_t restoreState(std::vector<uint8_t> const & state);
+
         /// \brief Run a simulation of duration tEnd, starting at xInit.
         ///
         /// \param[in] tEnd End time, i.e. amount of time to simulate.
@@ -514,18 +589,73 @@ namespace jiminy
                                              vectorN_t const & q,
                                              vectorN_t const & v,
                                              vectorN_t const & a);
+        static void computeForwardKinematics(systemHolder_t         & system,
+                                             kinematicsPlan_t const & kinematicsPlan,
+                                             vectorN_t        const & q,
+                                             vectorN_t        const & v,
+                                             vectorN_t        const & a);
         hresult_t computeSystemsDynamics(float64_t              const & t,
                                          std::vector<vectorN_t> const & qSplit,
                                          std::vector<vectorN_t> const & vSplit,
                                          std::vector<vectorN_t>       & aSplit);
 
+        /// \brief Linearize the stiff efforts applied on every system around a given state.
+        ///
+        /// \details The stiff efforts are the flexible joints and the spring-damper contacts
+        ///          with the ground. Only the upper triangular part of the mass matrix is filled.
+        void computeSystemsLinearization(float64_t              const & t,
+                                         std::vector<vectorN_t> const & qSplit,
+                                         std::vector<vectorN_t> const & vSplit,
+                                         std::vector<matrixN_t>       & massSplit,
+                                         std::vector<matrixN_t>       & stiffnessSplit,
+                                         std::vector<matrixN_t>       & dampingSplit);
+
     protected:
+        /// \brief Register the variables of the engine, the robots and the controllers.
+        hresult_t registerTelemetryVariables(void);
+        /// \brief Configure the telemetry, recycling the one of the previous simulation if
+        ///        the registered variables are unchanged.
         hresult_t configureTelemetry(void);
         void updateTelemetry(void);
 
+        /// \brief Save, check or restore the internal state of the simulation.
+        void processState(StateArchive & archive);
+
         void syncStepperStateWithSystems(void);
         void syncSystemsStateWithStepper(bool_t const & sync_acceleration_only = false);
 
+        /// \brief Reset the random number generator of the engine, and give every system its
+        ///        own independent stream for the same seed.
+        ///
+        /// \details The process-wide generator is not used, so that several engines can run
+        ///          concurrently and deterministically.
+        void seedRandomGenerators(uint32_t const & seed);
+
+        /// \brief Update the sensors and the telemetry at every sampling instant within the last step.
+        ///
+        /// \details The state of the systems at these instants is interpolated from the dense output
+        ///          of the stepper, so that they are not breakpoints for the integration. The motor
+        ///          efforts and the external forces are those at the end of the step.
+        ///
+        /// \param[in] tStart        Starting time of the last successful step.
+        /// \param[in] tEnd          Ending time of the last successful step.
+        /// \param[in] isEndIncluded Whether to process the end of the step, if it is a sampling instant.
+        void updateWithinStep(float64_t const & tStart,
+                              float64_t const & tEnd,
+                              bool_t    const & isEndIncluded);
+
+        /// \brief Integrate a group of systems with its own adaptive time step up to a breakpoint.
+        ///
+        /// \details The state of the systems is only updated on success. Otherwise, the time of the
+        ///          group is left behind, and the cause of failure is reported by the group itself.
+        ///          It only modifies the data of the systems of the group, so that several groups
+        ///          can be integrated concurrently.
+        ///
+        /// \param[in, out] group   Group of systems to integrate.
+        /// \param[in] tEnd         Breakpoint to reach.
+        void stepGroup(systemsGroup_t       & group,
+                       float64_t      const & tEnd);
+
 
         /// \brief Compute the force resulting from ground contact on a given body.
         ///
@@ -537,13 +667,24 @@ namespace jiminy
                                           std::shared_ptr<AbstractConstraintBase> & contactConstraint,
                                           pinocchio::Force & fextLocal) const;
 
+        /// \brief Compute the height and normal of the ground below every contact frame of a system.
+        ///
+        /// \details The ground is queried for all the contact frames at once if it is a
+        ///          `GridHeightmap`, and one by one otherwise.
+        void computeGroundAtContactFrames(systemHolder_t     const & system,
+                                          systemDataHolder_t       & systemData) const;
+
         /// \brief Compute the force resulting from ground contact on a given frame.
         ///
         /// \param[in] system      System for which to perform computation.
         /// \param[in] frameIdx    Id of the frame in contact.
+        /// \param[in] zGround     Height of the ground below the frame.
+        /// \param[in] nGround     Normal of the ground below the frame, normalized.
         /// \return Contact force, at parent joint, in the local frame.
         void computeContactDynamicsAtFrame(systemHolder_t const & system,
                                            frameIndex_t const & frameIdx,
+                                           float64_t const & zGround,
+                                           vector3_t const & nGround,
                                            std::shared_ptr<AbstractConstraintBase> & collisionConstraint,
                                            pinocchio::Force & fextLocal) const;
 
@@ -566,6 +707,14 @@ namespace jiminy
         void computeCollisionForces(systemHolder_t     const & system,
                                     systemDataHolder_t       & systemData,
                                     forceVector_t            & fext) const;
+
+        /// \brief Compute the forces due to the collisions between bodies, either of the same
+        ///        system or of different ones.
+        ///
+        /// \details They are always computed using the spring-damper contact model, since the
+        ///          constraint solver of each system cannot handle constraints involving several
+        ///          systems.
+        void computeBodiesCollisionForces(void);
         void computeExternalForces(systemHolder_t     const & system,
                                    systemDataHolder_t       & systemData,
                                    float64_t          const & t,
@@ -575,9 +724,56 @@ namespace jiminy
         void computeForcesCoupling(float64_t              const & t,
                                    std::vector<vectorN_t> const & qSplit,
                                    std::vector<vectorN_t> const & vSplit);
+        void computeForceCoupling(forceCoupling_t       & forceCoupling,
+                                  float64_t       const & t,
+                                  vectorN_t       const & q1,
+                                  vectorN_t       const & v1,
+                                  vectorN_t       const & q2,
+                                  vectorN_t       const & v2);
+        void computeSystemTerms(systemHolder_t           & system,
+                                systemDataHolder_t       & systemData,
+                                float64_t          const & t,
+                                vectorN_t          const & q,
+                                vectorN_t          const & v);
         void computeAllTerms(float64_t              const & t,
                              std::vector<vectorN_t> const & qSplit,
                              std::vector<vectorN_t> const & vSplit);
+        void computeSystemDynamics(systemHolder_t           & system,
+                                   systemDataHolder_t       & systemData,
+                                   float64_t          const & t,
+                                   vectorN_t          const & q,
+                                   vectorN_t          const & v,
+                                   vectorN_t                & a);
+        void computeSystemLinearization(systemHolder_t           & system,
+                                        systemDataHolder_t       & systemData,
+                                        vectorN_t          const & q,
+                                        vectorN_t          const & v,
+                                        matrixN_t                & mass,
+                                        matrixN_t                & stiffness,
+                                        matrixN_t                & damping);
+
+        /// \brief Same as `computeSystemsDynamics`, but only for a group of systems.
+        ///
+        /// \details The state of the systems is ordered as in the group.
+        void computeGroupDynamics(systemsGroup_t         const & group,
+                                  float64_t              const & t,
+                                  std::vector<vectorN_t> const & qSplit,
+                                  std::vector<vectorN_t> const & vSplit,
+                                  std::vector<vectorN_t>       & aSplit);
+
+        /// \brief Same as `computeSystemsLinearization`, but only for a group of systems.
+        void computeGroupLinearization(systemsGroup_t         const & group,
+                                       std::vector<vectorN_t> const & qSplit,
+                                       std::vector<vectorN_t> const & vSplit,
+                                       std::vector<matrixN_t>       & massSplit,
+                                       std::vector<matrixN_t>       & stiffnessSplit,
+                                       std::vector<matrixN_t>       & dampingSplit);
+
+        /// \brief Run a given function for every system.
+        ///
+        /// \details The systems are processed concurrently if a thread pool is available,
+        ///          so the function must only involve the system it is given.
+        void foreachSystem(std::function<void(std::size_t const &)> const & fct);
 
         /// \brief Compute system acceleration from current system state.
         ///
@@ -656,8 +852,15 @@ namespace jiminy
         std::shared_ptr<TelemetryData> telemetryData_;
         std::unique_ptr<TelemetryRecorder> telemetryRecorder_;
         std::unique_ptr<AbstractStepper> stepper_;
+        std::unique_ptr<ThreadPool> threadPool_;
+        PhiloxGenerator generator_;
         float64_t stepperUpdatePeriod_;
+        float64_t stepperBreakPeriod_;  ///< Period of the discontinuous events, that must end an integration step
         stepperState_t stepperState_;
+        std::vector<systemsGroup_t> systemsGroups_;  ///< Groups of systems integrated independently, empty if disabled
+        CollisionWorld collisionWorld_;
+        state_t denseOutputState_;
+        stateDerivative_t denseOutputStateDerivative_;
         vector_aligned_t<systemDataHolder_t> systemsDataHolder_;
         forceCouplingRegister_t forcesCoupling_;
         vector_aligned_t<forceVector_t> contactForcesPrev_;
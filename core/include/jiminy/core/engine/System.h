@@ -7,6 +7,7 @@
 #include <set>
 
 #include "jiminy/core/robot/Model.h"
+#include "jiminy/core/telemetry/TelemetrySender.h"
 #include "jiminy/core/Types.h"
 
 
@@ -129,6 +130,41 @@ namespace jiminy
         bool_t isInitialized_;
     };
 
+    /// \brief Precompiled plan for updating the placement of the frames and collision
+    ///        geometries, computed once and for all when starting a simulation.
+    ///
+    /// \details The frames whose placement is the same as their parent joint, or as the
+    ///          previous frame for bodies attached through fixed joints, are simply copied.
+    ///          Only the geometries involved in at least one collision pair are updated.
+    struct kinematicsPlan_t
+    {
+    public:
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+        struct geometry_t
+        {
+        public:
+            EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+        public:
+            geomIndex_t geomIdx;
+            jointIndex_t jointIdx;
+            pinocchio::SE3 placement;
+        };
+
+    public:
+        kinematicsPlan_t(void) = default;
+
+        void initialize(Robot const & robot);
+        void clear(void);
+
+    public:
+        std::vector<frameIndex_t> framesComposed;                             ///< Frames whose placement must be composed with the one of their parent joint
+        std::vector<std::pair<frameIndex_t, jointIndex_t> > framesFromJoint;  ///< Frames having the same placement as their parent joint
+        std::vector<std::pair<frameIndex_t, frameIndex_t> > framesFromFrame;  ///< Bodies having the same placement as their previous frame, sorted by increasing index
+        vector_aligned_t<geometry_t> geometries;                              ///< Geometries involved in at least one collision pair
+    };
+
     struct systemDataHolder_t
     {
     public:
@@ -146,8 +182,13 @@ namespace jiminy
         std::unique_ptr<AbstractConstraintSolver> constraintSolver;
         constraintsHolder_t constraintsHolder;                         ///< Store copy of constraints register for fast access.
         forceVector_t contactFramesForces;                             ///< Contact forces for each contact frames in local frame
+        matrix3N_t contactFramesPositions;                             ///< Position of each contact frame in world frame
+        vectorN_t contactFramesGroundHeights;                          ///< Height of the ground below each contact frame
+        matrix3N_t contactFramesGroundNormals;                         ///< Normal of the ground below each contact frame
+        matrix6N_t contactFrameJacobian;                               ///< Jacobian of a contact frame - buffer for linearizing the contact forces
+        vectorN_t contactJacobianNormal;                               ///< Normal part of the jacobian of a contact frame - buffer for linearizing the contact forces
         vector_aligned_t<forceVector_t> collisionBodiesForces;         ///< Contact forces for each geometries of each collision bodies in local frame
-        matrix6N_t jointJacobian;                                      ///< Buffer used for intermediary computation of `data.u`
+        kinematicsPlan_t kinematicsPlan;                               ///< Plan for updating frames and collision geometries placement
 
         std::vector<std::string> logFieldnamesPosition;
         std::vector<std::string> logFieldnamesVelocity;
@@ -156,6 +197,23 @@ namespace jiminy
         std::vector<std::string> logFieldnamesCommand;
         std::vector<std::string> logFieldnamesMotorEffort;
         std::string logFieldnameEnergy;
+        std::string logFieldnameConstraintSolverIter;
+
+        telemetryHandle_t<float64_t> logHandlePosition;
+        telemetryHandle_t<float64_t> logHandleVelocity;
+        telemetryHandle_t<float64_t> logHandleAcceleration;
+        telemetryHandle_t<float64_t> logHandleForceExternal;
+        telemetryHandle_t<float64_t> logHandleCommand;
+        telemetryHandle_t<float64_t> logHandleMotorEffort;
+        telemetryHandle_t<float64_t> logHandleEnergy;
+        telemetryHandle_t<int64_t> logHandleConstraintSolverIter;
+
+        pinocchio::Model pncModelLogged;                                ///< Model whose serialization is cached, to detect changes between simulations
+        pinocchio::GeometryModel collisionModelLogged;                  ///< Collision model whose serialization is cached. The geometries are shared, not copied.
+        pinocchio::GeometryModel visualModelLogged;                     ///< Visual model whose serialization is cached. The geometries are shared, not copied.
+        std::string pncModelBinary;                                     ///< Serialized model logged as constant
+        std::string collisionModelBinary;                               ///< Serialized collision model logged as constant, empty if not available
+        std::string visualModelBinary;                                  ///< Serialized visual model logged as constant
 
         systemState_t state;       ///< Internal buffer with the state for the integration loop
         systemState_t statePrev;   ///< Internal state for the integration loop at the end of the previous iteration
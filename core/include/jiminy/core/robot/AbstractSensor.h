@@ -17,8 +17,6 @@
 #include "jiminy/core/Macros.h"
 #include "jiminy/core/Types.h"
 
-#include <boost/circular_buffer.hpp>
-
 
 namespace jiminy
 {
@@ -41,8 +39,37 @@ namespace jiminy
     ///////////////////////////////////////////////////////////////////////////////////////////////
     struct SensorSharedDataHolder_t
     {
-        boost::circular_buffer<float64_t> time_;     ///< Circular buffer of the stored timesteps
-        boost::circular_buffer<matrixN_t> data_;     ///< Circular buffer of past sensor real data
+        /// \brief Timestep stored at a given position in the ring buffer, 0 being the oldest one.
+        float64_t & timeAt(std::size_t const & i);
+        float64_t const & timeAt(std::size_t const & i) const;
+
+        /// \brief Real data of every sensor stored at a given position in the ring buffer, one column per sensor.
+        Eigen::Block<matrixN_t, Eigen::Dynamic, Eigen::Dynamic, true> dataAt(std::size_t const & i);
+
+        /// \brief Position of the last timestep less or equal to a given time, -1 if none.
+        std::ptrdiff_t bisectLeft(float64_t const & t) const;
+
+        /// \brief Reset the ring buffer to a single timestep, whose data are preserved.
+        ///
+        /// \details The layout of the buffer depends on the number of sensors, so it must be
+        ///          reset every time a sensor is attached or detached.
+        void resetBuffer(matrixN_t const & data,
+                         float64_t const & t);
+
+        /// \brief Increase the capacity of the ring buffer, keeping the stored timesteps.
+        void reserve(std::size_t const & capacity);
+
+        /// \brief Append a timestep, whose data are a copy of the most recent ones.
+        ///
+        /// \details Memory is allocated only if the ring buffer is full.
+        void pushBack(float64_t const & t);
+        void popBack(void);
+        void popFront(void);
+
+        vectorN_t time_;                             ///< Ring buffer of the stored timesteps
+        matrixN_t data_;                             ///< Ring buffer of past sensor real data, stored contiguously as (sensor dim) x (timesteps x sensors)
+        std::size_t head_;                           ///< Position of the oldest timestep in the ring buffer
+        std::size_t size_;                           ///< Number of timesteps actually stored in the ring buffer
         matrixN_t dataMeasured_;                     ///< Buffer of current sensor measurement data
         std::vector<AbstractSensorBase *> sensors_;  ///< Vector of pointers to the sensors
         std::size_t num_;                            ///< Number of sensors of that type
@@ -419,9 +446,11 @@ namespace jiminy
         bool_t isTelemetryConfigured_;        ///< Flag to determine whether the telemetry of the sensor has been initialized or not
         std::weak_ptr<Robot const> robot_;    ///< Robot for which the command and internal dynamics
         std::string name_;                    ///< Name of the sensor
+        vectorN_t noise_;                     ///< Buffer storing the white noise, to avoid allocating memory while measuring
 
     private:
-        TelemetrySender telemetrySender_;     ///< Telemetry sender of the sensor used to register and update telemetry variables
+        TelemetrySender telemetrySender_;               ///< Telemetry sender of the sensor used to register and update telemetry variables
+        telemetryHandle_t<float64_t> telemetryHandle_;  ///< Handle of the measurements in the telemetry buffer
     };
 
     template<class T>
@@ -466,6 +495,10 @@ namespace jiminy
         virtual hresult_t detach(void) override final;
         virtual std::string getTelemetryName(void) const override final;
         virtual hresult_t interpolateData(void) override final;
+        /// \brief Interpolate the real data of a range of consecutive sensors, sharing the same delay.
+        hresult_t interpolateDataRange(float64_t   const & delay,
+                                       std::size_t const & sensorIdx,
+                                       std::size_t const & sensorNum);
         virtual hresult_t measureDataAll(void) override final;
         void clearDataBuffer(void);
 
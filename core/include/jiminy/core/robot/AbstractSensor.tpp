@@ -76,25 +76,23 @@ namespace jiminy
         // Define the sensor index
         sensorIdx_ = sharedHolder_->num_;
 
-        // Make sure the shared data buffers are properly pre-allocated
-        if (sharedHolder_->time_.empty())
+        /* Add a column for the sensor to the shared data buffers.
+           Only the most recent data are preserved, since the layout depends on the number of sensors. */
+        matrixN_t dataLast(getSize(), sharedHolder_->num_ + 1);
+        float64_t timeLast = 0.0;
+        if (sharedHolder_->size_ > 0)
         {
-            sharedHolder_->time_.assign(1, 0.0);
-            sharedHolder_->data_.resize(1);
-        }
-
-        // Add a column for the sensor to the shared data buffers
-        for (matrixN_t & data : sharedHolder_->data_)
-        {
-            data.conservativeResize(getSize(), sharedHolder_->num_ + 1);
-            data.rightCols<1>().setZero();
+            dataLast.leftCols(sharedHolder_->num_) = sharedHolder_->dataAt(sharedHolder_->size_ - 1);
+            timeLast = sharedHolder_->timeAt(sharedHolder_->size_ - 1);
         }
+        dataLast.rightCols<1>().setZero();
         sharedHolder_->dataMeasured_.conservativeResize(getSize(), sharedHolder_->num_ + 1);
         sharedHolder_->dataMeasured_.rightCols<1>().setZero();
 
         // Add the sensor to the shared memory
         sharedHolder_->sensors_.push_back(this);
         ++sharedHolder_->num_;
+        sharedHolder_->resetBuffer(dataLast, timeLast);
 
         // Update the flag
         isAttached_ = true;
@@ -113,22 +111,19 @@ namespace jiminy
             return hresult_t::ERROR_GENERIC;
         }
 
-        // Remove associated col in the shared data buffers
+        /* Remove associated col in the shared data buffers.
+           Only the most recent data are preserved, since the layout depends on the number of sensors. */
+        matrixN_t dataLast = sharedHolder_->dataAt(sharedHolder_->size_ - 1);
+        float64_t const timeLast = sharedHolder_->timeAt(sharedHolder_->size_ - 1);
         if (sensorIdx_ < sharedHolder_->num_ - 1)
         {
             std::size_t const sensorShift = sharedHolder_->num_ - sensorIdx_ - 1;
-            for (matrixN_t & data : sharedHolder_->data_)
-            {
-                data.middleCols(sensorIdx_, sensorShift) =
-                    data.middleCols(sensorIdx_ + 1, sensorShift).eval();
-            }
+            dataLast.middleCols(sensorIdx_, sensorShift) =
+                dataLast.middleCols(sensorIdx_ + 1, sensorShift).eval();
             sharedHolder_->dataMeasured_.middleCols(sensorIdx_, sensorShift) =
                 sharedHolder_->dataMeasured_.middleCols(sensorIdx_ + 1, sensorShift).eval();
         }
-        for (matrixN_t & data : sharedHolder_->data_)
-        {
-            data.conservativeResize(Eigen::NoChange, sharedHolder_->num_ - 1);
-        }
+        dataLast.conservativeResize(Eigen::NoChange, sharedHolder_->num_ - 1);
         sharedHolder_->dataMeasured_.conservativeResize(Eigen::NoChange, sharedHolder_->num_ - 1);
 
         // Shift the sensor indices
@@ -142,6 +137,7 @@ namespace jiminy
         // Remove the sensor from the shared memory
         sharedHolder_->sensors_.erase(sharedHolder_->sensors_.begin() + sensorIdx_);
         --sharedHolder_->num_;
+        sharedHolder_->resetBuffer(dataLast, timeLast);
 
         // Clear the references to the robot and shared data
         robot_.reset();
@@ -176,10 +172,11 @@ namespace jiminy
             return hresult_t::ERROR_GENERIC;
         }
 
-        // Clear the shared data buffers
-        sharedHolder_->time_.assign(1, 0.0);
-        sharedHolder_->data_.resize(1);
-        sharedHolder_->data_[0].setZero();
+        // Clear the shared data buffers, keeping the memory already allocated
+        sharedHolder_->head_ = 0U;
+        sharedHolder_->size_ = 1U;
+        sharedHolder_->timeAt(0) = 0.0;
+        sharedHolder_->dataAt(0).setZero();
         sharedHolder_->dataMeasured_.setZero();
 
         // Compute max delay
@@ -285,83 +282,58 @@ namespace jiminy
     inline Eigen::Ref<vectorN_t> AbstractSensorTpl<T>::data(void)
     {
         // No guard, since this method is not public
-        return sharedHolder_->data_.back().col(sensorIdx_);
+        return sharedHolder_->dataAt(sharedHolder_->size_ - 1).col(sensorIdx_);
     }
 
     template<typename T>
     hresult_t AbstractSensorTpl<T>::interpolateData(void)
     {
-        assert(sharedHolder_->time_.size() > 0 && "Do data to interpolate.");
-
         // Sample the delay uniformly
-        float64_t const delay = baseSensorOptions_->delay + randUniform(0.0, baseSensorOptions_->jitter);
-
-        // Add STEPPER_MIN_TIMESTEP to timeDesired to avoid float comparison issues
-        float64_t const timeDesired = sharedHolder_->time_.back() - delay + STEPPER_MIN_TIMESTEP;
-
-        /* Determine the position of the closest right element.
-           Bisection method can be used since times are sorted. */
-        auto bisectLeft = [&](void) -> std::ptrdiff_t
+        float64_t delay = baseSensorOptions_->delay;
+        if (baseSensorOptions_->jitter > EPS)
         {
-            std::ptrdiff_t left = 0;
-            std::ptrdiff_t right = sharedHolder_->time_.size() - 1;
-            std::ptrdiff_t mid = 0;
+            delay += randUniform(robot_.lock()->generator_, 0.0, baseSensorOptions_->jitter);
+        }
 
-            if (timeDesired >= sharedHolder_->time_.back())
-            {
-                return right;
-            }
-            else if (timeDesired < sharedHolder_->time_.front())
-            {
-                return -1;
-            }
+        return interpolateDataRange(delay, sensorIdx_, 1U);
+    }
 
-            while (left < right)
-            {
-                mid = (left + right) / 2;
-                if (timeDesired < sharedHolder_->time_[mid])
-                {
-                    right = mid;
-                }
-                else if (timeDesired > sharedHolder_->time_[mid])
-                {
-                    left = mid + 1;
-                }
-                else
-                {
-                    return mid;
-                }
-            }
+    template<typename T>
+    hresult_t AbstractSensorTpl<T>::interpolateDataRange(float64_t   const & delay,
+                                                         std::size_t const & sensorIdx,
+                                                         std::size_t const & sensorNum)
+    {
+        SensorSharedDataHolder_t & holder = *sharedHolder_;
+        assert(holder.size_ > 0 && "Do data to interpolate.");
+        auto dataMeasured = holder.dataMeasured_.middleCols(sensorIdx, sensorNum);
 
-            if (timeDesired < sharedHolder_->time_[mid])
-            {
-                return mid - 1;
-            }
-            else
-            {
-                return mid;
-            }
-        };
+        // Add STEPPER_MIN_TIMESTEP to timeDesired to avoid float comparison issues
+        float64_t const timeDesired = holder.timeAt(holder.size_ - 1) - delay + STEPPER_MIN_TIMESTEP;
 
-        int64_t const idxLeft = bisectLeft();
-        if (timeDesired >= 0.0 && static_cast<std::size_t>(idxLeft + 1) < sharedHolder_->time_.size())
+        // Determine the position of the closest left element
+        std::ptrdiff_t const idxLeft = holder.bisectLeft(timeDesired);
+        if (timeDesired >= 0.0 && static_cast<std::size_t>(idxLeft + 1) < holder.size_)
         {
             if (idxLeft < 0)
             {
                 PRINT_ERROR("No data old enough is available.");
                 return hresult_t::ERROR_GENERIC;
             }
-            else if (baseSensorOptions_->delayInterpolationOrder == 0)
+
+            std::size_t const idx = static_cast<std::size_t>(idxLeft);
+            if (baseSensorOptions_->delayInterpolationOrder == 0)
             {
-                get() = sharedHolder_->data_[idxLeft].col(sensorIdx_);
+                dataMeasured = holder.dataAt(idx).middleCols(sensorIdx, sensorNum);
             }
             else if (baseSensorOptions_->delayInterpolationOrder == 1)
             {
                 // TODO: the linear interpolation is not valid for quaternion.
                 // `slerp` should be unsed instead...
-                get() = 1 / (sharedHolder_->time_[idxLeft + 1] - sharedHolder_->time_[idxLeft]) *
-                    ((timeDesired - sharedHolder_->time_[idxLeft]) * sharedHolder_->data_[idxLeft + 1].col(sensorIdx_) +
-                    (sharedHolder_->time_[idxLeft + 1] - timeDesired) * sharedHolder_->data_[idxLeft].col(sensorIdx_));
+                float64_t const & timeLeft = holder.timeAt(idx);
+                float64_t const & timeRight = holder.timeAt(idx + 1);
+                float64_t const ratio = (timeDesired - timeLeft) / (timeRight - timeLeft);
+                dataMeasured = ratio * holder.dataAt(idx + 1).middleCols(sensorIdx, sensorNum) +
+                    (1.0 - ratio) * holder.dataAt(idx).middleCols(sensorIdx, sensorNum);
             }
             else
             {
@@ -371,30 +343,21 @@ namespace jiminy
         }
         else
         {
+            std::size_t idx = holder.size_ - 1;
             if (baseSensorOptions_->delay > EPS || baseSensorOptions_->jitter > EPS)
             {
                 // Return the oldest value since the buffer is not fully initialized yet
-                auto it = std::find_if(sharedHolder_->time_.begin(), sharedHolder_->time_.end(),
-                                       [] (float64_t const & t)
-                                       {
-                                           return t > 0;
-                                       });
-                if (it != sharedHolder_->time_.end())
-                {
-                    std::ptrdiff_t idx = std::distance(sharedHolder_->time_.begin(), it);
-                    idx = std::max(std::ptrdiff_t(0), idx - 1);
-                    get() = sharedHolder_->data_[idx].col(sensorIdx_);
-                }
-                else
+                for (std::size_t i = 0; i < holder.size_; ++i)
                 {
-                    get() = sharedHolder_->data_.back().col(sensorIdx_);
+                    if (holder.timeAt(i) > 0)
+                    {
+                        idx = std::max(i, std::size_t(1)) - 1;
+                        break;
+                    }
                 }
             }
-            else
-            {
-                // Return the most recent value available
-                get() = sharedHolder_->data_.back().col(sensorIdx_);
-            }
+            // Otherwise, return the most recent value available
+            dataMeasured = holder.dataAt(idx).middleCols(sensorIdx, sensorNum);
         }
 
         return hresult_t::SUCCESS;
@@ -405,16 +368,40 @@ namespace jiminy
     {
         hresult_t returnCode = hresult_t::SUCCESS;
 
+        /* Compute the real value at current time, namely taking into account the sensor delay.
+           The data of all the sensors are interpolated at once if they share the same delay,
+           which is usually the case, otherwise they are interpolated one by one. */
+        bool_t isDelayShared = true;
         for (AbstractSensorBase * sensor : sharedHolder_->sensors_)
         {
-            // Compute the real value at current time, namely taking into account the sensor delay
-            if (returnCode == hresult_t::SUCCESS)
+            abstractSensorOptions_t const & sensorOptions = *sensor->baseSensorOptions_;
+            if (sensorOptions.jitter > EPS
+             || std::abs(sensorOptions.delay - baseSensorOptions_->delay) > EPS
+             || sensorOptions.delayInterpolationOrder != baseSensorOptions_->delayInterpolationOrder)
+            {
+                isDelayShared = false;
+                break;
+            }
+        }
+        if (isDelayShared)
+        {
+            returnCode = interpolateDataRange(baseSensorOptions_->delay, 0U, sharedHolder_->num_);
+        }
+        else
+        {
+            for (AbstractSensorBase * sensor : sharedHolder_->sensors_)
             {
-                returnCode = sensor->interpolateData();
+                if (returnCode == hresult_t::SUCCESS)
+                {
+                    returnCode = sensor->interpolateData();
+                }
             }
+        }
 
-            // Skew the data with white noise and bias
-            if (returnCode == hresult_t::SUCCESS)
+        // Skew the data with white noise and bias
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            for (AbstractSensorBase * sensor : sharedHolder_->sensors_)
             {
                 sensor->measureData();
             }
@@ -443,59 +430,38 @@ namespace jiminy
            is available to handle the case where the solver goes back in time.
            Even though it can make the buffer quite large irrelevantly since
            the actual maximum step is given by engineOptions_->stepper.dtMax,
-           it is not a big deal in practice since `rotate`, `pop_front`, and
-           `push_back` have O(1) complexity. */
-        float64_t const timeMin = t - sharedHolder_->delayMax_ - SIMULATION_MAX_TIMESTEP;
+           it is not a big deal in practice since the ring buffer is only
+           reallocated when full, which does not happen once it is large enough. */
+        SensorSharedDataHolder_t & holder = *sharedHolder_;
+        float64_t const timeMin = t - holder.delayMax_ - SIMULATION_MAX_TIMESTEP;
 
         // Internal buffer memory management
-        if (t + EPS > sharedHolder_->time_.back())
+        if (t + EPS > holder.timeAt(holder.size_ - 1))
         {
-            if (timeMin > sharedHolder_->time_.front())
+            // Remove the elements that are too old, except the most recent one before timeMin
+            while (holder.size_ > 1 && timeMin > holder.timeAt(1))
             {
-                // Remove some unecessary extra elements if appropriate
-                if (sharedHolder_->time_.size() > 1U + DELAY_MAX_BUFFER_EXCEED
-                && timeMin > sharedHolder_->time_[DELAY_MAX_BUFFER_EXCEED])
-                {
-                    sharedHolder_->time_.erase_begin(DELAY_MAX_BUFFER_EXCEED);
-                    sharedHolder_->data_.erase_begin(DELAY_MAX_BUFFER_EXCEED);
-                    sharedHolder_->time_.rset_capacity(sharedHolder_->time_.size() + DELAY_MIN_BUFFER_RESERVE);
-                    sharedHolder_->data_.rset_capacity(sharedHolder_->data_.size() + DELAY_MIN_BUFFER_RESERVE);
-                }
-
-                // Rotate the internal buffer
-                sharedHolder_->time_.rotate(sharedHolder_->time_.begin() + 1U);
-                sharedHolder_->data_.rotate(sharedHolder_->data_.begin() + 1U);
+                holder.popFront();
             }
-            else
-            {
-                // Increase capacity if required
-                if (sharedHolder_->time_.full())
-                {
-                    sharedHolder_->time_.rset_capacity(sharedHolder_->time_.size() + DELAY_MIN_BUFFER_RESERVE);
-                    sharedHolder_->data_.rset_capacity(sharedHolder_->data_.size() + DELAY_MIN_BUFFER_RESERVE);
-                }
 
-                /* Push back new buffer
-                   Note that it is a copy of the last value. This is important for
-                   `data()` to always provide the last true value instead of some
-                   initialized memory. The previous value is used for the quaternion
-                   of IMU sensors to choice the right value that ensures its continuity
-                   over time amond to two possible choices. */
-                sharedHolder_->time_.push_back(-1);
-                sharedHolder_->data_.push_back(sharedHolder_->data_.back());
-            }
+            /* Push back new buffer
+               Note that it is a copy of the last value. This is important for
+               `data()` to always provide the last true value instead of some
+               initialized memory. The previous value is used for the quaternion
+               of IMU sensors to choice the right value that ensures its continuity
+               over time amond to two possible choices. */
+            holder.pushBack(t);
         }
         else
         {
             /* Remove the extra last elements if for some reason the solver went back in time.
                It happens when an iteration fails using ode solvers relying on try_step mechanism. */
-            while (t + EPS < sharedHolder_->time_.back() && sharedHolder_->time_.size() > 1)
+            while (t + EPS < holder.timeAt(holder.size_ - 1) && holder.size_ > 1)
             {
-                sharedHolder_->time_.pop_back();
-                sharedHolder_->data_.pop_back();
+                holder.popBack();
             }
         }
-        sharedHolder_->time_.back() = t;
+        holder.timeAt(holder.size_ - 1) = t;
 
         // Update the last real data buffer
         for (AbstractSensorBase * sensor : sharedHolder_->sensors_)
@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// \brief      Dynamics algorithms specialized at compile-time for a given kinematic tree.
+///
+/// \details    The generic algorithms of pinocchio dispatch the computations of every joint at
+///             runtime, through a visitor over the variant of all the joint types. For a known
+///             topology, the type of every joint is fixed, so that the joint loops can be fully
+///             unrolled and the calls resolved statically, which enables inlining across joints.
+///             Such backends are generated at build time from a URDF file by the dedicated tool
+///             `jiminy_dynamics_codegen`, then registered when the library they belong to is
+///             loaded. Only the topology is hard-coded: the numerical parameters of the model
+///             (inertias, placements, rotor inertias...) are still read at runtime, so that they
+///             can be randomized or changed freely without invalidating the backend.
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef JIMINY_DYNAMICS_BACKEND_H
+#define JIMINY_DYNAMICS_BACKEND_H
+
+#include <memory>
+
+#include "pinocchio/multibody/fwd.hpp"  // `pinocchio::Model`, `pinocchio::Data`
+
+#include "jiminy/core/Macros.h"
+#include "jiminy/core/Types.h"
+
+
+namespace jiminy
+{
+    /// \brief Signature of the kinematic tree of a model, namely everything that is hard-coded
+    ///        in a specialized backend.
+    struct modelTopology_t
+    {
+        std::vector<std::string> jointsShortname;  ///< Short name of the type of each joint, without universe
+        std::vector<jointIndex_t> parents;         ///< Index of the parent of each joint, without universe
+        int32_t nq;
+        int32_t nv;
+
+        bool_t operator == (modelTopology_t const & other) const;
+    };
+
+    modelTopology_t getModelTopology(pinocchio::Model const & model);
+
+    class AbstractDynamicsBackend
+    {
+    public:
+        // Disable the copy of the class
+        AbstractDynamicsBackend(AbstractDynamicsBackend const & backend) = delete;
+        AbstractDynamicsBackend & operator = (AbstractDynamicsBackend const & other) = delete;
+
+    public:
+        AbstractDynamicsBackend(std::string     const & name,
+                                modelTopology_t const & topology);
+        virtual ~AbstractDynamicsBackend(void) = default;
+
+        std::string const & getName(void) const;
+        modelTopology_t const & getTopology(void) const;
+
+        /// \brief Whether the backend has been generated for the topology of a given model.
+        bool_t isCompatible(pinocchio::Model const & model) const;
+
+        /// \brief Same as `pinocchio::forwardKinematics`, updating the placement, velocity and
+        ///        acceleration of every joint.
+        virtual void forwardKinematics(pinocchio::Model const & model,
+                                       pinocchio::Data        & data,
+                                       vectorN_t        const & q,
+                                       vectorN_t        const & v,
+                                       vectorN_t        const & a) const = 0;
+
+        /// \brief Same as `pinocchio_overload::aba`, taking into account the rotor inertia.
+        virtual vectorN_t const & aba(pinocchio::Model const & model,
+                                      pinocchio::Data        & data,
+                                      vectorN_t        const & q,
+                                      vectorN_t        const & v,
+                                      vectorN_t        const & tau,
+                                      forceVector_t    const & fext) const = 0;
+
+        /// \brief Same as `pinocchio_overload::crba`, taking into account the rotor inertia.
+        ///
+        /// \details Only the upper triangular part of the mass matrix is filled.
+        virtual matrixN_t const & crba(pinocchio::Model const & model,
+                                       pinocchio::Data        & data,
+                                       vectorN_t        const & q) const = 0;
+
+    private:
+        std::string const name_;
+        modelTopology_t const topology_;
+    };
+
+    /// \brief Register a specialized backend, so that it is used automatically for every
+    ///        robot whose model has the same topology.
+    ///
+    /// \details It is meant to be called during the static initialization of the library
+    ///          defining the backend. The name of the backend must be unique.
+    hresult_t registerDynamicsBackend(std::shared_ptr<AbstractDynamicsBackend const> backend);
+
+    /// \brief Get the first registered backend compatible with a given model, if any.
+    std::shared_ptr<AbstractDynamicsBackend const> findDynamicsBackend(pinocchio::Model const & model);
+
+    /// \brief Get a registered backend by name, if any.
+    std::shared_ptr<AbstractDynamicsBackend const> findDynamicsBackend(std::string const & name);
+
+    std::vector<std::string> getDynamicsBackendNames(void);
+}
+
+#endif  // JIMINY_DYNAMICS_BACKEND_H
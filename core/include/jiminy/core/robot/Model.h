@@ -7,6 +7,7 @@
 #include "pinocchio/multibody/geometry.hpp"  // `pinocchio::GeometryModel`, `pinocchio::GeometryData`
 #include "pinocchio/multibody/frame.hpp"     // `pinocchio::FrameType` (C-style enum cannot be forward declared)
 
+#include "jiminy/core/utilities/Random.h"
 #include "jiminy/core/Macros.h"
 #include "jiminy/core/Types.h"
 
@@ -16,6 +17,7 @@ namespace jiminy
     class AbstractConstraintBase;
     class FixedFrameConstraint;
     class JointConstraint;
+    class AbstractDynamicsBackend;
 
     using constraintsMap_t = static_map_t<std::string, std::shared_ptr<AbstractConstraintBase> >;
 
@@ -146,6 +148,7 @@ namespace jiminy
             config["relativePositionBodiesBiasStd"] = 0.0;
             config["enableFlexibleModel"] = true;
             config["flexibilityConfig"] = flexibilityConfig_t();
+            config["enableDynamicsBackend"] = true;
 
             return config;
         };
@@ -200,6 +203,7 @@ namespace jiminy
             float64_t           const relativePositionBodiesBiasStd;
             bool_t              const enableFlexibleModel;
             flexibilityConfig_t const flexibilityConfig;
+            bool_t              const enableDynamicsBackend;  ///< Use the specialized dynamics backend compatible with the model, if any
 
             dynamicsOptions_t(configHolder_t const & options) :
             inertiaBodiesBiasStd(boost::get<float64_t>(options.at("inertiaBodiesBiasStd"))),
@@ -207,7 +211,8 @@ namespace jiminy
             centerOfMassPositionBodiesBiasStd(boost::get<float64_t>(options.at("centerOfMassPositionBodiesBiasStd"))),
             relativePositionBodiesBiasStd(boost::get<float64_t>(options.at("relativePositionBodiesBiasStd"))),
             enableFlexibleModel(boost::get<bool_t>(options.at("enableFlexibleModel"))),
-            flexibilityConfig(boost::get<flexibilityConfig_t>(options.at("flexibilityConfig")))
+            flexibilityConfig(boost::get<flexibilityConfig_t>(options.at("flexibilityConfig"))),
+            enableDynamicsBackend(boost::get<bool_t>(options.at("enableDynamicsBackend")))
             {
                 // Empty on purpose
             }
@@ -352,6 +357,17 @@ namespace jiminy
         std::vector<std::string> const & getLogFieldnamesAcceleration(void) const;
         std::vector<std::string> const & getLogFieldnamesForceExternal(void) const;
 
+        /// \brief Force the specialized dynamics backend to use, instead of the first registered
+        ///        one compatible with the model. An empty pointer restores the automatic selection.
+        ///
+        /// \details It must be compatible with the current model. It is ignored if the option
+        ///          'enableDynamicsBackend' is disabled, or if the model is no longer compatible
+        ///          after being regenerated, e.g. because some flexibilities have been added.
+        hresult_t setDynamicsBackend(std::shared_ptr<AbstractDynamicsBackend const> backend);
+
+        /// \brief Specialized dynamics backend compatible with the current model, if any.
+        std::shared_ptr<AbstractDynamicsBackend const> const & getDynamicsBackend(void) const;
+
         hresult_t getFlexibleConfigurationFromRigid(vectorN_t const & qRigid,
                                                     vectorN_t       & qFlex) const;
         hresult_t getRigidConfigurationFromFlexible(vectorN_t const & qFlex,
@@ -364,6 +380,10 @@ namespace jiminy
     protected:
         hresult_t generateModelFlexible(void);
         hresult_t generateModelBiased(void);
+        /// \brief Draw new biases for the dynamics properties of the current model, in place.
+        /// \details The topology of the model is assumed unchanged since the last call to
+        ///          `generateModelBiased`, so that neither the data nor the proxies are updated.
+        void updateModelBiased(void);
 
         hresult_t addFrame(std::string          const & frameName,
                            std::string          const & parentBodyName,
@@ -385,6 +405,8 @@ namespace jiminy
         hresult_t refreshContactsProxies(void);
         /// \brief Refresh the proxies of the kinematics constraints.
         hresult_t refreshConstraintsProxies(void);
+        /// \brief Select the specialized dynamics backend compatible with the current model, if any.
+        void refreshDynamicsBackend(void);
         virtual hresult_t refreshProxies(void);
 
     public:
@@ -400,6 +422,7 @@ namespace jiminy
         mutable pinocchio::GeometryData visualData_;
         std::unique_ptr<modelOptions_t const> mdlOptions_;
         forceVector_t contactForces_;                       ///< Buffer storing the contact forces
+        mutable PhiloxGenerator generator_;                 ///< Random number generator of the model and its sensors. The engine assigns it an independent stream.
 
     protected:
         bool_t isInitialized_;
@@ -432,13 +455,24 @@ namespace jiminy
         std::vector<std::string> logFieldnamesAcceleration_;   ///< Fieldnames of the elements in the acceleration vector of the model
         std::vector<std::string> logFieldnamesForceExternal_;  ///< Concatenated fieldnames of the external force applied at each joint of the model, 'universe' excluded
 
+        std::shared_ptr<AbstractDynamicsBackend const> dynamicsBackend_;        ///< Specialized dynamics backend in use, if any
+        std::shared_ptr<AbstractDynamicsBackend const> dynamicsBackendForced_;  ///< Backend forced by the user, if any
+
+    private:
+        void applyModelBiases(void);
+
     private:
         pinocchio::Model pncModelFlexibleOrig_;
         motionVector_t jointsAcceleration_;      ///< Vector of joints acceleration corresponding to a copy of data.a - temporary buffer for computing constraints.
+        vectorN_t qNeutral_;                     ///< Neutral configuration of the current model - buffer avoiding memory allocation when drawing new biases
+        vectorN_t vZero_;                        ///< Zero velocity of the current model - buffer avoiding memory allocation when drawing new biases
 
         int32_t nq_;
         int32_t nv_;
         int32_t nx_;
+
+        pinocchio::Model pncModelOrigBackup_;    ///< Original rigid model from which the current model has been generated, to detect changes made by the user
+        bool_t areModelsInvalid_;                ///< Whether the models must be regenerated from scratch at next reset
     };
 }
 
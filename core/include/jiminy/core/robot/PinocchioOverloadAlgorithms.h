@@ -220,7 +220,7 @@ namespace pinocchio_overload
                  Eigen::MatrixBase<Matrix6Like> & Ia,
                  bool const & update_I)
         {
-            static Eigen::Matrix<Scalar, 3, 3> StU;
+            static thread_local Eigen::Matrix<Scalar, 3, 3> StU;
 
             data.U.template leftCols<2>() = Ia.template leftCols<2>();
             data.U.template rightCols<1>() = Ia.template rightCols<1>();
@@ -245,7 +245,7 @@ namespace pinocchio_overload
                  Eigen::MatrixBase<Matrix6Like> & Ia,
                  bool const & update_I)
         {
-            static Eigen::Matrix<Scalar, 3, 3> StU;
+            static thread_local Eigen::Matrix<Scalar, 3, 3> StU;
 
             using Inertia = pinocchio::Inertia;
 
@@ -270,7 +270,7 @@ namespace pinocchio_overload
                  Eigen::MatrixBase<Matrix6Like> & Ia,
                  bool const & update_I)
         {
-            static Eigen::Matrix<Scalar, 3, 3> StU;
+            static thread_local Eigen::Matrix<Scalar, 3, 3> StU;
 
             using Inertia = pinocchio::Inertia;
 
@@ -295,7 +295,7 @@ namespace pinocchio_overload
                  Eigen::MatrixBase<Matrix6Like> & Ia,
                  bool const & update_I)
         {
-            static Eigen::Matrix<Scalar, 3, 3> StU;
+            static thread_local Eigen::Matrix<Scalar, 3, 3> StU;
 
             using Inertia = pinocchio::Inertia;
 
@@ -320,7 +320,7 @@ namespace pinocchio_overload
                  Eigen::MatrixBase<Matrix6Like> & Ia,
                  bool const & update_I)
         {
-            static Eigen::Matrix<Scalar, 6, 6> StU;
+            static thread_local Eigen::Matrix<Scalar, 6, 6> StU;
 
             data.U = Ia;
             StU = Ia;
@@ -343,7 +343,7 @@ namespace pinocchio_overload
                  Eigen::MatrixBase<Matrix6Like> & Ia,
                  bool const & update_I)
         {
-            static Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> StU;
+            static thread_local Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> StU;
 
             data.U.noalias() = Ia * data.S.matrix();
             StU.noalias() = data.S.matrix().transpose() * data.U;
@@ -479,6 +479,58 @@ namespace pinocchio_overload
         }
     }
 
+    template<typename TangentVectorType>
+    struct ComputeGeneralizedForcesBackwardStep :
+    public pinocchio::fusion::JointUnaryVisitorBase<ComputeGeneralizedForcesBackwardStep<TangentVectorType> >
+    {
+        typedef boost::fusion::vector<pinocchio::Model const &,
+                                      pinocchio::Data &,
+                                      Eigen::MatrixBase<TangentVectorType> &
+                                      > ArgsType;
+
+        template<typename JointModel>
+        static void algo(pinocchio::JointModelBase<JointModel> const & jmodel,
+                         pinocchio::JointDataBase<typename JointModel::JointDataDerived> & jdata,
+                         pinocchio::Model const & model,
+                         pinocchio::Data & data,
+                         Eigen::MatrixBase<TangentVectorType> & tau)
+        {
+            jointIndex_t const & i = jmodel.id();
+            jointIndex_t const & parent = model.parents[i];
+            jmodel.jointVelocitySelector(tau.derived()) += jdata.S().transpose() * data.f[i];
+            if (parent > 0)
+            {
+                data.f[parent] += data.liMi[i].act(data.f[i]);
+            }
+        }
+    };
+
+    /// \brief Accumulate external forces into generalized efforts, ie compute
+    /// tau += sum_i J_i^T fext_i in O(nv) instead of O(njoints * nv).
+    ///
+    /// The external forces are expressed in the local frame of their parent joint, like
+    /// for `aba`. It assumes that the joints placements are already up-to-date. Note that
+    /// `data.f` is used as internal buffer, so its content is overwritten.
+    template<typename TangentVectorType, typename ForceDerived>
+    inline void computeGeneralizedForces(pinocchio::Model                     const & model,
+                                         pinocchio::Data                            & data,
+                                         vector_aligned_t<ForceDerived>       const & fext,
+                                         Eigen::MatrixBase<TangentVectorType>       & tau)
+    {
+        assert(tau.size() == model.nv && "The generalized effort vector is not of right size");
+
+        for (int32_t i = 1; i < model.njoints; ++i)
+        {
+            data.f[i] = fext[i];
+        }
+
+        typedef ComputeGeneralizedForcesBackwardStep<TangentVectorType> Pass;
+        for (int32_t i = model.njoints - 1; i > 0; --i)
+        {
+            Pass::run(model.joints[i], data.joints[i], typename Pass::ArgsType(model, data, tau));
+        }
+    }
+
     template<typename JacobianType>
     hresult_t computeJMinvJt(pinocchio::Model const & model,
                              pinocchio::Data & data,
@@ -501,7 +553,7 @@ namespace pinocchio_overload
         /* Compute sDUiJt := sqrt(D)^-1 * U^-1 * J.T
            - Use row-major for sDUiJt and U to enable vectorization
            - Implement custom cholesky::Uiv to compute all columns at once (faster SIMD)
-           - TODO: Leverage sparsity of J when multiplying by sqrt(D)^-1 */
+           - See the overload below to leverage the sparsity of J */
         Eigen::Matrix<float64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> sDUiJt = J.transpose();
         Eigen::Matrix<float64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> U = data.U;
         std::vector<int> const & nvt = data.nvSubtree_fromRow;
@@ -512,12 +564,7 @@ namespace pinocchio_overload
         }
         sDUiJt.array().colwise() *= data.Dinv.array().sqrt();
 
-        /* Compute JMinvJt := sDUiJt.T * sDUiJt
-           - TODO: Leverage sparsity of J which propagates through sDUiJt.
-             Reference: Exploiting Sparsity in Operational-Space Dynamics
-             (Figure 10 of http://royfeatherstone.org/papers/sparseOSIM.pdf).
-             Each constraint should provide a std::vector of slice
-             std::pair<start, dim> corresponding to all dependency blocks. */
+        // Compute JMinvJt := sDUiJt.T * sDUiJt
         data.JMinvJt.resize(J.rows(), J.rows());
         data.JMinvJt.triangularView<Eigen::Lower>().setZero();
         data.JMinvJt.selfadjointView<Eigen::Lower>().rankUpdate(sDUiJt.transpose());
@@ -525,6 +572,115 @@ namespace pinocchio_overload
         return hresult_t::SUCCESS;
     }
 
+    /// \brief Sparsity pattern of a block of consecutive rows of a jacobian matrix.
+    struct JacobianBlock
+    {
+        Eigen::Index startRow;
+        Eigen::Index dim;
+        std::vector<Eigen::Index> const * colsIdx;  ///< Sorted indices of the columns that may be non-zero
+    };
+
+    /// \brief Compute JMinvJt, exploiting the sparsity of the jacobian.
+    ///
+    /// \details The sparsity of J propagates through sDUiJt := sqrt(D)^-1 * U^-1 * J.T, since the
+    ///          row of U associated with a given dof only involves the dofs of its subtree. As a
+    ///          result, U^-1 spreads each column to all its supporting dofs, and each block of
+    ///          sDUiJt has the same support as the corresponding block of J as long as it is closed
+    ///          under the supporting dofs. The block (i, j) of JMinvJt then only involves the
+    ///          intersection of both supports, which usually boils down to the root joint for
+    ///          contacts on different limbs.
+    ///
+    ///          Reference: Exploiting Sparsity in Operational-Space Dynamics
+    ///          (Figure 10 of http://royfeatherstone.org/papers/sparseOSIM.pdf).
+    ///
+    /// \remark Only the lower triangular part of JMinvJt is computed. The coefficients of J
+    ///         outside the blocks support are never read. The support of each block must include
+    ///         all the supporting dofs of its columns, otherwise the result is wrong.
+    template<typename JacobianType>
+    hresult_t computeJMinvJt(pinocchio::Model const & model,
+                             pinocchio::Data & data,
+                             Eigen::MatrixBase<JacobianType> const & J,
+                             std::vector<JacobianBlock> const & blocks,
+                             bool_t const & updateDecomposition = true)
+    {
+        // Compute the Cholesky decomposition of mass matrix M if requested
+        if (updateDecomposition)
+        {
+            pinocchio::cholesky::decompose(model, data);
+        }
+
+        // Make sure the decomposition of the mass matrix is valid
+        if ((data.Dinv.array() < 0.0).any())
+        {
+            PRINT_ERROR("The inertia matrix is not strictly positive definite.");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+
+        /* Compute sDUiJt := sqrt(D)^-1 * U^-1 * J.T block by block, only over their support.
+           Row-major storage enables vectorization since all the rows of a block are
+           processed at once. */
+        static thread_local Eigen::Matrix<float64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> sDUiJt;
+        sDUiJt.resize(model.nv, J.rows());
+        std::vector<int> const & nvt = data.nvSubtree_fromRow;
+        for (JacobianBlock const & block : blocks)
+        {
+            Eigen::Index const & r = block.startRow;
+            Eigen::Index const & n = block.dim;
+            std::vector<Eigen::Index> const & colsIdx = *block.colsIdx;
+            for (auto kIt = colsIdx.rbegin(); kIt != colsIdx.rend(); ++kIt)
+            {
+                Eigen::Index const & k = *kIt;
+                auto sDUiJt_k = sDUiJt.row(k).segment(r, n);
+                sDUiJt_k = J.col(k).segment(r, n).transpose();
+                Eigen::Index const kEnd = k + nvt[static_cast<std::size_t>(k)];
+                for (auto jIt = kIt.base(); jIt != colsIdx.end() && *jIt < kEnd; ++jIt)
+                {
+                    sDUiJt_k -= data.U(k, *jIt) * sDUiJt.row(*jIt).segment(r, n);
+                }
+            }
+            for (Eigen::Index const & k : colsIdx)
+            {
+                sDUiJt.row(k).segment(r, n) *= std::sqrt(data.Dinv[k]);
+            }
+        }
+
+        /* Compute JMinvJt := sDUiJt.T * sDUiJt block by block, only over the
+           intersection of the supports. */
+        data.JMinvJt.resize(J.rows(), J.rows());
+        for (auto blockIt1 = blocks.begin(); blockIt1 != blocks.end(); ++blockIt1)
+        {
+            for (auto blockIt2 = blocks.begin(); blockIt2 != std::next(blockIt1); ++blockIt2)
+            {
+                auto JMinvJt_12 = data.JMinvJt.block(
+                    blockIt1->startRow, blockIt2->startRow, blockIt1->dim, blockIt2->dim);
+                JMinvJt_12.setZero();
+                auto colIt1 = blockIt1->colsIdx->begin();
+                auto colIt2 = blockIt2->colsIdx->begin();
+                while (colIt1 != blockIt1->colsIdx->end() && colIt2 != blockIt2->colsIdx->end())
+                {
+                    if (*colIt1 < *colIt2)
+                    {
+                        ++colIt1;
+                    }
+                    else if (*colIt2 < *colIt1)
+                    {
+                        ++colIt2;
+                    }
+                    else
+                    {
+                        JMinvJt_12.noalias() +=
+                            sDUiJt.row(*colIt1).segment(blockIt1->startRow, blockIt1->dim).transpose() *
+                            sDUiJt.row(*colIt1).segment(blockIt2->startRow, blockIt2->dim);
+                        ++colIt1;
+                        ++colIt2;
+                    }
+                }
+            }
+        }
+
+        return hresult_t::SUCCESS;
+    }
+
     template<typename RhsType>
     inline auto solveJMinvJtv(pinocchio::Data & data,
                               Eigen::MatrixBase<RhsType> const & v,
@@ -14,6 +14,7 @@ namespace jiminy
     class TelemetryData;
     class MutexLocal;
     class LockGuardLocal;
+    class StateArchive;
 
     class Robot : public Model
     {
@@ -119,6 +120,13 @@ namespace jiminy
         void updateTelemetry(void);
         bool_t const & getIsTelemetryConfigured(void) const;
 
+        /// \brief Save or restore the internal state of the robot that evolves during a simulation.
+        ///
+        /// \details It includes the efforts of the motors, the current and past data of the sensors,
+        ///          and the random number generator used for the noise. The kinematics is not part of
+        ///          it, since it is computed from the state of the system.
+        void processState(StateArchive & archive);
+
         std::vector<std::string> const & getMotorsNames(void) const;
         std::vector<jointIndex_t> getMotorsModelIdx(void) const;
         std::vector<std::vector<int32_t> > getMotorsPositionIdx(void) const;
@@ -1,14 +1,25 @@
 #ifndef JIMINY_LCP_SOLVERS_H
 #define JIMINY_LCP_SOLVERS_H
 
+#include "jiminy/core/robot/PinocchioOverloadAlgorithms.h"
 #include "jiminy/core/Types.h"
 
 
 namespace jiminy
 {
     class AbstractConstraintBase;
+    class StateArchive;
     struct constraintsHolder_t;
 
+    /// \brief Mode of a constraint at the end of the last solve. For bounded constraints that
+    ///        are not contacts, such as joint bounds, sticking simply means active.
+    enum class contactMode_t : uint8_t
+    {
+        SEPARATED = 0,
+        STICKING = 1,
+        SLIDING = 2
+    };
+
     struct ConstraintBlock
     {
         float64_t lo;
@@ -33,14 +44,27 @@ namespace jiminy
         Eigen::Index dim;
         ConstraintBlock blocks[3];
         std::uint_fast8_t nBlocks;
+        std::vector<Eigen::Index> colsIdx;  ///< Sorted indices of the columns of the jacobian that may be non-zero
+        contactMode_t mode;                 ///< Mode of the constraint at the end of the last solve
+        bool_t isSkipped;                   ///< Whether the constraint is assumed to remain separated
     };
 
     class AbstractConstraintSolver
     {
     public:
-        AbstractConstraintSolver(void) = default;
+        AbstractConstraintSolver(void) :
+        iterNum_(0U)
+        {
+            // Empty on purpose
+        }
         virtual ~AbstractConstraintSolver(void) = default;
 
+        /// \brief Number of iterations of the last solve. It is zero for direct methods.
+        uint32_t const & getIterNum(void) const
+        {
+            return iterNum_;
+        }
+
         /// \brief Compute the solution of the Nonlinear Complementary Problem:
         ///        A x + b = w,
         ///        s.t. (w[i] > 0 and x[i] = 0) or (w[i] = 0 and x[i] > 0
@@ -51,38 +75,57 @@ namespace jiminy
         ///
         virtual bool_t SolveBoxedForwardDynamics(float64_t const & inv_damping,
                                                  bool_t const & ignoreBounds) = 0;
+
+        /// \brief Save, check or restore the internal state of the solver, ie everything
+        ///        carried over from one solve to the next, such as the warm-start data.
+        virtual void processState(StateArchive & archive);
+
+    protected:
+        uint32_t iterNum_;
     };
 
-    class PGSSolver : public AbstractConstraintSolver
+    /// \brief Base class of the solvers relying on the operational-space inertia matrix A =
+    ///        J.Minv.Jt of the constraints. It takes care of assembling the problem and
+    ///        computing the resulting acceleration, only the boxed LCP itself is solver-specific.
+    class AbstractBoxedConstraintSolver : public AbstractConstraintSolver
     {
     public:
         // Disable the copy of the class
-        PGSSolver(PGSSolver const & solver) = delete;
-        PGSSolver & operator = (PGSSolver const & solver) = delete;
+        AbstractBoxedConstraintSolver(AbstractBoxedConstraintSolver const & solver) = delete;
+        AbstractBoxedConstraintSolver & operator = (AbstractBoxedConstraintSolver const & solver) = delete;
 
     public:
-        PGSSolver(pinocchio::Model const * model,
-                  pinocchio::Data * data,
-                  constraintsHolder_t * constraintsHolder,
-                  float64_t const & friction,
-                  float64_t const & torsion,
-                  float64_t const & tolAbs,
-                  float64_t const & tolRel,
-                  uint32_t const & maxIter);
-        virtual ~PGSSolver(void) = default;
+        AbstractBoxedConstraintSolver(pinocchio::Model const * model,
+                                      pinocchio::Data * data,
+                                      constraintsHolder_t * constraintsHolder,
+                                      float64_t const & friction,
+                                      float64_t const & torsion,
+                                      float64_t const & tolAbs,
+                                      float64_t const & tolRel,
+                                      uint32_t const & maxIter);
+        virtual ~AbstractBoxedConstraintSolver(void) = default;
 
         virtual bool_t SolveBoxedForwardDynamics(float64_t const & inv_damping,
                                                  bool_t const & ignoreBounds = false) override final;
 
-    private:
-        void ProjectedGaussSeidelIter(matrixN_t const & A,
-                                      vectorN_t::SegmentReturnType const & b,
-                                      vectorN_t::SegmentReturnType & x);
-        bool_t ProjectedGaussSeidelSolver(matrixN_t const & A,
-                                          vectorN_t::SegmentReturnType const & b,
-                                          vectorN_t::SegmentReturnType & x);
+        virtual void processState(StateArchive & archive) override;
+
+    protected:
+        /// \brief Solve the boxed LCP associated with the active constraints.
+        ///
+        /// \param[in] A Full symmetric operational-space inertia matrix, including regularization.
+        /// \param[in] b Right-hand side of the LCP.
+        /// \param[in, out] x Multipliers, initialized with the solution of the last solve.
+        ///
+        /// \return Whether the solver converged.
+        virtual bool_t SolveBoxedLCP(matrixN_t const & A,
+                                     vectorN_t::SegmentReturnType const & b,
+                                     vectorN_t::SegmentReturnType & x) = 0;
 
     private:
+        void updateContactModes(vectorN_t::SegmentReturnType const & x);
+
+    protected:
         pinocchio::Model const * model_;
         pinocchio::Data * data_;
 
@@ -94,10 +137,108 @@ namespace jiminy
         vectorN_t gamma_;   ///< Vector holding the drift of the constraints
         vectorN_t lambda_;  ///< Vector holding the multipliers of the constraints
         std::vector<ConstraintData> constraintsData_;
+        std::vector<pinocchio_overload::JacobianBlock> jacobianBlocks_;  ///< Sparsity pattern of the jacobian of the active constraints
 
         vectorN_t b_;
+    };
+
+    class PGSSolver : public AbstractBoxedConstraintSolver
+    {
+    public:
+        PGSSolver(pinocchio::Model const * model,
+                  pinocchio::Data * data,
+                  constraintsHolder_t * constraintsHolder,
+                  float64_t const & friction,
+                  float64_t const & torsion,
+                  float64_t const & tolAbs,
+                  float64_t const & tolRel,
+                  uint32_t const & maxIter);
+        virtual ~PGSSolver(void) = default;
+
+    protected:
+        virtual bool_t SolveBoxedLCP(matrixN_t const & A,
+                                     vectorN_t::SegmentReturnType const & b,
+                                     vectorN_t::SegmentReturnType & x) override;
+
+        /// \brief Perform a single Gauss-Seidel sweep over the constraints that are neither
+        ///        inactive nor skipped.
+        ///
+        /// \return Largest absolute variation of the multipliers, along with the largest
+        ///         absolute value of the multipliers.
+        virtual std::pair<float64_t, float64_t> ProjectedGaussSeidelIter(matrixN_t const & A,
+                                                                         vectorN_t::SegmentReturnType const & b,
+                                                                         vectorN_t::SegmentReturnType & x);
+
+    protected:
         vectorN_t y_;
-        vectorN_t yPrev_;
+    };
+
+    /// \brief Projected Gauss-Seidel updating the normal and tangential multipliers of each
+    ///        contact at once, by inverting the 3x3 diagonal block of A associated with them.
+    ///        The other constraints are updated one coefficient at a time as usual.
+    class BlockPGSSolver : public PGSSolver
+    {
+    public:
+        BlockPGSSolver(pinocchio::Model const * model,
+                       pinocchio::Data * data,
+                       constraintsHolder_t * constraintsHolder,
+                       float64_t const & friction,
+                       float64_t const & torsion,
+                       float64_t const & tolAbs,
+                       float64_t const & tolRel,
+                       uint32_t const & maxIter);
+        virtual ~BlockPGSSolver(void) = default;
+
+        virtual void processState(StateArchive & archive) override final;
+
+    protected:
+        virtual bool_t SolveBoxedLCP(matrixN_t const & A,
+                                     vectorN_t::SegmentReturnType const & b,
+                                     vectorN_t::SegmentReturnType & x) override final;
+        virtual std::pair<float64_t, float64_t> ProjectedGaussSeidelIter(matrixN_t const & A,
+                                                                         vectorN_t::SegmentReturnType const & b,
+                                                                         vectorN_t::SegmentReturnType & x) override final;
+
+    private:
+        std::vector<matrix3_t> contactBlocksInv_;  ///< Inverse of the 3x3 diagonal block of A of each constraint
+    };
+
+    /// \brief Alternating Direction Method of Multipliers, splitting the unconstrained
+    ///        quadratic problem from the projection on the friction cones and bounds.
+    ///
+    /// \details The Cholesky decomposition of A + rho * I is computed once per solve, then
+    ///          reused at every iteration. Contrary to PGS, the cost of an iteration does not
+    ///          depend on the coupling between constraints.
+    class ADMMSolver : public AbstractBoxedConstraintSolver
+    {
+    public:
+        ADMMSolver(pinocchio::Model const * model,
+                   pinocchio::Data * data,
+                   constraintsHolder_t * constraintsHolder,
+                   float64_t const & friction,
+                   float64_t const & torsion,
+                   float64_t const & tolAbs,
+                   float64_t const & tolRel,
+                   uint32_t const & maxIter);
+        virtual ~ADMMSolver(void) = default;
+
+        virtual void processState(StateArchive & archive) override final;
+
+    protected:
+        virtual bool_t SolveBoxedLCP(matrixN_t const & A,
+                                     vectorN_t::SegmentReturnType const & b,
+                                     vectorN_t::SegmentReturnType & x) override final;
+
+    private:
+        /// \brief Project the multipliers on the bounds and friction cones.
+        void project(vectorN_t::SegmentReturnType & z);
+
+    private:
+        matrixN_t H_;       ///< Operational-space inertia matrix shifted by the penalty parameter
+        Eigen::LLT<matrixN_t> llt_;
+        vectorN_t z_;       ///< Projected multipliers
+        vectorN_t zPrev_;   ///< Projected multipliers at previous iteration
+        vectorN_t u_;       ///< Scaled dual variables
     };
 }
 
@@ -54,6 +54,9 @@ namespace jiminy
             stateDerivative_t stateIncrement_;   ///< Internal buffer storing intermediary computation of state increment.
             state_t stateBuffer_;                ///< Internal buffer storing intermediary state during knots computations.
             state_t candidateSolution_;          ///< Internal buffer storing the candidate solution (i.e. before knowing if the step is successful).
+            state_t stepInitialState_;           ///< Starting state of the last successful step, only stored if dense output is supported.
+            float64_t stepInitialTime_;          ///< Starting time of the last successful step.
+            float64_t stepDuration_;             ///< Duration of the last successful step, zero if none.
 
     };
 }
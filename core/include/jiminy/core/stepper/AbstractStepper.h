@@ -42,37 +42,55 @@ namespace jiminy
         ///          if an integration step was successful or not. On success, the value of the state is
         ///          updated in place. Regardless of success or failure, the parameter dt can be updated
         ///          by variable step schemes to indicate the next advised dt.
+        ///          The state is integrated directly in the storage of the caller, so that no copy is
+        ///          involved, and the stepper does not allocate memory once constructed.
         ///
-        /// \param[in, out] q   System starting position.
-        /// \param[in, out] v   System starting velocity.
-        /// \param[in, out] a   System starting acceleration.
-        /// \param[in, out] t   Integration start time.
-        /// \param[in, out] dt  Input: desired integration duration. Output: recommended step size for
-        ///                     variable-step schemes. Constant-step schemes leave this value unmodified.
-        /// \return True if integration was successful, false otherwise. In that case, (q, v, a) are not updated.
-        bool_t tryStep(std::vector<vectorN_t> & q,
-                       std::vector<vectorN_t> & v,
-                       std::vector<vectorN_t> & a,
-                       float64_t              & t,
-                       float64_t              & dt);
+        /// \param[in, out] state            System starting position and velocity.
+        /// \param[in, out] stateDerivative  System starting velocity and acceleration. Its velocity must
+        ///                                  match the one of the state.
+        /// \param[in, out] t                Integration start time.
+        /// \param[in, out] dt               Input: desired integration duration. Output: recommended step size
+        ///                                  for variable-step schemes. Constant-step schemes leave this value
+        ///                                  unmodified.
+        /// \return True if integration was successful, false otherwise. In that case, the state is not updated,
+        ///         unless dt is NaN, which means that the integration diverged and must be aborted.
+        bool_t tryStep(state_t           & state,
+                       stateDerivative_t & stateDerivative,
+                       float64_t         & t,
+                       float64_t         & dt);
+
+        /// \brief Whether the stepper provides a continuous extension of its last successful step.
+        virtual bool_t hasDenseOutput(void) const;
+
+        /// \brief Evaluate the state and its derivative at any time within the last successful step.
+        /// \details It relies on the continuous extension of the integration scheme, so that the dynamics
+        ///          is not evaluated. It is only valid until the next call to `tryStep`.
+        ///
+        /// \param[in] t                 Time at which to evaluate the state.
+        /// \param[out] state            Interpolated position and velocity. It must be pre-allocated.
+        /// \param[out] stateDerivative  Interpolated velocity and acceleration. It must be pre-allocated.
+        /// \return False if dense output is not supported or t is outside the last successful step.
+        virtual bool_t computeDenseOutput(float64_t         const & t,
+                                          state_t                 & state,
+                                          stateDerivative_t       & stateDerivative);
 
     protected:
-        /// \brief Internal tryStep method wrapping the arguments as state_t and stateDerivative_t.
+        /// \brief Internal tryStep method, updating the state and its derivative in place on success only.
         virtual bool_t tryStepImpl(state_t                 & state,
                                    stateDerivative_t       & stateDerivative,
                                    float64_t         const & t,
                                    float64_t               & dt) = 0;
 
         /// \brief Wrapper around the system dynamics: stateDerivative = f(t, state)
-        stateDerivative_t const & f(float64_t const & t,
-                                    state_t   const & state);
+        ///
+        /// \details The state derivative is computed in place to avoid any copy.
+        void f(float64_t         const & t,
+               state_t           const & state,
+               stateDerivative_t       & stateDerivative);
 
     private:
         systemDynamics f_;                   ///< Dynamics to integrate.
         std::vector<Robot const *> robots_;  ///< Robots on which to perform integration.
-        state_t state_;                      ///< State derivative computation buffer.
-        stateDerivative_t stateDerivative_;  ///< State derivative computation buffer.
-        stateDerivative_t fOutput_;          ///< State derivative computation buffer.
     };
 }
 
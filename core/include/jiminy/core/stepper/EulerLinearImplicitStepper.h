@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// \brief      Implements a fixed-step linearly-implicit Euler first-order scheme.
+/// \details    This Rosenbrock-type scheme linearizes the stiff efforts, namely the flexible
+///             joints and the spring-damper contacts, around the current state to integrate
+///             them implicitly, while the other efforts are integrated explicitly. Denoting M
+///             the mass matrix, K and D the joint-space stiffness and damping of the stiff
+///             efforts, the velocity increment is the solution of
+///                 (M + dt D + dt^2 K) dv = dt (M a - dt K v),
+///             then the configuration is integrated on the Lie group using v + dv.
+///             The linearization does not need to be exact (W-method): it only affects the
+///             stability of the scheme, not its consistency.
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef JIMINY_LINEAR_IMPLICIT_EULER_STEPPER_H
+#define JIMINY_LINEAR_IMPLICIT_EULER_STEPPER_H
+
+#include "jiminy/core/stepper/AbstractStepper.h"
+
+namespace jiminy
+{
+    using systemLinearization = std::function<void(float64_t              const & /*t*/,
+                                                   std::vector<vectorN_t> const & /*qSplit*/,
+                                                   std::vector<vectorN_t> const & /*vSplit*/,
+                                                   std::vector<matrixN_t>       & /*massSplit*/,
+                                                   std::vector<matrixN_t>       & /*stiffnessSplit*/,
+                                                   std::vector<matrixN_t>       & /*dampingSplit*/)>;
+
+    class EulerLinearImplicitStepper: public AbstractStepper
+    {
+        public:
+            /// \brief Constructor
+            /// \param[in] f      Dynamics function, with signature a = f(t, q, v)
+            /// \param[in] g      Linearization of the stiff efforts, with signature (M, K, D) = g(t, q, v).
+            ///                   Only the upper triangular part of the mass matrix M is used.
+            /// \param[in] robots Robots whose dynamics the stepper will work on.
+            EulerLinearImplicitStepper(systemDynamics const & f,
+                                       systemLinearization const & g,
+                                       std::vector<Robot const *> const & robots);
+
+        protected:
+            /// \brief Internal tryStep method wrapping the arguments as state_t and stateDerivative_t.
+            bool_t tryStepImpl(state_t                 & state,
+                               stateDerivative_t       & stateDerivative,
+                               float64_t         const & t,
+                               float64_t               & dt) final override;
+
+        private:
+            systemLinearization g_;                                   ///< Linearization of the stiff efforts.
+            std::vector<matrixN_t> massSplit_;                        ///< Mass matrix of each robot.
+            std::vector<matrixN_t> stiffnessSplit_;                   ///< Joint-space stiffness of each robot.
+            std::vector<matrixN_t> dampingSplit_;                     ///< Joint-space damping of each robot.
+            std::vector<Eigen::LDLT<matrixN_t, Eigen::Upper> > ldlt_; ///< Factorization of the implicit system of each robot.
+            stateDerivative_t stateIncrement_;                        ///< Internal buffer storing the increment of the state.
+    };
+}
+
+#endif //end of JIMINY_LINEAR_IMPLICIT_EULER_STEPPER_H
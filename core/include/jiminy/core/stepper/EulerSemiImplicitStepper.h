@@ -0,0 +1,39 @@
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// \brief      Implements a fixed-step semi-implicit (symplectic) Euler first-order scheme.
+/// \details    The velocity is updated first using the current acceleration, then the
+///             configuration is integrated on the Lie group using the updated velocity.
+///             Contrary to the explicit scheme, the energy of oscillating systems remains
+///             bounded, which makes it stable for much larger timesteps on stiff springs.
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef JIMINY_SEMI_IMPLICIT_EULER_STEPPER_H
+#define JIMINY_SEMI_IMPLICIT_EULER_STEPPER_H
+
+#include "jiminy/core/stepper/AbstractStepper.h"
+
+namespace jiminy
+{
+    class EulerSemiImplicitStepper: public AbstractStepper
+    {
+        public:
+            /// \brief Constructor
+            /// \param[in] f      Dynamics function, with signature a = f(t, q, v)
+            /// \param[in] robots Robots whose dynamics the stepper will work on.
+            EulerSemiImplicitStepper(systemDynamics const & f,
+                                     std::vector<Robot const *> const & robots);
+
+        protected:
+            /// \brief Internal tryStep method wrapping the arguments as state_t and stateDerivative_t.
+            bool_t tryStepImpl(state_t                 & state,
+                               stateDerivative_t       & stateDerivative,
+                               float64_t         const & t,
+                               float64_t               & dt) final override;
+
+        private:
+            stateDerivative_t stateIncrement_;  ///< Internal buffer storing the increment of the state.
+    };
+}
+
+#endif //end of JIMINY_SEMI_IMPLICIT_EULER_STEPPER_H
@@ -42,6 +42,17 @@ namespace jiminy
                                            187.0 / 2100.0,
                                            1.0 / 40.0).finished());
 
+        /* Coefficients of the continuous extension of order 4, from Dormand and Prince (1986).
+           The weight of the i-th stage at time t + theta * dt is sum_j P(i, j) * theta^(j+1). */
+        Eigen::Matrix<float64_t, 7, 4> const P((Eigen::Matrix<float64_t, 7, 4>() <<
+            1.0, -8048581381.0 / 2820520608.0, 8663915743.0 / 2820520608.0, -12715105075.0 / 11282082432.0,
+            0.0, 0.0, 0.0, 0.0,
+            0.0, 131558114200.0 / 32700410799.0, -68118460800.0 / 10900136933.0, 87487479700.0 / 32700410799.0,
+            0.0, -1754552775.0 / 470086768.0, 14199869525.0 / 1410260304.0, -10690763975.0 / 1880347072.0,
+            0.0, 127303824393.0 / 49829197408.0, -318862633887.0 / 49829197408.0, 701980252875.0 / 199316789632.0,
+            0.0, -282668133.0 / 205662961.0, 2019193451.0 / 616988883.0, -1453857185.0 / 822651844.0,
+            0.0, 40617522.0 / 29380423.0, -110615467.0 / 29380423.0, 69997945.0 / 29380423.0).finished());
+
         // These parameters are from boost's stepper implementation.
         float64_t const STEPPER_ORDER = 5.0;  ///< Stepper order, used to scale the error.
         float64_t const SAFETY = 0.9;         ///< Safety factor when updating the error, should be less than 1.
@@ -62,6 +73,16 @@ namespace jiminy
                                    float64_t const & tolRel,
                                    float64_t const & tolAbs);
 
+            virtual bool_t hasDenseOutput(void) const override final;
+
+            /// \brief Evaluate the state and its derivative at any time within the last successful step.
+            /// \details The continuous extension is of order 4, which is enough to not degrade the accuracy
+            ///          of the integration in practice. It is computed on the Lie group: the interpolated
+            ///          velocity increment is integrated from the starting state of the step.
+            virtual bool_t computeDenseOutput(float64_t         const & t,
+                                              state_t                 & state,
+                                              stateDerivative_t       & stateDerivative) override final;
+
         protected:
             /// \brief Determine if step has succeeded or failed, and adjust dt.
             /// \param[in] intialState Starting state, used to compute alternative estimates of the solution.
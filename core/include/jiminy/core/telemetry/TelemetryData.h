@@ -26,6 +26,14 @@ namespace jiminy
     std::string const START_LINE_TOKEN("StartLine");      ///< Marker of the beginning of a line of data.
     std::string const START_DATA("StartData");            ///< Marker of the beginning of the data section.
 
+    ////////////////////////////////////////////////////////////////////////
+    /// \brief Cache line, used as allocation unit of the telemetry buffer.
+    ////////////////////////////////////////////////////////////////////////
+    struct alignas(64) cacheLine_t
+    {
+        char_t data[64];
+    };
+
     ////////////////////////////////////////////////////////////////////////
     /// \class TelemetryData
     /// \brief Manage the telemetry buffers.
@@ -46,18 +54,49 @@ namespace jiminy
         ////////////////////////////////////////////////////////////////////////
         void reset(void);
 
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief Start registering again the variables and constants of the previous
+        ///        simulation, without clearing the buffers.
+        ///
+        /// \details Registering a known variable gives back its index, while registering
+        ///          an unknown one fails silently. The constants can be updated. Once
+        ///          done, `getIsRecycled` tells whether exactly the same variables have
+        ///          been registered, otherwise the telemetry must be reset.
+        ///
+        /// \return Whether there is anything to recycle.
+        ////////////////////////////////////////////////////////////////////////
+        bool_t rewind(void);
+
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief Whether every variable has been registered again since the last rewind.
+        ////////////////////////////////////////////////////////////////////////
+        bool_t getIsRecycled(void) const;
+
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief Number of times the telemetry has been reset.
+        ///
+        /// \details It is used by the senders to detect that they must register their
+        ///          variables again.
+        ////////////////////////////////////////////////////////////////////////
+        uint64_t const & getGeneration(void) const;
+
         ////////////////////////////////////////////////////////////////////////
         /// \brief Register a new variable in for telemetry.
         /// \warning The only supported types are int64_t and float64_t.
         ///
-        /// \param[in]  variableNameIn       Name of the variable to register.
-        /// \param[out] positionInBufferOut  Pointer on the allocated buffer that will hold the variable.
+        /// \details The variables are stored contiguously in the registry of their type,
+        ///          in order of registration. The registry is reallocated when registering
+        ///          is disabled, so the index must be used instead of the address of the
+        ///          variable.
+        ///
+        /// \param[in]  variableNameIn  Name of the variable to register.
+        /// \param[out] indexOut        Index of the variable in the registry of its type.
         ///
         /// \return S_OK if successful, the corresponding telemetry error otherwise.
         ////////////////////////////////////////////////////////////////////////
         template<typename T>
-        hresult_t registerVariable(std::string const   & variableNameIn,
-                                   T                 * & positionInBufferOut);
+        hresult_t registerVariable(std::string const & variableNameIn,
+                                   std::size_t       & indexOut);
 
         ////////////////////////////////////////////////////////////////////////
         /// \brief Register a constant for the telemetry.
@@ -74,19 +113,51 @@ namespace jiminy
         /// \brief Format the telemetry header with the current recorded informations.
         /// \warning Calling this method will disable further registrations.
         ///
+        /// \details The values of the variables are moved in a single contiguous buffer
+        ///          at this point, formatted as a line of data of the log.
+        ///
         /// \param[out] header  header to populate.
         ////////////////////////////////////////////////////////////////////////
         void formatHeader(std::vector<char_t> & header);
 
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief Get the address of the pointer to the first variable of a given type.
+        ///
+        /// \details The pointer is updated whenever the registry is reallocated.
+        ////////////////////////////////////////////////////////////////////////
         template<typename T>
-        std::deque<std::pair<std::string, T> > * getRegistry(void);
+        T * const * getRegistry(void);
+
+        template<typename T>
+        std::vector<std::string> * getRegistryNames(void);
+
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief Get the current line of data: [time, integers, floats].
+        /// \warning Only available once registering is disabled.
+        ///
+        /// \return Pointer to the beginning of the line, nullptr if not available.
+        ////////////////////////////////////////////////////////////////////////
+        char_t * getDataSnapshot(void);
+
+    private:
+        void allocateDataArena(void);
 
     private:
-        // Must use dequeue to preserve pointer addresses after resize
         std::deque<std::pair<std::string, std::string> > constantsRegistry_;  ///< Memory to handle constants
-        std::deque<std::pair<std::string, int64_t> > integersRegistry_;       ///< Memory to handle integers
-        std::deque<std::pair<std::string, float64_t> > floatsRegistry_;       ///< Memory to handle floats
+        std::vector<std::string> integersNames_;                              ///< Name of the integers, in order of registration
+        std::vector<std::string> floatsNames_;                                ///< Name of the floats, in order of registration
+        std::vector<int64_t> integersRegistry_;                               ///< Memory to handle integers while registering
+        std::vector<float64_t> floatsRegistry_;                               ///< Memory to handle floats while registering
+        std::vector<cacheLine_t> dataArena_;                                  ///< Cache-aligned memory to handle every variables once registering is over
+        int64_t * integersData_;                                              ///< Pointer to the first integer
+        float64_t * floatsData_;                                              ///< Pointer to the first float
         bool_t isRegisteringAvailable_;                                       ///< Whether registering is available
+        bool_t isRecycling_;                                                  ///< Whether the variables of the previous simulation are being registered again
+        bool_t isHeaderOutdated_;                                             ///< Whether the constants have changed since the header has been formatted
+        std::vector<bool_t> integersRecycled_;                                ///< Whether each integer has been registered again since the last rewind
+        std::vector<bool_t> floatsRecycled_;                                  ///< Whether each float has been registered again since the last rewind
+        std::vector<bool_t> constantsRecycled_;                               ///< Whether each constant has been registered again since the last rewind
+        uint64_t generation_;                                                 ///< Number of times the telemetry has been reset
     };
 } // namespace jiminy
 
@@ -14,35 +14,48 @@ namespace jiminy
 {
     template<typename T>
     hresult_t TelemetryData::registerVariable(std::string const & variableName,
-                                              T * & positionInBufferOut)
+                                              std::size_t       & indexOut)
     {
         // Get the right registry
-        std::deque<std::pair<std::string, T> > * registry = getRegistry<T>();
+        std::vector<std::string> * names = getRegistryNames<T>();
 
         // Check if already in memory
-        auto variableIt = std::find_if(
-            registry->begin(),
-            registry->end(),
-            [&variableName](std::pair<std::string, T> const & element) -> bool_t
-            {
-                return element.first == variableName;
-            });
-        if (variableIt != registry->end())
+        auto variableIt = std::find(names->begin(), names->end(), variableName);
+        if (variableIt != names->end())
         {
-            positionInBufferOut = &(variableIt->second);
+            indexOut = static_cast<std::size_t>(std::distance(names->begin(), variableIt));
+            if (isRecycling_)
+            {
+                std::vector<bool_t> & recycled = std::is_same_v<T, int64_t> ? integersRecycled_ : floatsRecycled_;
+                recycled[indexOut] = true;
+            }
             return hresult_t::SUCCESS;
         }
 
-        // Check if registration is possible
+        /* Check if registration is possible.
+           While recycling, it is expected to fail as soon as the variables have changed. */
         if (!isRegisteringAvailable_)
         {
-            PRINT_ERROR("Entry not found and registration is not available.");
+            if (!isRecycling_)
+            {
+                PRINT_ERROR("Entry not found and registration is not available.");
+            }
             return hresult_t::ERROR_GENERIC;
         }
 
         // Create new variable in registry
-        registry->push_back({variableName, {}});
-        positionInBufferOut = &(registry->back().second);
+        indexOut = names->size();
+        names->push_back(variableName);
+        if constexpr (std::is_same_v<T, int64_t>)
+        {
+            integersRegistry_.push_back(0);
+            integersData_ = integersRegistry_.data();
+        }
+        else
+        {
+            floatsRegistry_.push_back(0.0);
+            floatsData_ = floatsRegistry_.data();
+        }
 
         return hresult_t::SUCCESS;
     }
@@ -9,8 +9,12 @@
 #define JIMINY_TELEMETRY_RECORDER_H
 
 #include <deque>
+#include <atomic>
+#include <thread>
 
 #include "jiminy/core/io/MemoryDevice.h"
+#include "jiminy/core/io/FileDevice.h"
+#include "jiminy/core/utilities/SpscQueue.h"
 
 
 namespace jiminy
@@ -26,7 +30,7 @@ namespace jiminy
         TelemetryRecorder(TelemetryRecorder const &) = delete;
         TelemetryRecorder & operator=(TelemetryRecorder const &) = delete;
     public:
-        TelemetryRecorder(void) = default;
+        TelemetryRecorder(void);
         ~TelemetryRecorder(void);
 
         ////////////////////////////////////////////////////////////////////////
@@ -34,9 +38,15 @@ namespace jiminy
         /// \param[in] telemetryData Data to log.
         /// \param[in] timeUnit Unit with which the time will be logged.
         ///                     Note that time is logged.
+        /// \param[in] streamingPath Binary log file to which the data are streamed during
+        ///                          the recording. Keep everything in memory if empty.
+        /// \param[in] maxInFlightChunks Maximum number of chunks of memory allocated at once
+        ///                              in streaming mode, including the one being filled.
         ////////////////////////////////////////////////////////////////////////
         hresult_t initialize(TelemetryData       * telemetryData,
-                             float64_t     const & timeUnit);
+                             float64_t     const & timeUnit,
+                             std::string   const & streamingPath = "",
+                             uint32_t      const & maxInFlightChunks = 4U);
 
         bool_t const & getIsInitialized(void);
 
@@ -50,6 +60,8 @@ namespace jiminy
 
         ////////////////////////////////////////////////////////////////////////
         /// \brief Reset the recorder.
+        /// \details In streaming mode, the last chunk is flushed and the log file is
+        ///          closed once all the pending chunks have been written.
         ////////////////////////////////////////////////////////////////////////
         void reset(void);
 
@@ -58,6 +70,12 @@ namespace jiminy
         ////////////////////////////////////////////////////////////////////////
         hresult_t flushDataSnapshot(float64_t const & timestamp);
 
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief Get the recorded data.
+        /// \details The data are assembled by bulk copies of the chunks of memory,
+        ///          without parsing them. In streaming mode, they are read back from
+        ///          the log file, which is only possible once the recorder is reset.
+        ////////////////////////////////////////////////////////////////////////
         hresult_t getLog(logData_t & logData);
         static hresult_t readLog(std::string const & filename,
                                  logData_t         & logData);
@@ -66,33 +84,58 @@ namespace jiminy
 
     private:
         ////////////////////////////////////////////////////////////////////////
-        /// \brief   Create a new file to continue the recording.
-        /// \details Each chunk shall have a size defined by LARGE_LOG_SIZE_GB and shall
-        ///          be suffixed by an increasing natural number.
-        ///
-        /// \return  SUCCESS if successful, the corresponding telemetry error otherwise.
+        /// \brief   Allocate a new chunk of memory to continue the recording.
+        /// \details Each chunk shall have a size defined by TELEMETRY_MIN_BUFFER_SIZE,
+        ///          rounded down to an integer number of lines of data.
+        ////////////////////////////////////////////////////////////////////////
+        void createNewChunk(void);
+
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief   Hand over the current chunk to the writer thread, then take a free one.
+        /// \details It never performs any I/O. It only waits if all the chunks are in
+        ///          flight, which bounds the memory if the disk cannot keep up.
         ////////////////////////////////////////////////////////////////////////
-        hresult_t createNewChunk();
+        void pushChunk(int64_t const & linesNum);
+
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief   Append the chunks to the log file as soon as they are available,
+        ///          until streaming is stopped and every pending chunk is written.
+        ////////////////////////////////////////////////////////////////////////
+        void writerLoop(void);
+
+        void stopStreaming(void);
 
     private:
         ///////////////////////////////////////////////////////////////////////
         /// Private attributes
         ///////////////////////////////////////////////////////////////////////
-        std::deque<MemoryDevice> flows_;
+        std::vector<char_t> header_;                ///< Header of the log
+        std::deque<std::vector<uint8_t> > chunks_;  ///< Lines of data [time, integers, floats], stored contiguously without token
 
         bool_t isInitialized_;
 
-        int64_t recordedBytesLimits_;
-        int64_t recordedBytesDataLine_;
-        int64_t recordedBytes_;             ///< Bytes recorded in the file.
+        int64_t chunkLinesMax_;             ///< Maximum number of lines of data per chunk
+        int64_t chunkLinesNum_;             ///< Number of lines of data recorded in the last chunk
+        int64_t recordedBytesDataLine_;     ///< Size in bytes of a line of data, token excluded
         int64_t headerSize_;                ///< Size in byte of the header.
 
-        std::deque<std::pair<std::string, int64_t> > const * integersRegistry_;  ///< Pointer to the integer registry
-        int64_t integerSectionSize_;                                             ///< Size in bytes of the integer data section
-        std::deque<std::pair<std::string, float64_t> > const * floatsRegistry_;  ///< Pointer to the float registry
-        int64_t floatSectionSize_;                                               ///< Size in bytes of the float data section
+        char_t * dataSnapshot_;             ///< Current line of data, in the telemetry buffer
+        int64_t integerSectionSize_;        ///< Size in bytes of the integer data section
+        int64_t floatSectionSize_;          ///< Size in bytes of the float data section
 
         float64_t timeUnitInv_;             ///< Precision to use when logging the time.
+
+        uint8_t * chunk_;                   ///< Chunk of memory being filled
+
+        std::string streamingPath_;                                 ///< Log file to which the data are streamed, if any
+        std::unique_ptr<FileDevice> streamingFile_;
+        std::vector<std::vector<uint8_t> > streamingChunks_;        ///< Chunks of memory shared with the writer thread
+        std::size_t streamingChunkIdx_;                             ///< Index of the chunk being filled
+        SpscQueue<std::pair<std::size_t, int64_t> > fullChunks_;    ///< Chunks to write, along with their number of lines
+        SpscQueue<std::size_t> freeChunks_;                         ///< Chunks already written, available for recording
+        std::thread writerThread_;
+        std::atomic<bool_t> isStreaming_;                           ///< Whether the writer thread must keep waiting for chunks
+        std::atomic<bool_t> hasStreamingFailed_;
     };
 }
 
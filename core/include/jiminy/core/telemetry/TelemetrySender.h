@@ -11,7 +11,6 @@
 #define JIMINY_TELEMETRY_CLIENT_CLASS_H
 
 #include <string>
-#include <unordered_map>
 
 #include "jiminy/core/Types.h"
 
@@ -22,6 +21,28 @@ namespace jiminy
 
     std::string const DEFAULT_TELEMETRY_NAMESPACE("Uninitialized Object");
 
+    ////////////////////////////////////////////////////////////////////////
+    /// \brief Handle to a contiguous range of registered variables.
+    ///
+    /// \details It is returned when registering variables, and used afterward to
+    ///          update them without any lookup. A whole vector is updated at once.
+    ////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    struct telemetryHandle_t
+    {
+    public:
+        telemetryHandle_t(void) = default;
+        telemetryHandle_t(std::size_t const & indexIn,
+                          std::size_t const & sizeIn);
+
+        telemetryHandle_t segment(std::size_t const & start,
+                                  std::size_t const & n) const;
+
+    public:
+        std::size_t index;  ///< Position of the first variable in the telemetry buffer
+        std::size_t size;   ///< Number of variables
+    };
+
     ////////////////////////////////////////////////////////////////////////
     /// \class TelemetrySender
     /// \brief Class to inherit if you want to send telemetry data.
@@ -37,30 +58,49 @@ namespace jiminy
         ///
         /// \details    A variable must be registered to be taken into account by the telemetry system.
         ///
-        /// \param[in]  fieldname   Name of the field to record in the telemetry system.
+        /// \param[in]  fieldname     Name of the field to record in the telemetry system.
         /// \param[in]  initialValue  Initial value of the newly recored field.
+        /// \param[out] handle        Handle to use for updating the variable.
         ////////////////////////////////////////////////////////////////////////
         template<typename T>
-        hresult_t registerVariable(std::string const & fieldname,
-                                   T           const & initialValue);
+        hresult_t registerVariable(std::string          const & fieldname,
+                                   T                    const & initialValue,
+                                   telemetryHandle_t<T>       & handle);
 
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief      Register a vector of variables into the telemetry system.
+        ///
+        /// \details    The variables are stored contiguously in the telemetry buffer,
+        ///             so that they can be updated all at once.
+        ///
+        /// \param[in]  fieldnames     Name of the fields to record in the telemetry system.
+        /// \param[in]  initialValues  Initial value of the newly recored fields.
+        /// \param[out] handle         Handle to use for updating the variables.
+        ////////////////////////////////////////////////////////////////////////
         template<typename Derived>
-        hresult_t registerVariable(std::vector<std::string>   const & fieldnames,
-                                   Eigen::MatrixBase<Derived> const & values);
+        hresult_t registerVariable(std::vector<std::string>                    const & fieldnames,
+                                   Eigen::MatrixBase<Derived>                  const & initialValues,
+                                   telemetryHandle_t<typename Derived::Scalar>       & handle);
 
         ////////////////////////////////////////////////////////////////////////
         /// \brief      Update specified registered variable in the telemetry buffer.
         ///
-        /// \param[in]  fieldname  Name of the value to update.
-        /// \param[in]  value      Updated value of the variable.
+        /// \param[in]  handle  Handle of the variable to update.
+        /// \param[in]  value   Updated value of the variable.
         ////////////////////////////////////////////////////////////////////////
         template<typename T>
-        void updateValue(std::string const & fieldname,
-                         T           const & value);
+        void updateValue(telemetryHandle_t<T> const & handle,
+                         T                    const & value);
 
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief      Update specified registered vector of variables in the telemetry buffer.
+        ///
+        /// \param[in]  handle  Handle of the variables to update.
+        /// \param[in]  values  Updated value of the variables.
+        ////////////////////////////////////////////////////////////////////////
         template<typename Derived>
-        void updateValue(std::vector<std::string>   const & fieldnames,
-                         Eigen::MatrixBase<Derived> const & values);
+        void updateValue(telemetryHandle_t<typename Derived::Scalar> const & handle,
+                         Eigen::MatrixBase<Derived>                  const & values);
 
         ////////////////////////////////////////////////////////////////////////
         /// \brief     Configure the object.
@@ -76,6 +116,12 @@ namespace jiminy
         void configureObject(std::shared_ptr<TelemetryData> telemetryDataInstance,
                              std::string const & objectName);
 
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief     Whether the object is configured and its variables are still
+        ///            registered, ie the telemetry has not been reset since then.
+        ///////////////////////////////////////////////////////////////////////
+        bool_t getIsConfigured(void) const;
+
         ////////////////////////////////////////////////////////////////////////
         /// \brief     Get the number of registered entries.
         ///
@@ -102,15 +148,19 @@ namespace jiminy
         hresult_t registerConstant(std::string const & invariantName,
                                    std::string const & value);
 
+    private:
+        template<typename T>
+        T * getBuffer(void);
+
     protected:
         std::string objectName_;  ///< Name of the logged object.
 
     private:
         std::shared_ptr<TelemetryData> telemetryData_;
-        /// \brief Associate int64_t variable position to their ID.
-        std::unordered_map<std::string, int64_t *> intBufferPosition_;
-        /// \brief Associate float64_t variable position to their ID.
-        std::unordered_map<std::string, float64_t *> floatBufferPosition_;
+        int64_t * const * intBuffer_;      ///< Address of the telemetry buffer of int64_t variables
+        float64_t * const * floatBuffer_;  ///< Address of the telemetry buffer of float64_t variables
+        uint32_t localNumEntries_;         ///< Number of variables registered by this object
+        uint64_t generation_;              ///< Generation of the telemetry at configuration time
     };
 } // End of jiminy namespace
 
@@ -6,30 +6,94 @@
 
 namespace jiminy
 {
+    template<typename T>
+    telemetryHandle_t<T>::telemetryHandle_t(std::size_t const & indexIn,
+                                            std::size_t const & sizeIn) :
+    index(indexIn),
+    size(sizeIn)
+    {
+        // Empty on purpose
+    }
+
+    template<typename T>
+    telemetryHandle_t<T> telemetryHandle_t<T>::segment(std::size_t const & start,
+                                                       std::size_t const & n) const
+    {
+        return {index + start, n};
+    }
+
+    template<>
+    inline int64_t * TelemetrySender::getBuffer<int64_t>(void)
+    {
+        return *intBuffer_;
+    }
+
+    template<>
+    inline float64_t * TelemetrySender::getBuffer<float64_t>(void)
+    {
+        return *floatBuffer_;
+    }
+
     template<typename Derived>
-    hresult_t TelemetrySender::registerVariable(std::vector<std::string>   const & fieldnames,
-                                                Eigen::MatrixBase<Derived> const & initialValues)
+    hresult_t TelemetrySender::registerVariable(std::vector<std::string>                    const & fieldnames,
+                                                Eigen::MatrixBase<Derived>                  const & initialValues,
+                                                telemetryHandle_t<typename Derived::Scalar>       & handle)
     {
+        using Scalar = typename Derived::Scalar;
+
+        if (fieldnames.size() != static_cast<std::size_t>(initialValues.size()))
+        {
+            PRINT_ERROR("The number of fieldnames does not match the size of the initial values.");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+
+        /* Register the variables one by one. They are contiguous in the telemetry
+           buffer as long as none of them was already registered separately. */
         hresult_t returnCode = hresult_t::SUCCESS;
+        telemetryHandle_t<Scalar> variableHandle;
+        handle = {};
         for (Eigen::Index i=0; i < initialValues.size(); ++i)
         {
             if (returnCode == hresult_t::SUCCESS)
             {
-                returnCode = registerVariable(fieldnames[i], initialValues[i]);
+                returnCode = registerVariable(fieldnames[i], Scalar(initialValues[i]), variableHandle);
+            }
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                if (i == 0)
+                {
+                    handle = {variableHandle.index, fieldnames.size()};
+                }
+                else if (variableHandle.index != handle.index + static_cast<std::size_t>(i))
+                {
+                    PRINT_ERROR("Variable '", fieldnames[i], "' already registered separately. "
+                                "Impossible to register the variables contiguously.");
+                    returnCode = hresult_t::ERROR_BAD_INPUT;
+                }
             }
         }
+
         return returnCode;
     }
 
+    template<typename T>
+    void TelemetrySender::updateValue(telemetryHandle_t<T> const & handle,
+                                      T                    const & value)
+    {
+        // Write the value directly in the telemetry buffer
+        getBuffer<T>()[handle.index] = value;
+    }
+
     template<typename Derived>
-    void TelemetrySender::updateValue(std::vector<std::string>   const & fieldnames,
-                                      Eigen::MatrixBase<Derived> const & values)
+    void TelemetrySender::updateValue(telemetryHandle_t<typename Derived::Scalar> const & handle,
+                                      Eigen::MatrixBase<Derived>                  const & values)
     {
-        for (Eigen::Index i=0; i < values.size(); ++i)
-        {
-            updateValue(fieldnames[i], values[i]);
-        }
+        using Scalar = typename Derived::Scalar;
+
+        // Copy the whole vector at once in the telemetry buffer
+        Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, 1> >(
+            getBuffer<Scalar>() + handle.index, static_cast<Eigen::Index>(handle.size)) = values;
     }
 } // namespace jiminy
 
-#endif // JIMINY_TELEMETRY_SENDER_TPP
\ No newline at end of file
+#endif // JIMINY_TELEMETRY_SENDER_TPP
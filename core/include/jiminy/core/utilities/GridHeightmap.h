@@ -0,0 +1,79 @@
+#ifndef JIMINY_GRID_HEIGHTMAP_H
+#define JIMINY_GRID_HEIGHTMAP_H
+
+#include <memory>
+
+#include "jiminy/core/Macros.h"
+#include "jiminy/core/Types.h"
+
+
+namespace jiminy
+{
+    enum class heightmapInterpolation_t : uint8_t
+    {
+        BILINEAR = 0,
+        BICUBIC = 1
+    };
+
+    /// \brief Heightmap sampled on a regular grid, evaluated natively.
+    ///
+    /// \details The heights are stored contiguously, the first dimension being along x-axis
+    ///          and the second along y-axis. The ground normal is computed analytically
+    ///          from the gradient of the interpolant. Outside the grid, the height of the
+    ///          closest border is used. It can be used directly as ground profile since it
+    ///          is convertible to `heightmapFunctor_t`, in which case the engine detects it
+    ///          and queries all the contact points of a system at once.
+    class GridHeightmap
+    {
+    public:
+        /// \param[in] heights Height of the ground at every point of the grid.
+        /// \param[in] origin Position (x, y) of the first point of the grid in world frame.
+        /// \param[in] resolution Distance between two consecutive points of the grid.
+        /// \param[in] interpolation Interpolation method between the points of the grid.
+        GridHeightmap(matrixN_t                const & heights,
+                      vector2_t                const & origin,
+                      float64_t                const & resolution,
+                      heightmapInterpolation_t const & interpolation = heightmapInterpolation_t::BILINEAR);
+        ~GridHeightmap(void) = default;
+
+        /// \brief Sample any heightmap on a square grid centered at the origin.
+        ///
+        /// \details The grid is the same as the one of `discretizeHeightmap`.
+        static GridHeightmap fromHeightmap(heightmapFunctor_t       const & heightmap,
+                                           float64_t                const & gridSize,
+                                           float64_t                const & gridUnit,
+                                           heightmapInterpolation_t const & interpolation = heightmapInterpolation_t::BILINEAR);
+
+        /// \brief Height and normal of the ground at a given position.
+        std::pair<float64_t, vector3_t> operator()(vector3_t const & pos) const;
+
+        /// \brief Height and normal of the ground at several positions at once.
+        ///
+        /// \param[in] positions Positions in world frame, one per column.
+        /// \param[out] heights Height of the ground at each position. It must be pre-allocated.
+        /// \param[out] normals Normal of the ground at each position, one per column. It must be pre-allocated.
+        void operator()(matrix3N_t const & positions,
+                        vectorN_t        & heights,
+                        matrix3N_t       & normals) const;
+
+        matrixN_t const & getHeights(void) const;
+        vector2_t const & getOrigin(void) const;
+        float64_t const & getResolution(void) const;
+        heightmapInterpolation_t const & getInterpolation(void) const;
+
+    private:
+        void evaluate(float64_t const & x,
+                      float64_t const & y,
+                      float64_t       & height,
+                      vector3_t       & normal) const;
+
+    private:
+        std::shared_ptr<matrixN_t const> heights_;  ///< Shared to make the copy cheap, since std::function copies it
+        vector2_t origin_;
+        float64_t resolution_;
+        float64_t resolutionInv_;
+        heightmapInterpolation_t interpolation_;
+    };
+}
+
+#endif  // JIMINY_GRID_HEIGHTMAP_H
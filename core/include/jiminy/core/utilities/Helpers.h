@@ -61,6 +61,8 @@ namespace jiminy
         Timer(void);
         void tic(void);
         void toc(void);
+        /// \brief Time elapsed since the last call to `tic`, without updating the timer.
+        float64_t getElapsed(void) const;
 
     public:
         std::chrono::time_point<Time> t0;
@@ -1,37 +1,142 @@
 #ifndef JIMINY_RANDOM_H
 #define JIMINY_RANDOM_H
 
+#include <array>
+#include <limits>
+
 #include "jiminy/core/Macros.h"
 #include "jiminy/core/Types.h"
 
 
 namespace jiminy
 {
+    // ************ Counter-based random number generator ***************
+
+    /// \brief Philox4x32-10 counter-based random number generator.
+    ///
+    /// \details Based on "Parallel random numbers: as easy as 1, 2, 3" by Salmon et al. (SC, 2011).
+    ///          The state is only a key and a counter, so that independent streams are obtained
+    ///          by changing the key, without any setup. It satisfies the requirements of
+    ///          UniformRandomBitGenerator, so that it can be used with the standard library.
+    ///          It is not thread-safe: every thread or engine must own its generator.
+    class PhiloxGenerator
+    {
+    public:
+        using result_type = uint32_t;
+
+    public:
+        /// \param[in] seed Seed of the generator.
+        /// \param[in] stream Index of the stream, to get independent generators for a given seed.
+        explicit PhiloxGenerator(uint32_t const & seed = 0U,
+                                 uint32_t const & stream = 0U);
+        ~PhiloxGenerator(void) = default;
+
+        void seed(uint32_t const & seed,
+                  uint32_t const & stream = 0U);
+
+        /// \brief Generator of another stream for the same seed, starting from the beginning.
+        PhiloxGenerator split(uint32_t const & stream) const;
+
+        /// \brief Move the generator to the beginning of the block associated with a given counter.
+        ///
+        /// \param[in] counter 128-bits counter, starting from the least significant word.
+        void setCounter(std::array<uint32_t, 4> const & counter);
+
+        result_type operator()(void);
+        void discard(uint64_t n);
+
+        static constexpr result_type min(void)
+        {
+            return std::numeric_limits<result_type>::min();
+        }
+
+        static constexpr result_type max(void)
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+    private:
+        void generateBlock(void);
+
+    private:
+        std::array<uint32_t, 2> key_;
+        std::array<uint32_t, 4> counter_;
+        std::array<uint32_t, 4> block_;  ///< Random numbers associated with the previous value of the counter
+        uint8_t blockIdx_;               ///< Index of the next random number to return in the block
+    };
+
     // ************ Random number generator utilities ***************
 
+    /// \brief Reset the process-wide random number generator.
+    ///
+    /// \details It is only used by the methods that do not take a generator as input. The engines
+    ///          own their generator, so that they do not rely on it.
     void resetRandomGenerators(std::optional<uint32_t> const & seed = std::nullopt);
 
     hresult_t getRandomSeed(uint32_t & seed);
 
     float64_t randUniform(float64_t const & lo = 0.0,
                           float64_t const & hi = 1.0);
+    float64_t randUniform(PhiloxGenerator       & generator,
+                          float64_t       const & lo = 0.0,
+                          float64_t       const & hi = 1.0);
 
     float64_t randNormal(float64_t const & mean = 0.0,
                          float64_t const & std = 1.0);
+    float64_t randNormal(PhiloxGenerator       & generator,
+                         float64_t       const & mean = 0.0,
+                         float64_t       const & std = 1.0);
 
     vectorN_t randVectorNormal(uint32_t  const & size,
                                 float64_t const & mean,
                                 float64_t const & std);
+    vectorN_t randVectorNormal(PhiloxGenerator       & generator,
+                               uint32_t        const & size,
+                               float64_t       const & mean,
+                               float64_t       const & std);
 
     vectorN_t randVectorNormal(uint32_t  const & size,
                                 float64_t const & std);
+    vectorN_t randVectorNormal(PhiloxGenerator       & generator,
+                               uint32_t        const & size,
+                               float64_t       const & std);
 
     vectorN_t randVectorNormal(vectorN_t const & std);
+    vectorN_t randVectorNormal(PhiloxGenerator       & generator,
+                               vectorN_t       const & std);
 
     vectorN_t randVectorNormal(vectorN_t const & mean,
                                 vectorN_t const & std);
+    vectorN_t randVectorNormal(PhiloxGenerator       & generator,
+                               vectorN_t       const & mean,
+                               vectorN_t       const & std);
 
     void shuffleIndices(std::vector<uint32_t> & vector);
+    void shuffleIndices(PhiloxGenerator       & generator,
+                        std::vector<uint32_t> & vector);
+
+    /// \brief Fill a pre-allocated vector with independent uniform samples in [lo, hi).
+    ///
+    /// \details It does not allocate memory, so that it can be used in the simulation loop.
+    void fillRandomUniform(PhiloxGenerator             & generator,
+                           Eigen::Ref<vectorN_t>         values,
+                           float64_t             const & lo = 0.0,
+                           float64_t             const & hi = 1.0);
+
+    /// \brief Fill a pre-allocated vector with independent normal samples.
+    ///
+    /// \details The samples are generated by batch using Box-Muller transform, for which the
+    ///          math functions are vectorized. It does not allocate memory, so that it can be
+    ///          used in the simulation loop. Note that the samples differ from `randNormal`.
+    void fillRandomNormal(PhiloxGenerator             & generator,
+                          Eigen::Ref<vectorN_t>         values,
+                          float64_t             const & mean = 0.0,
+                          float64_t             const & std = 1.0);
+
+    /// \brief Same as `fillRandomNormal`, for centered samples with element-wise standard deviation.
+    void fillRandomNormal(PhiloxGenerator             & generator,
+                          Eigen::Ref<vectorN_t>         values,
+                          vectorN_t             const & std);
 
     // ************ Continuous 1D Perlin processes ***************
 
@@ -50,6 +155,7 @@ namespace jiminy
         ~PeriodicGaussianProcess(void) = default;
 
         void reset(void);
+        void reset(PhiloxGenerator & generator);
 
         float64_t operator()(float const & t);
 
@@ -90,6 +196,7 @@ namespace jiminy
         ~PeriodicFourierProcess(void) = default;
 
         void reset(void);
+        void reset(PhiloxGenerator & generator);
 
         float64_t operator()(float const & t);
 
@@ -122,7 +229,7 @@ namespace jiminy
                                   float64_t const & scale);
         virtual ~AbstractPerlinNoiseOctave(void) = default;
 
-        virtual void reset(void);
+        virtual void reset(PhiloxGenerator & generator);
 
         float64_t operator()(float64_t const & t) const;
 
@@ -154,7 +261,7 @@ namespace jiminy
 
         virtual ~RandomPerlinNoiseOctave(void) = default;
 
-        virtual void reset(void) override final;
+        virtual void reset(PhiloxGenerator & generator) override final;
 
     protected:
         virtual float64_t grad(int32_t knot,
@@ -173,7 +280,7 @@ namespace jiminy
 
         virtual ~PeriodicPerlinNoiseOctave(void) = default;
 
-        virtual void reset(void) override final;
+        virtual void reset(PhiloxGenerator & generator) override final;
 
     protected:
         virtual float64_t grad(int32_t knot,
@@ -220,6 +327,7 @@ namespace jiminy
         virtual ~AbstractPerlinProcess(void) = default;
 
         void reset(void);
+        void reset(PhiloxGenerator & generator);
 
         float64_t operator()(float const & t);
 
@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// \brief      Bounded lock-free queue with a single producer and a single consumer.
+///
+/// \details    The values are stored in a ring buffer allocated once and for all. The
+///             producer only writes the tail index and the consumer only writes the head
+///             index, so that pushing and popping never block nor allocate. It is only
+///             safe if at most one thread pushes and at most one other thread pops.
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef JIMINY_SPSC_QUEUE_H
+#define JIMINY_SPSC_QUEUE_H
+
+#include <atomic>
+#include <vector>
+
+#include "jiminy/core/Macros.h"
+#include "jiminy/core/Types.h"
+
+
+namespace jiminy
+{
+    template<typename T>
+    class SpscQueue
+    {
+    public:
+        // Disable the copy of the class
+        SpscQueue(SpscQueue const & queue) = delete;
+        SpscQueue & operator = (SpscQueue const & queue) = delete;
+
+    public:
+        explicit SpscQueue(std::size_t const & capacity = 0U);
+        ~SpscQueue(void) = default;
+
+        /// \brief Discard every value and change the capacity of the queue.
+        ///
+        /// \details It is not thread-safe, so neither the producer nor the consumer must be
+        ///          running at that point.
+        void reset(std::size_t const & capacity);
+
+        /// \brief Push a value at the back of the queue, if it is not full.
+        ///
+        /// \return Whether the value has been pushed.
+        bool_t tryPush(T const & value);
+
+        /// \brief Pop the value at the front of the queue, if it is not empty.
+        ///
+        /// \return Whether a value has been popped.
+        bool_t tryPop(T & value);
+
+        bool_t empty(void) const;
+        std::size_t capacity(void) const;
+
+    private:
+        std::vector<T> buffer_;                             ///< One slot more than the capacity to tell full from empty
+        alignas(64) std::atomic<std::size_t> head_;         ///< Index of the next value to pop, written by the consumer only
+        alignas(64) std::atomic<std::size_t> tail_;         ///< Index of the next free slot, written by the producer only
+    };
+}
+
+#include "jiminy/core/utilities/SpscQueue.tpp"
+
+#endif  // JIMINY_SPSC_QUEUE_H
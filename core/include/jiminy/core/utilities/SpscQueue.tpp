@@ -0,0 +1,58 @@
+namespace jiminy
+{
+    template<typename T>
+    SpscQueue<T>::SpscQueue(std::size_t const & capacity) :
+    buffer_(capacity + 1U),
+    head_(0U),
+    tail_(0U)
+    {
+        // Empty on purpose
+    }
+
+    template<typename T>
+    void SpscQueue<T>::reset(std::size_t const & capacity)
+    {
+        buffer_.resize(capacity + 1U);
+        head_.store(0U, std::memory_order_relaxed);
+        tail_.store(0U, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    bool_t SpscQueue<T>::tryPush(T const & value)
+    {
+        std::size_t const tail = tail_.load(std::memory_order_relaxed);
+        std::size_t const tailNext = (tail + 1U == buffer_.size()) ? 0U : tail + 1U;
+        if (tailNext == head_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        buffer_[tail] = value;
+        tail_.store(tailNext, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    bool_t SpscQueue<T>::tryPop(T & value)
+    {
+        std::size_t const head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        value = buffer_[head];
+        head_.store((head + 1U == buffer_.size()) ? 0U : head + 1U, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    bool_t SpscQueue<T>::empty(void) const
+    {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    template<typename T>
+    std::size_t SpscQueue<T>::capacity(void) const
+    {
+        return buffer_.size() - 1U;
+    }
+}
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// \brief      Flat binary buffer used to save and restore the internal state of objects.
+///
+/// \details    The same method describes the state of an object for both directions, so that
+///             saving and restoring cannot get out of sync. Every quantity is copied as is in a
+///             contiguous buffer, along with the size of the dynamic ones. The buffer is only
+///             meaningful for objects with the same structure as those from which it has been
+///             saved, which is checked by a dry run before actually restoring anything.
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef JIMINY_STATE_ARCHIVE_H
+#define JIMINY_STATE_ARCHIVE_H
+
+#include <vector>
+#include <type_traits>
+
+#include "jiminy/core/Macros.h"
+#include "jiminy/core/Types.h"
+
+
+namespace jiminy
+{
+    enum class archiveMode_t : uint8_t
+    {
+        SAVE = 0,     ///< Append the state to the buffer
+        CHECK = 1,    ///< Go through the buffer, checking the sizes without modifying anything
+        RESTORE = 2   ///< Restore the state from the buffer
+    };
+
+    class StateArchive
+    {
+    public:
+        // Disable the copy of the class
+        StateArchive(StateArchive const & archive) = delete;
+        StateArchive & operator = (StateArchive const & archive) = delete;
+
+    public:
+        /// \brief Save the state in a given buffer.
+        ///
+        /// \param[out] buffer Buffer to which the state is saved. It is cleared without releasing
+        ///                    its memory, so that saving is cheap if the buffer is reused.
+        explicit StateArchive(std::vector<uint8_t> & buffer);
+
+        /// \brief Check or restore the state from a given buffer.
+        ///
+        /// \param[in] buffer Buffer from which the state is restored.
+        /// \param[in] mode   Whether to only check the buffer, or to restore the state.
+        StateArchive(std::vector<uint8_t> const & buffer,
+                     archiveMode_t        const & mode);
+        ~StateArchive(void) = default;
+
+        /// \brief Process a quantity that can be copied bitwise.
+        template<typename T>
+        std::enable_if_t<std::is_trivially_copyable_v<T>, void>
+        process(T & value);
+
+        /// \brief Process a contiguous range of values, whose size is known by the caller.
+        void process(float64_t         * data,
+                     std::size_t const & size);
+
+        /// \brief Process a dense vector or matrix, whose size must be unchanged when restoring.
+        template<typename Derived>
+        void process(Eigen::PlainObjectBase<Derived> & value);
+
+        /// \brief Process a vector of dense vectors or matrices.
+        template<typename T, typename Allocator>
+        std::enable_if_t<!std::is_trivially_copyable_v<T>, void>
+        process(std::vector<T, Allocator> & values);
+
+        void process(pinocchio::Force & value);
+        void process(pinocchio::Motion & value);
+        void process(std::vector<bool_t> & values);
+
+        /// \brief Process the size of a dynamic quantity, that the caller must handle.
+        ///
+        /// \details Contrary to any other quantity, it is read in check mode as well.
+        void processSize(std::size_t & size);
+
+        /// \brief Make sure that the size of a quantity is the same as when it has been saved.
+        void checkSize(std::size_t const & size);
+
+        archiveMode_t const & getMode(void) const;
+
+        /// \brief Whether the buffer is consistent with the objects so far.
+        bool_t const & getIsValid(void) const;
+
+        /// \brief Whether the whole buffer has been processed, without any inconsistency.
+        bool_t getIsComplete(void) const;
+
+    private:
+        void processBytes(void              * data,
+                          std::size_t const & size);
+
+    private:
+        std::vector<uint8_t> * bufferOut_;  ///< Buffer to which the state is saved, only in save mode
+        uint8_t const * bufferIn_;         ///< Buffer from which the state is read, only in check and restore modes
+        std::size_t bufferInSize_;
+        archiveMode_t mode_;
+        std::size_t pos_;  ///< Position of the next quantity in the buffer
+        bool_t isValid_;
+    };
+}
+
+#include "StateArchive.tpp"
+
+#endif  // JIMINY_STATE_ARCHIVE_H
@@ -0,0 +1,37 @@
+#ifndef JIMINY_STATE_ARCHIVE_TPP
+#define JIMINY_STATE_ARCHIVE_TPP
+
+
+namespace jiminy
+{
+    template<typename T>
+    std::enable_if_t<std::is_trivially_copyable_v<T>, void>
+    StateArchive::process(T & value)
+    {
+        processBytes(&value, sizeof(T));
+    }
+
+    template<typename Derived>
+    void StateArchive::process(Eigen::PlainObjectBase<Derived> & value)
+    {
+        using Scalar = typename Derived::Scalar;
+
+        // The size cannot change, since it would allocate memory
+        std::size_t const size = static_cast<std::size_t>(value.size());
+        checkSize(size);
+        processBytes(value.data(), sizeof(Scalar) * size);
+    }
+
+    template<typename T, typename Allocator>
+    std::enable_if_t<!std::is_trivially_copyable_v<T>, void>
+    StateArchive::process(std::vector<T, Allocator> & values)
+    {
+        checkSize(values.size());
+        for (T & value : values)
+        {
+            process(value);
+        }
+    }
+}
+
+#endif  // JIMINY_STATE_ARCHIVE_TPP
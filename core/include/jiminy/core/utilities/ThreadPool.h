@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// \brief      Minimal work-stealing thread pool used to spread independent workloads.
+///
+/// \details    Every worker owns a double-ended task queue. The range of tasks of a given
+///             job is split evenly between the queues beforehand. Each worker pops tasks
+///             from the front of its own queue, then steals from the back of the others
+///             once it is empty. The calling thread takes part in the computation, so that
+///             a pool of size 1 falls back to a plain serial loop without synchronization.
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef JIMINY_THREAD_POOL_H
+#define JIMINY_THREAD_POOL_H
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+#include "jiminy/core/Macros.h"
+#include "jiminy/core/Types.h"
+
+
+namespace jiminy
+{
+    class ThreadPool
+    {
+    public:
+        // Disable the copy of the class
+        ThreadPool(ThreadPool const & pool) = delete;
+        ThreadPool & operator = (ThreadPool const & pool) = delete;
+
+    public:
+        /// \param[in] threadsNum Total number of threads, including the calling thread.
+        ///                       Use the number of hardware threads if 0.
+        explicit ThreadPool(uint32_t const & threadsNum = 0U);
+        ~ThreadPool(void);
+
+        /// \brief Run `fct(i)` for every index i in [0, size) and wait for completion.
+        ///
+        /// \details The first exception raised by a task, if any, is rethrown once all
+        ///          the tasks are done. It is not possible to run several jobs at once.
+        void parallelFor(std::size_t const & size,
+                         std::function<void(std::size_t const &)> const & fct);
+
+        uint32_t getThreadsNum(void) const;
+
+    private:
+        struct taskQueue_t
+        {
+            std::mutex mutex;
+            std::deque<std::size_t> tasks;
+        };
+
+        void workerLoop(std::size_t const & workerIdx);
+        bool_t tryRunTask(std::size_t const & workerIdx);
+
+    private:
+        std::vector<std::thread> workers_;
+        std::vector<std::unique_ptr<taskQueue_t> > queues_;  ///< One queue per worker, the last one being the calling thread's
+
+        std::mutex jobMutex_;                                ///< Prevent running several jobs concurrently
+        std::mutex mutex_;
+        std::condition_variable cvWork_;
+        std::condition_variable cvDone_;
+        std::function<void(std::size_t const &)> const * job_;
+        uint64_t jobId_;
+        std::atomic<std::size_t> tasksRemaining_;
+        std::exception_ptr exception_;
+        bool_t isStopping_;
+    };
+}
+
+#endif  // JIMINY_THREAD_POOL_H
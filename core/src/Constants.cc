@@ -12,7 +12,6 @@ namespace jiminy
     int64_t const TELEMETRY_MIN_BUFFER_SIZE = 256U * 1024U;  // 256Ko
 
     uint8_t const DELAY_MIN_BUFFER_RESERVE = 20U;
-    uint8_t const DELAY_MAX_BUFFER_EXCEED = 100U;
 
     float64_t const STEPPER_MIN_TIMESTEP = 1e-10;
     float64_t const SIMULATION_MIN_TIMESTEP = 1e-6;
@@ -21,4 +20,5 @@ namespace jiminy
     uint32_t const INIT_ITERATIONS = 4U;
     uint32_t const PGS_MAX_ITERATIONS = 100U;
     float64_t const PGS_MIN_REGULARIZER = 1.0e-11;
+    uint32_t const ADMM_MAX_ITERATIONS = 200U;
 }
@@ -98,4 +98,54 @@ namespace jiminy
     {
         return drift_;
     }
+
+    std::vector<std::pair<Eigen::Index, Eigen::Index> > const & AbstractConstraintBase::getJacobianSupport(void) const
+    {
+        return jacobianSupport_;
+    }
+
+    void AbstractConstraintBase::setJacobianSupportFromBranches(std::vector<jointIndex_t> const & jointsIdx)
+    {
+        // Assuming the model still exists
+        auto model = model_.lock();
+        pinocchio::Model const & pncModel = model->pncModel_;
+
+        // Flag the velocity indices of all the joints supporting the given ones
+        std::vector<bool_t> isSupport(static_cast<std::size_t>(pncModel.nv), false);
+        for (jointIndex_t const & jointIdx : jointsIdx)
+        {
+            for (jointIndex_t const & supportIdx : pncModel.supports[jointIdx])
+            {
+                // Skip the universe
+                if (supportIdx == 0)
+                {
+                    continue;
+                }
+                pinocchio::JointModel const & joint = pncModel.joints[supportIdx];
+                for (int32_t i = joint.idx_v(); i < joint.idx_v() + joint.nv(); ++i)
+                {
+                    isSupport[static_cast<std::size_t>(i)] = true;
+                }
+            }
+        }
+
+        // Merge the flagged indices in contiguous slices
+        jacobianSupport_.clear();
+        for (Eigen::Index i = 0; i < pncModel.nv; ++i)
+        {
+            if (!isSupport[static_cast<std::size_t>(i)])
+            {
+                continue;
+            }
+            if (!jacobianSupport_.empty() &&
+                jacobianSupport_.back().first + jacobianSupport_.back().second == i)
+            {
+                ++jacobianSupport_.back().second;
+            }
+            else
+            {
+                jacobianSupport_.emplace_back(i, 1);
+            }
+        }
+    }
 }
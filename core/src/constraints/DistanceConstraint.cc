@@ -90,6 +90,10 @@ namespace jiminy
             drift_.setZero(1);
             lambda_.setZero(1);
 
+            // The jacobian only depends on the kinematic branches of both frames
+            setJacobianSupportFromBranches({model->pncModel_.frames[framesIdx_[0]].parent,
+                                            model->pncModel_.frames[framesIdx_[1]].parent});
+
             // Compute the current distance and use it as reference
             vector3_t const deltaPosition =
                 model->pncData_.oMf[framesIdx_[0]].translation() -
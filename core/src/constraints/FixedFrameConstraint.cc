@@ -101,6 +101,9 @@ namespace jiminy
             drift_.setZero(dim);
             lambda_.setZero(dim);
 
+            // The jacobian only depends on the kinematic branch of the frame
+            setJacobianSupportFromBranches({model->pncModel_.frames[frameIdx_].parent});
+
             // Get the current frame position and use it as reference
             transformRef_ = model->pncData_.oMf[frameIdx_];
 
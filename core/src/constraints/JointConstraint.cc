@@ -96,6 +96,10 @@ namespace jiminy
             drift_.setZero(jointModel.nv());
             lambda_.setZero(jointModel.nv());
 
+            /* The jacobian only depends on the joint itself, but its support must be closed
+               under the supporting joints for the sparse computation of JMinvJt. */
+            setJacobianSupportFromBranches({jointIdx_});
+
             // Get the current joint position and use it as reference
             configurationRef_ = jointModel.jointConfigSelector(q);
         }
@@ -78,6 +78,9 @@ namespace jiminy
             drift_.setZero(3);
             lambda_.setZero(3);
 
+            // The jacobian only depends on the kinematic branch of the frame
+            setJacobianSupportFromBranches({model->pncModel_.frames[frameIdx_].parent});
+
             // Get the current frame position and use it as reference
             transformRef_ = model->pncData_.oMf[frameIdx_];
         }
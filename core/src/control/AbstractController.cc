@@ -17,7 +17,9 @@ namespace jiminy
     ctrlOptionsHolder_(),
     telemetrySender_(),
     registeredVariables_(),
-    registeredConstants_()
+    registeredConstants_(),
+    floatsHandles_(),
+    intsHandles_()
     {
         AbstractController::setOptions(getDefaultControllerOptions());  // Clarify that the base implementation is called
     }
@@ -122,6 +124,11 @@ namespace jiminy
         return hresult_t::SUCCESS;
     }
 
+    void AbstractController::processState(StateArchive & /* archive */)
+    {
+        // Empty on purpose: stateless by default
+    }
+
     hresult_t AbstractController::configureTelemetry(std::shared_ptr<TelemetryData> telemetryData,
                                                      std::string const & objectPrefixName)
     {
@@ -133,7 +140,9 @@ namespace jiminy
             returnCode = hresult_t::ERROR_INIT_FAILED;
         }
 
-        if (!isTelemetryConfigured_ && baseControllerOptions_->telemetryEnable)
+        // The variables must be registered again if the telemetry has been reset meanwhile
+        if ((!isTelemetryConfigured_ || !telemetrySender_.getIsConfigured())
+         && baseControllerOptions_->telemetryEnable)
         {
             if (telemetryData)
             {
@@ -143,6 +152,8 @@ namespace jiminy
                     objectName = objectPrefixName + TELEMETRY_FIELDNAME_DELIMITER + objectName;
                 }
                 telemetrySender_.configureObject(telemetryData, objectName);
+                floatsHandles_.clear();
+                intsHandles_.clear();
                 for (auto const & [name, valuePtr] : registeredVariables_)
                 {
                     if (returnCode == hresult_t::SUCCESS)
@@ -150,7 +161,17 @@ namespace jiminy
                         // TODO Remove explicit `name` capture when moving to C++20
                         std::visit([&, & name = name](auto && arg)
                                    {
-                                       telemetrySender_.registerVariable(name, *arg);
+                                       using T = std::remove_const_t<std::remove_pointer_t<std::decay_t<decltype(arg)> > >;
+                                       telemetryHandle_t<T> handle;
+                                       returnCode = telemetrySender_.registerVariable(name, *arg, handle);
+                                       if constexpr (std::is_same_v<T, float64_t>)
+                                       {
+                                           floatsHandles_.emplace_back(arg, handle);
+                                       }
+                                       else
+                                       {
+                                           intsHandles_.emplace_back(arg, handle);
+                                       }
                                    }, valuePtr);
                     }
                 }
@@ -231,13 +252,13 @@ namespace jiminy
     {
         if (isTelemetryConfigured_)
         {
-            for (auto const & [name, valuePtr] : registeredVariables_)
+            for (auto const & [valuePtr, handle] : floatsHandles_)
+            {
+                telemetrySender_.updateValue(handle, *valuePtr);
+            }
+            for (auto const & [valuePtr, handle] : intsHandles_)
             {
-                // TODO Remove explicit `name` capture when moving to C++20
-                std::visit([&, & name = name](auto && arg)
-                           {
-                               telemetrySender_.updateValue(name, *arg);
-                           }, valuePtr);
+                telemetrySender_.updateValue(handle, *valuePtr);
             }
         }
     }
@@ -0,0 +1,222 @@
+#include <numeric>
+#include <algorithm>
+
+#include "pinocchio/multibody/geometry.hpp"                   // `pinocchio::GeometryModel`, `pinocchio::GeometryData`
+#include "pinocchio/spatial/fcl-pinocchio-conversions.hpp"  // `pinocchio::toFclTransform3f`
+
+#include "hpp/fcl/collision.h"                              // `hpp::fcl::collide`
+
+#include "jiminy/core/robot/Robot.h"
+
+#include "jiminy/core/engine/CollisionWorld.h"
+
+
+namespace jiminy
+{
+    CollisionWorld::CollisionWorld(void) :
+    robots_(),
+    geometries_(),
+    geometriesSortedIdx_(),
+    candidatePairs_(),
+    contacts_(),
+    collisionRequest_(),
+    collisionResult_(),
+    enableSelfCollisions_(false),
+    enableSystemsCollisions_(false)
+    {
+        // Empty on purpose
+    }
+
+    hresult_t CollisionWorld::initialize(std::vector<Robot const *> const & robots,
+                                         bool_t                     const & enableSelfCollisions,
+                                         bool_t                     const & enableSystemsCollisions)
+    {
+        clear();
+
+        robots_ = robots;
+        enableSelfCollisions_ = enableSelfCollisions;
+        enableSystemsCollisions_ = enableSystemsCollisions;
+        if (!enableSelfCollisions_ && !enableSystemsCollisions_)
+        {
+            return hresult_t::SUCCESS;
+        }
+
+        // Register the geometries of the collision bodies of every system
+        uint32_t maxContactPointsPerBody = 1U;
+        for (std::size_t i = 0; i < robots_.size(); ++i)
+        {
+            Robot const & robot = *robots_[i];
+            if (!robot.getIsInitialized())
+            {
+                PRINT_ERROR("Robot not initialized.");
+                return hresult_t::ERROR_INIT_FAILED;
+            }
+
+            pinocchio::GeometryModel const & geomModel = robot.collisionModel_;
+            for (std::vector<pairIndex_t> const & collisionPairsIdx : robot.getCollisionPairsIdx())
+            {
+                for (pairIndex_t const & collisionPairIdx : collisionPairsIdx)
+                {
+                    geomIndex_t const & geomIdx = geomModel.collisionPairs[collisionPairIdx].first;
+                    pinocchio::GeometryObject const & geom = geomModel.geometryObjects[geomIdx];
+
+                    // Make sure the bounding box of the shape is available
+                    geom.geometry->computeLocalAABB();
+
+                    geometry_t geometry;
+                    geometry.systemIdx = i;
+                    geometry.geomIdx = geomIdx;
+                    geometry.jointIdx = geom.parentJoint;
+                    geometry.parentJointIdx = robot.pncModel_.parents[geom.parentJoint];
+                    geometry.shape = geom.geometry.get();
+                    geometry.center = geom.geometry->aabb_center;
+                    geometry.radius = geom.geometry->aabb_radius;
+                    geometries_.push_back(geometry);
+                }
+            }
+            maxContactPointsPerBody = std::max(
+                maxContactPointsPerBody, robot.mdlOptions_->collisions.maxContactPointsPerBody);
+        }
+        collisionRequest_.num_max_contacts = maxContactPointsPerBody;
+
+        // Pre-allocate the buffers, assuming that only a fraction of the pairs are in contact at once
+        geometriesSortedIdx_.resize(geometries_.size());
+        std::iota(geometriesSortedIdx_.begin(), geometriesSortedIdx_.end(), 0U);
+        candidatePairs_.reserve(4U * geometries_.size());
+        contacts_.reserve(4U * geometries_.size() * maxContactPointsPerBody);
+
+        return hresult_t::SUCCESS;
+    }
+
+    void CollisionWorld::clear(void)
+    {
+        robots_.clear();
+        geometries_.clear();
+        geometriesSortedIdx_.clear();
+        candidatePairs_.clear();
+        contacts_.clear();
+    }
+
+    bool_t CollisionWorld::getIsEmpty(void) const
+    {
+        return geometries_.size() < 2U;
+    }
+
+    void CollisionWorld::updateBoundingBoxes(void)
+    {
+        /* The bounding sphere is invariant by rotation, so the bounding box in world frame is
+           obtained without computing the one of the shape for its current orientation. */
+        for (geometry_t & geometry : geometries_)
+        {
+            pinocchio::SE3 const & transform =
+                robots_[geometry.systemIdx]->collisionData_.oMg[geometry.geomIdx];
+            vector3_t const center = transform.act(geometry.center);
+            geometry.boxMin = center.array() - geometry.radius;
+            geometry.boxMax = center.array() + geometry.radius;
+        }
+    }
+
+    bool_t CollisionWorld::isPairEnabled(geometry_t const & geom1,
+                                         geometry_t const & geom2) const
+    {
+        if (geom1.systemIdx != geom2.systemIdx)
+        {
+            return enableSystemsCollisions_;
+        }
+
+        // The bodies of the same joint, or of adjacent joints, are always overlapping
+        return enableSelfCollisions_ && geom1.jointIdx != geom2.jointIdx
+            && geom1.parentJointIdx != geom2.jointIdx && geom2.parentJointIdx != geom1.jointIdx;
+    }
+
+    void CollisionWorld::sweepAndPrune(void)
+    {
+        // Sort the geometries by lower bound along x-axis, by insertion sort since it is almost sorted
+        for (std::size_t i = 1; i < geometriesSortedIdx_.size(); ++i)
+        {
+            std::size_t const geomIdx = geometriesSortedIdx_[i];
+            float64_t const & xMin = geometries_[geomIdx].boxMin[0];
+            std::size_t j = i;
+            for ( ; j > 0 && geometries_[geometriesSortedIdx_[j - 1]].boxMin[0] > xMin; --j)
+            {
+                geometriesSortedIdx_[j] = geometriesSortedIdx_[j - 1];
+            }
+            geometriesSortedIdx_[j] = geomIdx;
+        }
+
+        // Sweep along x-axis, then prune the pairs that do not overlap along the other axes
+        candidatePairs_.clear();
+        for (std::size_t i = 0; i < geometriesSortedIdx_.size(); ++i)
+        {
+            geometry_t const & geom1 = geometries_[geometriesSortedIdx_[i]];
+            for (std::size_t j = i + 1; j < geometriesSortedIdx_.size(); ++j)
+            {
+                geometry_t const & geom2 = geometries_[geometriesSortedIdx_[j]];
+                if (geom2.boxMin[0] > geom1.boxMax[0])
+                {
+                    break;
+                }
+                if ((geom1.boxMin.tail<2>().array() <= geom2.boxMax.tail<2>().array()).all()
+                 && (geom2.boxMin.tail<2>().array() <= geom1.boxMax.tail<2>().array()).all()
+                 && isPairEnabled(geom1, geom2))
+                {
+                    candidatePairs_.emplace_back(geometriesSortedIdx_[i], geometriesSortedIdx_[j]);
+                }
+            }
+        }
+    }
+
+    std::vector<collisionContact_t> const & CollisionWorld::computeContacts(void)
+    {
+        contacts_.clear();
+        if (getIsEmpty())
+        {
+            return contacts_;
+        }
+
+        // Find the candidate pairs
+        updateBoundingBoxes();
+        sweepAndPrune();
+
+        // Compute the actual contacts for each of them
+        for (auto const & [geomIdx1, geomIdx2] : candidatePairs_)
+        {
+            geometry_t const & geom1 = geometries_[geomIdx1];
+            geometry_t const & geom2 = geometries_[geomIdx2];
+            pinocchio::SE3 const & transform1 = robots_[geom1.systemIdx]->collisionData_.oMg[geom1.geomIdx];
+            pinocchio::SE3 const & transform2 = robots_[geom2.systemIdx]->collisionData_.oMg[geom2.geomIdx];
+
+            collisionResult_.clear();
+            hpp::fcl::collide(geom1.shape, pinocchio::toFclTransform3f(transform1),
+                              geom2.shape, pinocchio::toFclTransform3f(transform2),
+                              collisionRequest_, collisionResult_);
+            for (std::size_t k = 0; k < collisionResult_.numContacts(); ++k)
+            {
+                hpp::fcl::Contact const & contact = collisionResult_.getContact(k);
+
+                /* Make sure the collision computation didn't failed. If it happens the
+                   norm of the normal is not normalized (usually close to zero). */
+                vector3_t const normal = contact.normal;
+                if (normal.norm() < 1.0 - EPS)
+                {
+                    continue;
+                }
+
+                contacts_.push_back({geom1.systemIdx,
+                                     geom1.jointIdx,
+                                     geom2.systemIdx,
+                                     geom2.jointIdx,
+                                     contact.pos,
+                                     normal.normalized(),
+                                     - std::abs(contact.penetration_depth)});
+            }
+        }
+
+        return contacts_;
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t> > const & CollisionWorld::getCandidatePairs(void) const
+    {
+        return candidatePairs_;
+    }
+}
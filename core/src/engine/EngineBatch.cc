@@ -0,0 +1,347 @@
+#include <algorithm>
+
+#include "jiminy/core/robot/Robot.h"
+#include "jiminy/core/control/ControllerFunctor.h"
+
+#include "jiminy/core/engine/EngineBatch.h"
+
+
+namespace jiminy
+{
+    EngineBatch::EngineBatch(void) :
+    isInitialized_(false),
+    engines_(),
+    pool_(nullptr),
+    actions_(),
+    returnCodes_(),
+    nq_(0),
+    nv_(0),
+    nmotors_(0U)
+    {
+        // Empty on purpose
+    }
+
+    EngineBatch::~EngineBatch(void)
+    {
+        // Make sure the simulations are properly stopped before destroying the engines
+        stop();
+    }
+
+    hresult_t EngineBatch::initialize(std::vector<std::shared_ptr<Robot> > const & robots,
+                                      uint32_t                             const & threadsNum)
+    {
+        // Make sure that at least one robot has been provided
+        if (robots.empty())
+        {
+            PRINT_ERROR("At least one robot must be provided.");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+
+        // Make sure that the robots are initialized and share the same model
+        for (auto robotIt = robots.begin(); robotIt != robots.end(); ++robotIt)
+        {
+            std::shared_ptr<Robot> const & robot = *robotIt;
+            if (!robot || !robot->getIsInitialized())
+            {
+                PRINT_ERROR("Every robot must be initialized.");
+                return hresult_t::ERROR_INIT_FAILED;
+            }
+            if (robot->nq() != robots[0]->nq() || robot->nv() != robots[0]->nv()
+             || robot->nmotors() != robots[0]->nmotors())
+            {
+                PRINT_ERROR("Every robot must share the same model.");
+                return hresult_t::ERROR_BAD_INPUT;
+            }
+
+            /* Make sure that the robots are distinct, since the engines are stepped in
+               parallel and every robot holds its own data and random number generator. */
+            if (std::find(robots.begin(), robotIt, robot) != robotIt)
+            {
+                PRINT_ERROR("Every robot must be distinct.");
+                return hresult_t::ERROR_BAD_INPUT;
+            }
+        }
+
+        // Stop and release the previous engines if any
+        stop();
+        engines_.clear();
+        isInitialized_ = false;
+
+        // Backup the dimensions of the model
+        nq_ = robots[0]->nq();
+        nv_ = robots[0]->nv();
+        nmotors_ = robots[0]->nmotors();
+
+        // Allocate the actions and return codes buffers
+        std::size_t const batchSize = robots.size();
+        actions_.setZero(static_cast<Eigen::Index>(nmotors_), static_cast<Eigen::Index>(batchSize));
+        returnCodes_.assign(batchSize, hresult_t::SUCCESS);
+
+        // Create the engines, each of them forwarding its own column of actions as command
+        hresult_t returnCode = hresult_t::SUCCESS;
+        engines_.reserve(batchSize);
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            Eigen::Index const engineIdx = static_cast<Eigen::Index>(i);
+            auto commandFct = [this, engineIdx](float64_t        const & /* t */,
+                                                vectorN_t        const & /* q */,
+                                                vectorN_t        const & /* v */,
+                                                sensorsDataMap_t const & /* sensorsData */,
+                                                vectorN_t              & command)
+                              {
+                                  command = actions_.col(engineIdx);
+                              };
+            auto internalDynamicsFct = [](float64_t        const & /* t */,
+                                          vectorN_t        const & /* q */,
+                                          vectorN_t        const & /* v */,
+                                          sensorsDataMap_t const & /* sensorsData */,
+                                          vectorN_t              & /* uCustom */) {};
+            auto controller = std::make_shared<ControllerFunctor<
+                decltype(commandFct), decltype(internalDynamicsFct)> >(commandFct, internalDynamicsFct);
+            auto callbackFct = [](float64_t const & /* t */,
+                                  vectorN_t const & /* q */,
+                                  vectorN_t const & /* v */) -> bool_t
+                               {
+                                   return true;
+                               };
+
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                returnCode = controller->initialize(robots[i]);
+            }
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                auto engine = std::make_shared<Engine>();
+                returnCode = engine->initialize(robots[i], controller, std::move(callbackFct));
+                engines_.push_back(std::move(engine));
+            }
+        }
+
+        // Create the thread pool
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            pool_ = std::make_unique<ThreadPool>(threadsNum);
+            isInitialized_ = true;
+        }
+        else
+        {
+            engines_.clear();
+        }
+
+        return returnCode;
+    }
+
+    hresult_t EngineBatch::setOptions(configHolder_t const & engineOptions)
+    {
+        hresult_t returnCode = hresult_t::SUCCESS;
+
+        if (!isInitialized_)
+        {
+            PRINT_ERROR("Engine batch not initialized.");
+            returnCode = hresult_t::ERROR_INIT_FAILED;
+        }
+
+        /* Derive a distinct seed for every engine, otherwise they would all draw the same
+           random numbers. The golden ratio increment is odd, so the seeds of the engines
+           are all different, and the first engine keeps the user-specified seed. */
+        configHolder_t engineOptionsCopy = engineOptions;
+        uint32_t const seed = boost::get<uint32_t>(
+            boost::get<configHolder_t>(engineOptions.at("stepper")).at("randomSeed"));
+        uint32_t & engineSeed = boost::get<uint32_t>(
+            boost::get<configHolder_t>(engineOptionsCopy.at("stepper")).at("randomSeed"));
+        for (std::size_t i = 0; i < engines_.size(); ++i)
+        {
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                engineSeed = seed + static_cast<uint32_t>(i) * 0x9E3779B9U;
+                returnCode = engines_[i]->setOptions(engineOptionsCopy);
+            }
+        }
+
+        return returnCode;
+    }
+
+    configHolder_t EngineBatch::getOptions(void) const
+    {
+        /* The options are shared by all the engines, except for the random seed, so return
+           those of the first one, whose seed is the user-specified one. */
+        if (engines_.empty())
+        {
+            return {};
+        }
+        return engines_[0]->getOptions();
+    }
+
+    hresult_t EngineBatch::checkBatchInput(matrixN_t    const & data,
+                                           Eigen::Index const & cols,
+                                           std::string  const & name) const
+    {
+        if (data.rows() != static_cast<Eigen::Index>(engines_.size()) || data.cols() != cols)
+        {
+            PRINT_ERROR("'", name, "' must have shape (", engines_.size(), ", ", cols, ").");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+        return hresult_t::SUCCESS;
+    }
+
+    hresult_t EngineBatch::gatherReturnCodes(void) const
+    {
+        for (hresult_t const & returnCode : returnCodes_)
+        {
+            if (returnCode != hresult_t::SUCCESS)
+            {
+                return returnCode;
+            }
+        }
+        return hresult_t::SUCCESS;
+    }
+
+    hresult_t EngineBatch::start(matrixN_t const & qInit,
+                                 matrixN_t const & vInit)
+    {
+        std::vector<bool_t> const mask(engines_.size(), true);
+        return resetBatch(mask, qInit, vInit);
+    }
+
+    hresult_t EngineBatch::resetBatch(std::vector<bool_t> const & mask,
+                                      matrixN_t           const & qInit,
+                                      matrixN_t           const & vInit)
+    {
+        hresult_t returnCode = hresult_t::SUCCESS;
+
+        if (!isInitialized_)
+        {
+            PRINT_ERROR("Engine batch not initialized.");
+            returnCode = hresult_t::ERROR_INIT_FAILED;
+        }
+
+        // Check the input arguments
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            if (mask.size() != engines_.size())
+            {
+                PRINT_ERROR("The size of 'mask' must match the batch size.");
+                returnCode = hresult_t::ERROR_BAD_INPUT;
+            }
+        }
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            returnCode = checkBatchInput(qInit, nq_, "qInit");
+        }
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            returnCode = checkBatchInput(vInit, nv_, "vInit");
+        }
+
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            /* Reset the engines sequentially, then start the simulations in parallel.
+               The random number generators are owned by the engines and their robots,
+               so that they do not interfere. The actions are reset to zero. */
+            for (std::size_t i = 0; i < engines_.size(); ++i)
+            {
+                if (mask[i])
+                {
+                    engines_[i]->reset(false, false);
+                    actions_.col(static_cast<Eigen::Index>(i)).setZero();
+                }
+            }
+            pool_->parallelFor(engines_.size(),
+                [this, &mask, &qInit, &vInit](std::size_t const & i)
+                {
+                    if (mask[i])
+                    {
+                        Eigen::Index const engineIdx = static_cast<Eigen::Index>(i);
+                        returnCodes_[i] = engines_[i]->start(
+                            qInit.row(engineIdx).transpose(), vInit.row(engineIdx).transpose());
+                    }
+                });
+            returnCode = gatherReturnCodes();
+        }
+
+        return returnCode;
+    }
+
+    hresult_t EngineBatch::stepBatch(matrixN_t const & actions,
+                                     float64_t const & stepSize)
+    {
+        hresult_t returnCode = hresult_t::SUCCESS;
+
+        if (!isInitialized_)
+        {
+            PRINT_ERROR("Engine batch not initialized.");
+            returnCode = hresult_t::ERROR_INIT_FAILED;
+        }
+
+        // Check and update the actions
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            returnCode = checkBatchInput(actions, static_cast<Eigen::Index>(nmotors_), "actions");
+        }
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            actions_ = actions.transpose();
+        }
+
+        // Integrate every running engine in parallel
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            pool_->parallelFor(engines_.size(),
+                [this, &stepSize](std::size_t const & i)
+                {
+                    Engine & engine = *engines_[i];
+                    if (!engine.getIsSimulationRunning())
+                    {
+                        returnCodes_[i] = hresult_t::ERROR_GENERIC;
+                        return;
+                    }
+                    returnCodes_[i] = engine.step(stepSize);
+                    if (returnCodes_[i] != hresult_t::SUCCESS)
+                    {
+                        engine.stop();
+                    }
+                });
+            returnCode = gatherReturnCodes();
+        }
+
+        return returnCode;
+    }
+
+    void EngineBatch::stop(void)
+    {
+        for (std::shared_ptr<Engine> & engine : engines_)
+        {
+            if (engine->getIsSimulationRunning())
+            {
+                engine->stop();
+            }
+        }
+    }
+
+    std::size_t EngineBatch::getBatchSize(void) const
+    {
+        return engines_.size();
+    }
+
+    hresult_t EngineBatch::getEngine(std::size_t             const & engineIdx,
+                                     std::shared_ptr<Engine>       & engine)
+    {
+        if (engineIdx >= engines_.size())
+        {
+            PRINT_ERROR("Engine index out of range.");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+        engine = engines_[engineIdx];
+        return hresult_t::SUCCESS;
+    }
+
+    std::vector<hresult_t> const & EngineBatch::getReturnCodes(void) const
+    {
+        return returnCodes_;
+    }
+
+    bool_t const & EngineBatch::getIsInitialized(void) const
+    {
+        return isInitialized_;
+    }
+}
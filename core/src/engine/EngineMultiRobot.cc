@@ -1,6 +1,6 @@
 #include <cmath>
 #include <ctime>
-#include <unordered_set>
+#include <numeric>
 #include <algorithm>
 #include <iostream>
 #include <sstream>
@@ -17,12 +17,13 @@
 #include "pinocchio/multibody/joint/joint-model-base.hpp"   // `pinocchio::JointModelBase`
 #include "pinocchio/algorithm/center-of-mass.hpp"           // `pinocchio::getComFromCrba`
 #include "pinocchio/algorithm/frames.hpp"                   // `pinocchio::getFrameVelocity`
-#include "pinocchio/algorithm/jacobian.hpp"                 // `pinocchio::getJointJacobian`
+#include "pinocchio/algorithm/jacobian.hpp"                 // `pinocchio::computeJointJacobians`
 #include "pinocchio/algorithm/energy.hpp"                   // `pinocchio::computePotentialEnergy`
 #include "pinocchio/algorithm/joint-configuration.hpp"      // `pinocchio::normalize`
 #include "pinocchio/algorithm/geometry.hpp"                 // `pinocchio::computeCollisions`
 
 #include "H5Cpp.h"
+#include "zlib.h"
 #include "json/json.h"
 
 #include "jiminy/core/io/FileDevice.h"
@@ -30,6 +31,7 @@
 #include "jiminy/core/telemetry/TelemetryData.h"
 #include "jiminy/core/telemetry/TelemetryRecorder.h"
 #include "jiminy/core/robot/PinocchioOverloadAlgorithms.h"
+#include "jiminy/core/robot/DynamicsBackend.h"
 #include "jiminy/core/robot/AbstractMotor.h"
 #include "jiminy/core/robot/AbstractSensor.h"
 #include "jiminy/core/constraints/AbstractConstraint.h"
@@ -41,11 +43,16 @@
 #include "jiminy/core/solver/ConstraintSolvers.h"
 #include "jiminy/core/stepper/AbstractStepper.h"
 #include "jiminy/core/stepper/EulerExplicitStepper.h"
+#include "jiminy/core/stepper/EulerSemiImplicitStepper.h"
+#include "jiminy/core/stepper/EulerLinearImplicitStepper.h"
 #include "jiminy/core/stepper/RungeKuttaDOPRIStepper.h"
 #include "jiminy/core/stepper/RungeKutta4Stepper.h"
 #include "jiminy/core/engine/EngineMultiRobot.h"
 #include "jiminy/core/utilities/Pinocchio.h"
 #include "jiminy/core/utilities/Random.h"
+#include "jiminy/core/utilities/GridHeightmap.h"
+#include "jiminy/core/utilities/ThreadPool.h"
+#include "jiminy/core/utilities/StateArchive.h"
 #include "jiminy/core/utilities/Json.h"
 #include "jiminy/core/utilities/Helpers.h"
 #include "jiminy/core/Constants.h"
@@ -65,8 +72,14 @@ namespace jiminy
     telemetryData_(nullptr),
     telemetryRecorder_(nullptr),
     stepper_(),
+    threadPool_(nullptr),
+    generator_(),
     stepperUpdatePeriod_(INF),
+    stepperBreakPeriod_(INF),
     stepperState_(),
+    collisionWorld_(),
+    denseOutputState_(),
+    denseOutputStateDerivative_(),
     systemsDataHolder_(),
     forcesCoupling_(),
     contactForcesPrev_(),
@@ -146,6 +159,9 @@ namespace jiminy
                               std::move(callbackFct));
         systemsDataHolder_.resize(systems_.size());
 
+        // Assign an independent random number stream to the robot
+        robot->generator_ = generator_.split(static_cast<uint32_t>(systems_.size()));
+
         return hresult_t::SUCCESS;
     }
 
@@ -738,124 +754,164 @@ namespace jiminy
         return returnCode;
     }
 
-    hresult_t EngineMultiRobot::configureTelemetry(void)
+    hresult_t EngineMultiRobot::registerTelemetryVariables(void)
     {
         hresult_t returnCode = hresult_t::SUCCESS;
 
-        if (systems_.empty())
-        {
-            PRINT_ERROR("No system added to the engine.");
-            returnCode = hresult_t::ERROR_INIT_FAILED;
-        }
-
-        if (!isTelemetryConfigured_)
+        auto systemIt = systems_.begin();
+        auto systemDataIt = systemsDataHolder_.begin();
+        for ( ; systemIt != systems_.end(); ++systemIt, ++systemDataIt)
         {
-            auto systemIt = systems_.begin();
-            auto systemDataIt = systemsDataHolder_.begin();
-            for ( ; systemIt != systems_.end(); ++systemIt, ++systemDataIt)
+            // Generate the log fieldnames
+            systemDataIt->logFieldnamesPosition =
+                addCircumfix(systemIt->robot->getLogFieldnamesPosition(),
+                             systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
+            systemDataIt->logFieldnamesVelocity =
+                addCircumfix(systemIt->robot->getLogFieldnamesVelocity(),
+                             systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
+            systemDataIt->logFieldnamesAcceleration =
+                addCircumfix(systemIt->robot->getLogFieldnamesAcceleration(),
+                             systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
+            systemDataIt->logFieldnamesForceExternal =
+                addCircumfix(systemIt->robot->getLogFieldnamesForceExternal(),
+                             systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
+            systemDataIt->logFieldnamesCommand =
+                addCircumfix(systemIt->robot->getCommandFieldnames(),
+                             systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
+            systemDataIt->logFieldnamesMotorEffort =
+                addCircumfix(systemIt->robot->getMotorEffortFieldnames(),
+                             systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
+            systemDataIt->logFieldnameEnergy =
+                addCircumfix("energy",
+                             systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
+            systemDataIt->logFieldnameConstraintSolverIter =
+                addCircumfix("constraintSolverIter",
+                             systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
+
+            // Register variables to the telemetry senders
+            if (returnCode == hresult_t::SUCCESS)
             {
-                // Generate the log fieldnames
-                systemDataIt->logFieldnamesPosition =
-                    addCircumfix(systemIt->robot->getLogFieldnamesPosition(),
-                                 systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
-                systemDataIt->logFieldnamesVelocity =
-                    addCircumfix(systemIt->robot->getLogFieldnamesVelocity(),
-                                 systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
-                systemDataIt->logFieldnamesAcceleration =
-                    addCircumfix(systemIt->robot->getLogFieldnamesAcceleration(),
-                                 systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
-                systemDataIt->logFieldnamesForceExternal =
-                    addCircumfix(systemIt->robot->getLogFieldnamesForceExternal(),
-                                 systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
-                systemDataIt->logFieldnamesCommand =
-                    addCircumfix(systemIt->robot->getCommandFieldnames(),
-                                 systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
-                systemDataIt->logFieldnamesMotorEffort =
-                    addCircumfix(systemIt->robot->getMotorEffortFieldnames(),
-                                 systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
-                systemDataIt->logFieldnameEnergy =
-                    addCircumfix("energy",
-                                 systemIt->name, "", TELEMETRY_FIELDNAME_DELIMITER);
-
-                // Register variables to the telemetry senders
-                if (returnCode == hresult_t::SUCCESS)
+                if (engineOptions_->telemetry.enableConfiguration)
                 {
-                    if (engineOptions_->telemetry.enableConfiguration)
-                    {
-                        returnCode = telemetrySender_.registerVariable(
-                            systemDataIt->logFieldnamesPosition,
-                            systemDataIt->state.q);
-                    }
+                    returnCode = telemetrySender_.registerVariable(
+                        systemDataIt->logFieldnamesPosition,
+                        systemDataIt->state.q,
+                        systemDataIt->logHandlePosition);
                 }
-                if (returnCode == hresult_t::SUCCESS)
+            }
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                if (engineOptions_->telemetry.enableVelocity)
                 {
-                    if (engineOptions_->telemetry.enableVelocity)
-                    {
-                        returnCode = telemetrySender_.registerVariable(
-                            systemDataIt->logFieldnamesVelocity,
-                            systemDataIt->state.v);
-                    }
+                    returnCode = telemetrySender_.registerVariable(
+                        systemDataIt->logFieldnamesVelocity,
+                        systemDataIt->state.v,
+                        systemDataIt->logHandleVelocity);
                 }
-                if (returnCode == hresult_t::SUCCESS)
+            }
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                if (engineOptions_->telemetry.enableAcceleration)
                 {
-                    if (engineOptions_->telemetry.enableAcceleration)
-                    {
-                        returnCode = telemetrySender_.registerVariable(
-                            systemDataIt->logFieldnamesAcceleration,
-                            systemDataIt->state.a);
-                    }
+                    returnCode = telemetrySender_.registerVariable(
+                        systemDataIt->logFieldnamesAcceleration,
+                        systemDataIt->state.a,
+                        systemDataIt->logHandleAcceleration);
                 }
+            }
+            if (returnCode == hresult_t::SUCCESS)
+            {
                 if (engineOptions_->telemetry.enableForceExternal)
                 {
-                    for (std::size_t i = 1; i < systemDataIt->state.fExternal.size(); ++i)
-                    {
-                        auto const & fext = systemDataIt->state.fExternal[i].toVector();
-                        for (uint8_t j = 0; j < 6U; ++j)
-                        {
-                            returnCode = telemetrySender_.registerVariable(
-                                systemDataIt->logFieldnamesForceExternal[(i - 1) * 6U + j],
-                                fext[j]);
-                        }
-                    }
-                }
-                if (returnCode == hresult_t::SUCCESS)
-                {
-                    if (engineOptions_->telemetry.enableCommand)
+                    // Concatenate the external forces applied on every joints, 'universe' excluded
+                    forceVector_t const & fext = systemDataIt->state.fExternal;
+                    vectorN_t fextInit(6U * (fext.size() - 1));
+                    for (std::size_t i = 1; i < fext.size(); ++i)
                     {
-                        returnCode = telemetrySender_.registerVariable(
-                            systemDataIt->logFieldnamesCommand,
-                            systemDataIt->state.command);
+                        fextInit.segment<6>(6U * (i - 1)) = fext[i].toVector();
                     }
+                    returnCode = telemetrySender_.registerVariable(
+                        systemDataIt->logFieldnamesForceExternal,
+                        fextInit,
+                        systemDataIt->logHandleForceExternal);
                 }
-                if (returnCode == hresult_t::SUCCESS)
+            }
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                if (engineOptions_->telemetry.enableCommand)
                 {
-                    if (engineOptions_->telemetry.enableMotorEffort)
-                    {
-                        returnCode = telemetrySender_.registerVariable(
-                            systemDataIt->logFieldnamesMotorEffort,
-                            systemDataIt->state.uMotor);
-                    }
+                    returnCode = telemetrySender_.registerVariable(
+                        systemDataIt->logFieldnamesCommand,
+                        systemDataIt->state.command,
+                        systemDataIt->logHandleCommand);
                 }
-                if (returnCode == hresult_t::SUCCESS)
+            }
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                if (engineOptions_->telemetry.enableMotorEffort)
                 {
-                    if (engineOptions_->telemetry.enableEnergy)
-                    {
-                        returnCode = telemetrySender_.registerVariable(
-                            systemDataIt->logFieldnameEnergy, 0.0);
-                    }
+                    returnCode = telemetrySender_.registerVariable(
+                        systemDataIt->logFieldnamesMotorEffort,
+                        systemDataIt->state.uMotor,
+                        systemDataIt->logHandleMotorEffort);
                 }
-
-                if (returnCode == hresult_t::SUCCESS)
+            }
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                if (engineOptions_->telemetry.enableEnergy)
                 {
-                    returnCode = systemIt->controller->configureTelemetry(
-                        telemetryData_, systemIt->name);
+                    returnCode = telemetrySender_.registerVariable(
+                        systemDataIt->logFieldnameEnergy, 0.0,
+                        systemDataIt->logHandleEnergy);
                 }
-                if (returnCode == hresult_t::SUCCESS)
+            }
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                if (engineOptions_->telemetry.enableConstraintSolverIter)
                 {
-                    returnCode = systemIt->robot->configureTelemetry(
-                        telemetryData_, systemIt->name);
+                    returnCode = telemetrySender_.registerVariable(
+                        systemDataIt->logFieldnameConstraintSolverIter, int64_t(0),
+                        systemDataIt->logHandleConstraintSolverIter);
                 }
             }
+
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                returnCode = systemIt->controller->configureTelemetry(
+                    telemetryData_, systemIt->name);
+            }
+            if (returnCode == hresult_t::SUCCESS)
+            {
+                returnCode = systemIt->robot->configureTelemetry(
+                    telemetryData_, systemIt->name);
+            }
+        }
+
+        return returnCode;
+    }
+
+    hresult_t EngineMultiRobot::configureTelemetry(void)
+    {
+        hresult_t returnCode = hresult_t::SUCCESS;
+
+        if (systems_.empty())
+        {
+            PRINT_ERROR("No system added to the engine.");
+            returnCode = hresult_t::ERROR_INIT_FAILED;
+        }
+
+        if (returnCode == hresult_t::SUCCESS && !isTelemetryConfigured_)
+        {
+            /* Recycle the telemetry of the previous simulation if exactly the same variables
+               are registered, so that neither the buffers nor the header are generated again.
+               Otherwise, start over from scratch. */
+            bool_t const isRecycling = telemetryData_->rewind();
+            returnCode = registerTelemetryVariables();
+            if (isRecycling && (returnCode != hresult_t::SUCCESS || !telemetryData_->getIsRecycled()))
+            {
+                telemetryData_->reset();
+                returnCode = registerTelemetryVariables();
+            }
         }
 
         if (returnCode == hresult_t::SUCCESS)
@@ -885,45 +941,52 @@ namespace jiminy
             // Update telemetry values
             if (engineOptions_->telemetry.enableConfiguration)
             {
-                telemetrySender_.updateValue(systemDataIt->logFieldnamesPosition,
+                telemetrySender_.updateValue(systemDataIt->logHandlePosition,
                                              systemDataIt->state.q);
             }
             if (engineOptions_->telemetry.enableVelocity)
             {
-                telemetrySender_.updateValue(systemDataIt->logFieldnamesVelocity,
+                telemetrySender_.updateValue(systemDataIt->logHandleVelocity,
                                              systemDataIt->state.v);
             }
             if (engineOptions_->telemetry.enableAcceleration)
             {
-                telemetrySender_.updateValue(systemDataIt->logFieldnamesAcceleration,
+                telemetrySender_.updateValue(systemDataIt->logHandleAcceleration,
                                              systemDataIt->state.a);
             }
             if (engineOptions_->telemetry.enableForceExternal)
             {
-                for (std::size_t i = 1; i < systemDataIt->state.fExternal.size(); ++i)
+                forceVector_t const & fext = systemDataIt->state.fExternal;
+                for (std::size_t i = 1; i < fext.size(); ++i)
                 {
-                    auto const & fext = systemDataIt->state.fExternal[i].toVector();
-                    for (uint8_t j = 0; j < 6U; ++j)
-                    {
-                        telemetrySender_.updateValue(
-                            systemDataIt->logFieldnamesForceExternal[(i - 1) * 6U + j],
-                            fext[j]);
-                    }
+                    telemetrySender_.updateValue(
+                        systemDataIt->logHandleForceExternal.segment(6U * (i - 1), 6U),
+                        fext[i].toVector());
                 }
             }
             if (engineOptions_->telemetry.enableCommand)
             {
-                telemetrySender_.updateValue(systemDataIt->logFieldnamesCommand,
+                telemetrySender_.updateValue(systemDataIt->logHandleCommand,
                                              systemDataIt->state.command);
             }
             if (engineOptions_->telemetry.enableMotorEffort)
             {
-                telemetrySender_.updateValue(systemDataIt->logFieldnamesMotorEffort,
+                telemetrySender_.updateValue(systemDataIt->logHandleMotorEffort,
                                              systemDataIt->state.uMotor);
             }
             if (engineOptions_->telemetry.enableEnergy)
             {
-                telemetrySender_.updateValue(systemDataIt->logFieldnameEnergy, energy);
+                telemetrySender_.updateValue(systemDataIt->logHandleEnergy, energy);
+            }
+            if (engineOptions_->telemetry.enableConstraintSolverIter)
+            {
+                // Number of iterations of the last solve, zero if there is no solver
+                int64_t iterNum = 0;
+                if (systemDataIt->constraintSolver)
+                {
+                    iterNum = static_cast<int64_t>(systemDataIt->constraintSolver->getIterNum());
+                }
+                telemetrySender_.updateValue(systemDataIt->logHandleConstraintSolverIter, iterNum);
             }
 
             systemIt->controller->updateTelemetry();
@@ -964,7 +1027,7 @@ namespace jiminy
         // Reset the random number generators
         if (resetRandomNumbers)
         {
-            resetRandomGenerators(engineOptions_->stepper.randomSeed);
+            seedRandomGenerators(engineOptions_->stepper.randomSeed);
         }
 
         // Reset the internal state of the robot and controller
@@ -984,6 +1047,105 @@ namespace jiminy
         isTelemetryConfigured_ = false;
     }
 
+    template<typename ...Args>
+    std::tuple<bool_t, float64_t> isGcdIncluded(vector_aligned_t<systemDataHolder_t> const & systemsDataHolder,
+                                                Args... values)
+    {
+        if (systemsDataHolder.empty())
+        {
+            return isGcdIncluded(std::forward<Args>(values)...);
+        }
+
+        float64_t minValue = INF;
+        auto lambda = [&minValue, &values...](systemDataHolder_t const & systemData)
+        {
+            bool_t isIncluded; float64_t value;
+            std::tie(isIncluded, value) = isGcdIncluded(
+                systemData.forcesProfile.begin(),
+                systemData.forcesProfile.end(),
+                [](forceProfile_t const & force) { return force.updatePeriod; },
+                std::forward<Args>(values)...);
+            minValue = minClipped(minValue, value);
+            return isIncluded;
+        };
+        return {std::all_of(systemsDataHolder.begin(), systemsDataHolder.end(), lambda), minValue};
+    }
+
+    std::unique_ptr<AbstractStepper> createStepper(EngineMultiRobot::stepperOptions_t const & stepperOptions,
+                                                   systemDynamics                     const & f,
+                                                   systemLinearization                const & linearization,
+                                                   std::vector<Robot const *>         const & robots)
+    {
+        if (stepperOptions.odeSolver == "runge_kutta_dopri5")
+        {
+            return std::make_unique<RungeKuttaDOPRIStepper>(
+                f, robots, stepperOptions.tolAbs, stepperOptions.tolRel);
+        }
+        else if (stepperOptions.odeSolver == "runge_kutta_4")
+        {
+            return std::make_unique<RungeKutta4Stepper>(f, robots);
+        }
+        else if (stepperOptions.odeSolver == "euler_explicit")
+        {
+            return std::make_unique<EulerExplicitStepper>(f, robots);
+        }
+        else if (stepperOptions.odeSolver == "euler_semi_implicit")
+        {
+            return std::make_unique<EulerSemiImplicitStepper>(f, robots);
+        }
+        return std::make_unique<EulerLinearImplicitStepper>(f, linearization, robots);
+    }
+
+    /// \brief Split the systems in groups connected by coupling forces, ie the connected
+    ///        components of the graph whose vertices are the systems and edges the couplings.
+    std::vector<systemsGroup_t> computeSystemsGroups(std::size_t             const & systemsNum,
+                                                     forceCouplingRegister_t const & forcesCoupling)
+    {
+        // Union-find with path halving
+        std::vector<std::size_t> parents(systemsNum);
+        std::iota(parents.begin(), parents.end(), 0U);
+        auto findRoot = [&parents](std::size_t i)
+        {
+            while (parents[i] != i)
+            {
+                parents[i] = parents[parents[i]];
+                i = parents[i];
+            }
+            return i;
+        };
+        for (forceCoupling_t const & forceCoupling : forcesCoupling)
+        {
+            std::size_t const root1 = findRoot(static_cast<std::size_t>(forceCoupling.systemIdx1));
+            std::size_t const root2 = findRoot(static_cast<std::size_t>(forceCoupling.systemIdx2));
+            parents[std::max(root1, root2)] = std::min(root1, root2);
+        }
+
+        // Gather the systems and couplings of each group, ordered by their first system
+        std::vector<systemsGroup_t> groups;
+        std::vector<std::size_t> groupsIdx(systemsNum);
+        for (std::size_t i = 0; i < systemsNum; ++i)
+        {
+            std::size_t const root = findRoot(i);
+            if (root == i)
+            {
+                groupsIdx[i] = groups.size();
+                groups.emplace_back();
+            }
+            else
+            {
+                groupsIdx[i] = groupsIdx[root];
+            }
+            groups[groupsIdx[i]].systemsIdx.push_back(i);
+        }
+        for (std::size_t i = 0; i < forcesCoupling.size(); ++i)
+        {
+            std::size_t const & systemIdx = static_cast<std::size_t>(forcesCoupling[i].systemIdx1);
+            groups[groupsIdx[systemIdx]].couplingsIdx.push_back(i);
+        }
+
+        return groups;
+    }
+
     void computeExtraTerms(systemHolder_t           & system,
                            systemDataHolder_t const & /* systemData */)
     {
@@ -1276,6 +1438,23 @@ namespace jiminy
             systemDataIt->statePrev.initialize(*(systemIt->robot));
         }
 
+        /* Instantiate the thread pool used to compute the dynamics of the systems
+           concurrently if requested. It is pointless with a single system. */
+        uint32_t threadsNum = engineOptions_->stepper.threadsNum;
+        if (threadsNum == 0U)
+        {
+            threadsNum = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+        threadsNum = std::min(threadsNum, static_cast<uint32_t>(systems_.size()));
+        if (threadsNum > 1U)
+        {
+            threadPool_ = std::make_unique<ThreadPool>(threadsNum);
+        }
+        else
+        {
+            threadPool_.reset();
+        }
+
         // Initialize the ode solver
         auto systemOde = [this](float64_t              const & t,
                                 std::vector<vectorN_t> const & q,
@@ -1284,6 +1463,15 @@ namespace jiminy
                          {
                              this->computeSystemsDynamics(t, q, v, a);
                          };
+        auto systemLinearization = [this](float64_t              const & t,
+                                          std::vector<vectorN_t> const & q,
+                                          std::vector<vectorN_t> const & v,
+                                          std::vector<matrixN_t>       & mass,
+                                          std::vector<matrixN_t>       & stiffness,
+                                          std::vector<matrixN_t>       & damping) -> void
+                                   {
+                                       this->computeSystemsLinearization(t, q, v, mass, stiffness, damping);
+                                   };
         std::vector<Robot const *> robots;
         robots.reserve(systems_.size());
         std::transform(systems_.begin(), systems_.end(),
@@ -1292,28 +1480,83 @@ namespace jiminy
                         {
                             return sys.robot.get();
                         });
-        if (engineOptions_->stepper.odeSolver == "runge_kutta_dopri5")
-        {
-            stepper_ = std::unique_ptr<AbstractStepper>(
-                new RungeKuttaDOPRIStepper(systemOde,
-                                           robots,
-                                           engineOptions_->stepper.tolAbs,
-                                           engineOptions_->stepper.tolRel));
-        }
-        else if (engineOptions_->stepper.odeSolver == "runge_kutta_4")
-        {
-            stepper_ = std::unique_ptr<AbstractStepper>(
-                new RungeKutta4Stepper(systemOde, robots));
-        }
-        else if (engineOptions_->stepper.odeSolver == "euler_explicit")
+        stepper_ = createStepper(engineOptions_->stepper, systemOde, systemLinearization, robots);
+
+        // Register the collision bodies of every system in the collision world
+        returnCode = collisionWorld_.initialize(robots,
+                                                engineOptions_->contacts.enableSelfCollisions,
+                                                engineOptions_->contacts.enableSystemsCollisions);
+        if (returnCode != hresult_t::SUCCESS)
         {
-            stepper_ = std::unique_ptr<AbstractStepper>(
-                new EulerExplicitStepper(systemOde, robots));
+            return returnCode;
         }
 
         // Initialize the stepper state
         float64_t const t = 0.0;
-        stepperState_.reset(SIMULATION_MIN_TIMESTEP, qSplit, vSplit, aSplit);
+        stepperState_.reset(SIMULATION_MIN_TIMESTEP, robots, qSplit, vSplit, aSplit);
+
+        /* Only the discontinuous events, namely the update of the controller and of the
+           force profiles, must be breakpoints of the integration if the stepper provides
+           dense output. The sensors and the telemetry are interpolated in between. */
+        stepperBreakPeriod_ = stepperUpdatePeriod_;
+        if (engineOptions_->stepper.useDenseOutput && stepper_->hasDenseOutput())
+        {
+            stepperBreakPeriod_ = std::get<1>(isGcdIncluded(
+                systemsDataHolder_, engineOptions_->stepper.controllerUpdatePeriod));
+            denseOutputState_ = state_t(robots);
+            denseOutputStateDerivative_ = stateDerivative_t(robots);
+        }
+
+        /* Integrate independently every group of systems that are not coupled together
+           if requested. They are synchronized at every breakpoint, so that it is only
+           supported in discrete mode. It is pointless with a single group. The collisions
+           between bodies may couple any systems, so it is not supported along with them. */
+        systemsGroups_.clear();
+        if (engineOptions_->stepper.multiRate && std::isfinite(stepperUpdatePeriod_)
+         && collisionWorld_.getIsEmpty())
+        {
+            systemsGroups_ = computeSystemsGroups(systems_.size(), forcesCoupling_);
+            if (systemsGroups_.size() < 2U)
+            {
+                systemsGroups_.clear();
+            }
+        }
+        for (systemsGroup_t & group : systemsGroups_)
+        {
+            std::vector<Robot const *> groupRobots;
+            std::vector<vectorN_t> groupQSplit, groupVSplit, groupASplit;
+            for (std::size_t const & systemIdx : group.systemsIdx)
+            {
+                groupRobots.push_back(robots[systemIdx]);
+                groupQSplit.push_back(qSplit[systemIdx]);
+                groupVSplit.push_back(vSplit[systemIdx]);
+                groupASplit.push_back(aSplit[systemIdx]);
+            }
+            systemsGroup_t const * const groupPtr = &group;
+            auto groupOde = [this, groupPtr](float64_t              const & t,
+                                             std::vector<vectorN_t> const & q,
+                                             std::vector<vectorN_t> const & v,
+                                             std::vector<vectorN_t>       & a) -> void
+                            {
+                                this->computeGroupDynamics(*groupPtr, t, q, v, a);
+                            };
+            auto groupLinearization = [this, groupPtr](float64_t              const & /* t */,
+                                                       std::vector<vectorN_t> const & q,
+                                                       std::vector<vectorN_t> const & v,
+                                                       std::vector<matrixN_t>       & mass,
+                                                       std::vector<matrixN_t>       & stiffness,
+                                                       std::vector<matrixN_t>       & damping) -> void
+                                      {
+                                          this->computeGroupLinearization(*groupPtr, q, v, mass, stiffness, damping);
+                                      };
+            group.stepper = createStepper(engineOptions_->stepper, groupOde, groupLinearization, groupRobots);
+            group.stepperState.reset(SIMULATION_MIN_TIMESTEP, groupRobots, groupQSplit, groupVSplit, groupASplit);
+        }
+        if (!systemsGroups_.empty())
+        {
+            // The systems are not all at the same time within a step, so the dense output is not supported
+            stepperBreakPeriod_ = stepperUpdatePeriod_;
+        }
 
         // Initialize previous joints forces and accelerations
         contactForcesPrev_.clear();
@@ -1385,7 +1628,8 @@ namespace jiminy
             vectorN_t const & q = systemDataIt->state.q;
             vectorN_t const & v = systemDataIt->state.v;
             vectorN_t const & a = systemDataIt->state.a;
-            computeForwardKinematics(*systemIt, q, v, a);
+            systemDataIt->kinematicsPlan.initialize(*systemIt->robot);
+            computeForwardKinematics(*systemIt, systemDataIt->kinematicsPlan, q, v, a);
 
             /* Backup constraint register for fast lookup.
                Internal constraints cannot be added/removed at this point. */
@@ -1395,6 +1639,12 @@ namespace jiminy
             std::vector<frameIndex_t> const & contactFramesIdx = systemIt->robot->getContactFramesIdx();
             systemDataIt->contactFramesForces = forceVector_t(
                 contactFramesIdx.size(), pinocchio::Force::Zero());
+            Eigen::Index const contactFramesNum = static_cast<Eigen::Index>(contactFramesIdx.size());
+            systemDataIt->contactFramesPositions.setZero(3, contactFramesNum);
+            systemDataIt->contactFramesGroundHeights.setZero(contactFramesNum);
+            systemDataIt->contactFramesGroundNormals.setZero(3, contactFramesNum);
+            systemDataIt->contactFrameJacobian.setZero(6, systemIt->robot->nv());
+            systemDataIt->contactJacobianNormal.setZero(systemIt->robot->nv());
             std::vector<std::vector<pairIndex_t> > const & collisionPairsIdx =
                 systemIt->robot->getCollisionPairsIdx();
             systemDataIt->collisionBodiesForces.clear();
@@ -1405,9 +1655,6 @@ namespace jiminy
                     collisionPairsIdx[i].size(), pinocchio::Force::Zero());
             }
 
-            // Initialize some addition buffers used by impulse contact solver
-            systemDataIt->jointJacobian.setZero(6, systemIt->robot->pncModel_.nv);
-
             // Reset the constraints
             returnCode = systemIt->robot->resetConstraints(q, v);
 
@@ -1455,12 +1702,18 @@ namespace jiminy
                 // Make sure that the contact forces are bounded for spring-damper model.
                 // TODO: One should rather use something like 10 * m * g instead of a fix threshold
                 float64_t forceMax = 0.0;
+                computeGroundAtContactFrames(*systemIt, *systemDataIt);
                 for (std::size_t i = 0; i < contactFramesIdx.size(); ++i)
                 {
+                    Eigen::Index const contactIdx = static_cast<Eigen::Index>(i);
                     auto & constraint = systemDataIt->constraintsHolder.contactFrames[i].second;
                     pinocchio::Force & fextLocal = systemDataIt->contactFramesForces[i];
-                    computeContactDynamicsAtFrame(
-                        *systemIt, contactFramesIdx[i], constraint, fextLocal);
+                    computeContactDynamicsAtFrame(*systemIt,
+                                                  contactFramesIdx[i],
+                                                  systemDataIt->contactFramesGroundHeights[contactIdx],
+                                                  systemDataIt->contactFramesGroundNormals.col(contactIdx),
+                                                  constraint,
+                                                  fextLocal);
                     forceMax = std::max(forceMax, fextLocal.linear().norm());
                 }
 
@@ -1519,6 +1772,28 @@ namespace jiminy
                         engineOptions_->stepper.tolRel,
                         PGS_MAX_ITERATIONS);
                         break;
+                case constraintSolver_t::BLOCK_PGS:
+                    systemDataIt->constraintSolver = std::make_unique<BlockPGSSolver>(
+                        &systemIt->robot->pncModel_,
+                        &systemIt->robot->pncData_,
+                        &systemDataIt->constraintsHolder,
+                        engineOptions_->contacts.friction,
+                        engineOptions_->contacts.torsion,
+                        engineOptions_->stepper.tolAbs,
+                        engineOptions_->stepper.tolRel,
+                        PGS_MAX_ITERATIONS);
+                        break;
+                case constraintSolver_t::ADMM:
+                    systemDataIt->constraintSolver = std::make_unique<ADMMSolver>(
+                        &systemIt->robot->pncModel_,
+                        &systemIt->robot->pncData_,
+                        &systemDataIt->constraintsHolder,
+                        engineOptions_->contacts.friction,
+                        engineOptions_->contacts.torsion,
+                        engineOptions_->stepper.tolAbs,
+                        engineOptions_->stepper.tolRel,
+                        ADMM_MAX_ITERATIONS);
+                        break;
                 case constraintSolver_t::NONE:
                 default:
                     break;
@@ -1632,8 +1907,12 @@ namespace jiminy
             configureTelemetry();
 
             // Log systems data
-            for (auto const & system : systems_)
+            auto systemIt = systems_.begin();
+            auto systemDataIt = systemsDataHolder_.begin();
+            for ( ; systemIt != systems_.end(); ++systemIt, ++systemDataIt)
             {
+                systemHolder_t const & system = *systemIt;
+
                 // Backup URDF file
                 std::string const telemetryUrdfFile = addCircumfix(
                     "urdf_file", system.name, "", TELEMETRY_FIELDNAME_DELIMITER);
@@ -1661,11 +1940,27 @@ namespace jiminy
                 }
                 telemetrySender_.registerConstant(telemetryMeshPackageDirs, meshPackageDirsString);
 
+                /* The serialization of the models is costly, so it is cached and only
+                   done again if the model has changed since the previous simulation. */
+                Robot const & robot = *system.robot;
+                bool_t const isModelLoggedOutdated =
+                    !(robot.pncModel_ == systemDataIt->pncModelLogged)
+                    || !(robot.collisionModel_ == systemDataIt->collisionModelLogged)
+                    || !(robot.visualModel_ == systemDataIt->visualModelLogged);
+                if (isModelLoggedOutdated)
+                {
+                    systemDataIt->pncModelLogged = robot.pncModel_;
+                    systemDataIt->pncModelBinary = saveToBinary(robot.pncModel_);
+                    systemDataIt->collisionModelBinary.clear();
+                    systemDataIt->visualModelBinary.clear();
+                    systemDataIt->collisionModelLogged = robot.collisionModel_;
+                    systemDataIt->visualModelLogged = robot.visualModel_;
+                }
+
                 // Backup the true and theoretical Pinocchio::Model
                 std::string key = addCircumfix(
                     "pinocchio_model", system.name, "", TELEMETRY_FIELDNAME_DELIMITER);
-                std::string value = saveToBinary(system.robot->pncModel_);
-                telemetrySender_.registerConstant(key, value);
+                telemetrySender_.registerConstant(key, systemDataIt->pncModelBinary);
 
                 /* Backup the Pinocchio GeometryModel for collisions and visuals.
                    It may fail because of missing serialization methods for convex,
@@ -1676,15 +1971,20 @@ namespace jiminy
                 {
                     try
                     {
+                        if (systemDataIt->collisionModelBinary.empty())
+                        {
+                            std::string visualModelBinary = saveToBinary(robot.visualModel_);
+                            systemDataIt->collisionModelBinary = saveToBinary(robot.collisionModel_);
+                            systemDataIt->visualModelBinary = std::move(visualModelBinary);
+                        }
+
                         key = addCircumfix(
                             "collision_model", system.name, "", TELEMETRY_FIELDNAME_DELIMITER);
-                        value = saveToBinary(system.robot->collisionModel_);
-                        telemetrySender_.registerConstant(key, value);
+                        telemetrySender_.registerConstant(key, systemDataIt->collisionModelBinary);
 
                         key = addCircumfix(
                             "visual_model", system.name, "", TELEMETRY_FIELDNAME_DELIMITER);
-                        value = saveToBinary(system.robot->visualModel_);
-                        telemetrySender_.registerConstant(key, value);
+                        telemetrySender_.registerConstant(key, systemDataIt->visualModelBinary);
                     }
                     catch (std::exception const & e)
                     {
@@ -1717,9 +2017,15 @@ namespace jiminy
             std::string const allOptionsString = Json::writeString(jsonWriter, allOptionsJson);
             telemetrySender_.registerConstant("options", allOptionsString);
 
-            // Write the header: this locks the registration of new variables
-            telemetryRecorder_->initialize(telemetryData_.get(), getTelemetryTimeUnit());
+            /* Write the header: this locks the registration of new variables.
+               In streaming mode, it also starts writing the log file in background. */
+            returnCode = telemetryRecorder_->initialize(
+                telemetryData_.get(), getTelemetryTimeUnit(),
+                engineOptions_->telemetry.streamingPath, engineOptions_->telemetry.maxInFlightChunks);
+        }
 
+        if (returnCode == hresult_t::SUCCESS)
+        {
             // At this point, consider that the simulation is running
             isSimulationRunning_ = true;
         }
@@ -1811,11 +2117,12 @@ namespace jiminy
                 break;
             }
 
-            // Perform a single integration step up to tEnd, stopping at stepperUpdatePeriod_ to log
+            /* Perform a single integration step up to tEnd, stopping at stepperBreakPeriod_.
+               It coincides with the logging period unless dense output is used. */
             float64_t stepSize;
-            if (std::isfinite(stepperUpdatePeriod_))
+            if (std::isfinite(stepperBreakPeriod_))
             {
-                stepSize = min(stepperUpdatePeriod_, tEnd - stepperState_.t);
+                stepSize = min(stepperBreakPeriod_, tEnd - stepperState_.t);
             }
             else
             {
@@ -1845,10 +2152,10 @@ namespace jiminy
         logData_ = nullptr;
 
         // Check if there is something wrong with the integration
-        auto qIt = stepperState_.qSplit.begin();
-        auto vIt = stepperState_.vSplit.begin();
-        auto aIt = stepperState_.aSplit.begin();
-        for ( ; qIt != stepperState_.qSplit.end(); ++qIt, ++vIt, ++aIt)
+        auto qIt = stepperState_.state.q.begin();
+        auto vIt = stepperState_.state.v.begin();
+        auto aIt = stepperState_.stateDerivative.a.begin();
+        for ( ; qIt != stepperState_.state.q.end(); ++qIt, ++vIt, ++aIt)
         {
             if ((qIt->array() != qIt->array()).any() ||
                 (vIt->array() != vIt->array()).any() ||
@@ -1913,9 +2220,11 @@ namespace jiminy
         float64_t & t = stepperState_.t;
         float64_t & dt = stepperState_.dt;
         float64_t & dtLargest = stepperState_.dtLargest;
-        std::vector<vectorN_t> & qSplit = stepperState_.qSplit;
-        std::vector<vectorN_t> & vSplit = stepperState_.vSplit;
-        std::vector<vectorN_t> & aSplit = stepperState_.aSplit;
+        state_t & state = stepperState_.state;
+        stateDerivative_t & stateDerivative = stepperState_.stateDerivative;
+        std::vector<vectorN_t> & qSplit = state.q;
+        std::vector<vectorN_t> & vSplit = state.v;
+        std::vector<vectorN_t> & aSplit = stateDerivative.a;
 
         // Monitor iteration failure
         uint32_t successiveIterFailed = 0;
@@ -2062,8 +2371,11 @@ namespace jiminy
                at the beginning of the next. Logging the previous acceleration is more
                natural since it preserves the consistency between sensors data and
                robot state.
+               The internal steps of the groups are not synchronized in multi-rate mode,
+               so only the breakpoints are logged even if the internal steps are requested.
                */
-            if (!std::isfinite(stepperUpdatePeriod_) || !engineOptions_->stepper.logInternalStepperSteps)
+            if (!std::isfinite(stepperUpdatePeriod_) || !engineOptions_->stepper.logInternalStepperSteps
+             || !systemsGroups_.empty())
             {
                 bool_t mustUpdateTelemetry = !std::isfinite(stepperUpdatePeriod_);
                 if (!mustUpdateTelemetry)
@@ -2095,14 +2407,14 @@ namespace jiminy
                    a breakpoint occurs if we reached tEnd, if an external force
                    is applied, or if we need to update the sensors / controller. */
                 float64_t dtNextGlobal;  // dt to apply for the next stepper step because of the various breakpoints
-                float64_t const dtNextUpdatePeriod = stepperUpdatePeriod_ - std::fmod(t, stepperUpdatePeriod_);
+                float64_t const dtNextUpdatePeriod = stepperBreakPeriod_ - std::fmod(t, stepperBreakPeriod_);
                 if (dtNextUpdatePeriod < SIMULATION_MIN_TIMESTEP)
                 {
                     /* Step to reach next sensors/controller update is too short:
                        skip one controller update and jump to the next one.
                        Note that in this case, the sensors have already been
                        updated in anticipation in previous loop. */
-                    dtNextGlobal = min(dtNextUpdatePeriod + stepperUpdatePeriod_,
+                    dtNextGlobal = min(dtNextUpdatePeriod + stepperBreakPeriod_,
                                        tForceImpulseNext - t);
                 }
                 else
@@ -2121,19 +2433,11 @@ namespace jiminy
                 // Update next dt
                 tNext += dtNextGlobal;
 
-                // Compute the next step using adaptive step method
-                while (tNext - t > STEPPER_MIN_TIMESTEP)
+                if (!systemsGroups_.empty())
                 {
-                    // Log every stepper state only if the user asked for
-                    if (successiveIterFailed == 0 && engineOptions_->stepper.logInternalStepperSteps)
-                    {
-                        updateTelemetry();
-                    }
-
                     // Fix the FSAL issue if the dynamics has changed
                     if (hasDynamicsChanged)
                     {
-                        // TODO: only update quantities acting at force/acceleration-level
                         computeSystemsDynamics(t, qSplit, vSplit, aSplit);
                         computeAllExtraTerms(systems_, systemsDataHolder_);
                         syncAllAccelerationsAndForces(systems_, contactForcesPrev_, fPrev_, aPrev_);
@@ -2141,143 +2445,259 @@ namespace jiminy
                         hasDynamicsChanged = false;
                     }
 
-                    // Adjust stepsize to end up exactly at the next breakpoint
-                    dt = min(dt, tNext - t);
-                    if (dtLargest > SIMULATION_MIN_TIMESTEP)
+                    /* Integrate every group of systems with its own adaptive time step up
+                       to the next breakpoint, starting from the synchronized state. The groups
+                       do not share any data, so they are integrated concurrently if possible. */
+                    uint32_t iterGroupsPrev = 0U;
+                    uint32_t iterFailedGroupsPrev = 0U;
+                    for (systemsGroup_t & group : systemsGroups_)
                     {
-                        if (tNext - (t + dt) < SIMULATION_MIN_TIMESTEP)
+                        stepperState_t & groupStepperState = group.stepperState;
+                        groupStepperState.t = t;
+                        for (std::size_t k = 0; k < group.systemsIdx.size(); ++k)
                         {
-                            dt = tNext - t;
+                            std::size_t const & i = group.systemsIdx[k];
+                            groupStepperState.state.q[k] = qSplit[i];
+                            groupStepperState.state.v[k] = vSplit[i];
+                            groupStepperState.stateDerivative.v[k] = vSplit[i];
+                            groupStepperState.stateDerivative.a[k] = aSplit[i];
                         }
+                        group.successiveIterFailed = successiveIterFailed;
+                        group.isNan = false;
+                        iterGroupsPrev += groupStepperState.iter;
+                        iterFailedGroupsPrev += groupStepperState.iterFailed;
+                    }
+                    auto stepGroupFct = [this, &tNext](std::size_t const & groupIdx)
+                    {
+                        stepGroup(systemsGroups_[groupIdx], tNext);
+                    };
+                    if (threadPool_)
+                    {
+                        threadPool_->parallelFor(systemsGroups_.size(), stepGroupFct);
                     }
                     else
                     {
-                        if (tNext - (t + dt) < STEPPER_MIN_TIMESTEP)
+                        for (std::size_t groupIdx = 0; groupIdx < systemsGroups_.size(); ++groupIdx)
                         {
-                            dt = tNext - t;
+                            stepGroupFct(groupIdx);
                         }
                     }
 
-                    /* Trying to reach multiples of STEPPER_MIN_TIMESTEP whenever
-                       possible. The idea here is to reach only multiples of 1us,
-                       making logging easier, given that, 1us can be consider an
-                       'infinitesimal' time in robotics. This arbitrary threshold
-                       many not be suited for simulating different, faster
-                       dynamics, that require sub-microsecond precision. */
-                    if (dt > SIMULATION_MIN_TIMESTEP)
+                    // Gather the outcome of the integration of every group
+                    bool_t isBreakpointReachedByGroups = true;
+                    float64_t dtGroupsMin = INF;
+                    float64_t dtLargestGroupsMin = INF;
+                    uint32_t iterGroups = 0U;
+                    uint32_t iterFailedGroups = 0U;
+                    successiveIterFailed = 0U;
+                    for (systemsGroup_t const & group : systemsGroups_)
                     {
-                        float64_t const dtResidual = std::fmod(dt, SIMULATION_MIN_TIMESTEP);
-                        if (dtResidual > STEPPER_MIN_TIMESTEP
-                            && dtResidual < SIMULATION_MIN_TIMESTEP - STEPPER_MIN_TIMESTEP
-                            && dt - dtResidual > STEPPER_MIN_TIMESTEP)
+                        stepperState_t const & groupStepperState = group.stepperState;
+                        dtGroupsMin = min(dtGroupsMin, groupStepperState.dt);
+                        dtLargestGroupsMin = min(dtLargestGroupsMin, groupStepperState.dtLargest);
+                        iterGroups += groupStepperState.iter;
+                        iterFailedGroups += groupStepperState.iterFailed;
+                        successiveIterFailed = std::max(successiveIterFailed, group.successiveIterFailed);
+                        isNan = isNan || group.isNan;
+                        if (tNext - groupStepperState.t > STEPPER_MIN_TIMESTEP)
                         {
-                            dt -= dtResidual;
+                            isBreakpointReachedByGroups = false;
                         }
                     }
+                    stepperState_.iter += iterGroups - iterGroupsPrev;
+                    stepperState_.iterFailed += iterFailedGroups - iterFailedGroupsPrev;
 
-                    /* Break the loop if dt is getting too small.
-                       Don't worry, an exception will be raised later. */
-                    if (dt < STEPPER_MIN_TIMESTEP)
-                    {
-                        break;
-                    }
+                    // Report the smallest time step, which is the one of the failing group if any
+                    dt = dtGroupsMin;
+                    dtLargest = dtLargestGroupsMin;
 
-                    /* Break the loop in case of timeout.
-                       Don't worry, an exception will be raised later. */
-                    timer_->toc();
-                    if (EPS < engineOptions_->stepper.timeout
-                        && engineOptions_->stepper.timeout < timer_->dt)
+                    // Synchronize the state of the stepper once every group reached the breakpoint
+                    if (isBreakpointReachedByGroups)
                     {
-                        break;
+                        for (systemsGroup_t const & group : systemsGroups_)
+                        {
+                            for (std::size_t k = 0; k < group.systemsIdx.size(); ++k)
+                            {
+                                std::size_t const & i = group.systemsIdx[k];
+                                qSplit[i] = group.stepperState.state.q[k];
+                                vSplit[i] = group.stepperState.state.v[k];
+                                stateDerivative.v[i] = group.stepperState.stateDerivative.v[k];
+                                aSplit[i] = group.stepperState.stateDerivative.a[k];
+                            }
+                        }
+                        t = tNext;
+                        stepperState_.tPrev = t;
+                        stepperState_.dtLargestPrev = dtLargest;
                     }
-
-                    // Break the loop in case of too many successive failed inner iteration
-                    if (successiveIterFailed > engineOptions_->stepper.successiveIterFailedMax)
+                }
+                else
+                {
+                    // Compute the next step using adaptive step method
+                    while (tNext - t > STEPPER_MIN_TIMESTEP)
                     {
-                        break;
-                    }
+                        // Log every stepper state only if the user asked for
+                        if (successiveIterFailed == 0 && engineOptions_->stepper.logInternalStepperSteps)
+                        {
+                            updateTelemetry();
+                        }
 
-                    /* A breakpoint has been reached dt has been decreased
-                       wrt the largest possible dt within integration tol. */
-                    isBreakpointReached = (dtLargest > dt);
+                        // Fix the FSAL issue if the dynamics has changed
+                        if (hasDynamicsChanged)
+                        {
+                            // TODO: only update quantities acting at force/acceleration-level
+                            computeSystemsDynamics(t, qSplit, vSplit, aSplit);
+                            computeAllExtraTerms(systems_, systemsDataHolder_);
+                            syncAllAccelerationsAndForces(systems_, contactForcesPrev_, fPrev_, aPrev_);
+                            syncSystemsStateWithStepper(true);
+                            hasDynamicsChanged = false;
+                        }
 
-                    // Set the timestep to be tried by the stepper
-                    dtLargest = dt;
+                        // Adjust stepsize to end up exactly at the next breakpoint
+                        dt = min(dt, tNext - t);
+                        if (dtLargest > SIMULATION_MIN_TIMESTEP)
+                        {
+                            if (tNext - (t + dt) < SIMULATION_MIN_TIMESTEP)
+                            {
+                                dt = tNext - t;
+                            }
+                        }
+                        else
+                        {
+                            if (tNext - (t + dt) < STEPPER_MIN_TIMESTEP)
+                            {
+                                dt = tNext - t;
+                            }
+                        }
 
-                    // Try doing one integration step
-                    bool_t isStepSuccessful = stepper_->tryStep(qSplit, vSplit, aSplit, t, dtLargest);
+                        /* Trying to reach multiples of STEPPER_MIN_TIMESTEP whenever
+                           possible. The idea here is to reach only multiples of 1us,
+                           making logging easier, given that, 1us can be consider an
+                           'infinitesimal' time in robotics. This arbitrary threshold
+                           many not be suited for simulating different, faster
+                           dynamics, that require sub-microsecond precision. */
+                        if (dt > SIMULATION_MIN_TIMESTEP)
+                        {
+                            float64_t const dtResidual = std::fmod(dt, SIMULATION_MIN_TIMESTEP);
+                            if (dtResidual > STEPPER_MIN_TIMESTEP
+                                && dtResidual < SIMULATION_MIN_TIMESTEP - STEPPER_MIN_TIMESTEP
+                                && dt - dtResidual > STEPPER_MIN_TIMESTEP)
+                            {
+                                dt -= dtResidual;
+                            }
+                        }
 
-                    /* Check if the integrator failed miserably even if successfully.
-                       It would happen if integration failed because of nan and the
-                       timestep is not adaptive. */
-                    isNan = std::isnan(dtLargest);
-                    if (isNan)
-                    {
-                        break;
-                    }
+                        /* Break the loop if dt is getting too small.
+                           Don't worry, an exception will be raised later. */
+                        if (dt < STEPPER_MIN_TIMESTEP)
+                        {
+                            break;
+                        }
 
-                    // Update buffer if really successful
-                    if (isStepSuccessful)
-                    {
-                        // Reset successive iteration failure counter
-                        successiveIterFailed = 0;
+                        /* Break the loop in case of timeout.
+                           Don't worry, an exception will be raised later. */
+                        timer_->toc();
+                        if (EPS < engineOptions_->stepper.timeout
+                            && engineOptions_->stepper.timeout < timer_->dt)
+                        {
+                            break;
+                        }
 
-                        /* Compute the actual joint acceleration and forces, based on
-                           up-to-date pinocchio::Data. */
-                        computeAllExtraTerms(systems_, systemsDataHolder_);
+                        // Break the loop in case of too many successive failed inner iteration
+                        if (successiveIterFailed > engineOptions_->stepper.successiveIterFailedMax)
+                        {
+                            break;
+                        }
 
-                        // Synchronize the individual system states
-                        syncAllAccelerationsAndForces(systems_, contactForcesPrev_, fPrev_, aPrev_);
-                        syncSystemsStateWithStepper();
+                        /* A breakpoint has been reached dt has been decreased
+                           wrt the largest possible dt within integration tol. */
+                        isBreakpointReached = (dtLargest > dt);
 
-                        // Increment the iteration counter only for successful steps
-                        ++stepperState_.iter;
+                        // Set the timestep to be tried by the stepper
+                        dtLargest = dt;
 
-                        /* Restore the step size dt if it has been significantly
-                           decreased to because of a breakpoint. It is set
-                           equal to the last available largest dt to be known,
-                           namely the second to last successfull step. */
-                        if (isBreakpointReached)
+                        // Try doing one integration step
+                        float64_t const tStepStart = t;
+                        bool_t isStepSuccessful = stepper_->tryStep(state, stateDerivative, t, dtLargest);
+
+                        /* Check if the integrator failed miserably even if successfully.
+                           It would happen if integration failed because of nan and the
+                           timestep is not adaptive. */
+                        isNan = std::isnan(dtLargest);
+                        if (isNan)
                         {
-                            /* Restore the step size if and only if:
-                               - the next estimated largest step size is larger than
-                                 the requested one for the current (successful) step.
-                               - the next estimated largest step size is significantly
-                                 smaller than the estimated largest step size for the
-                                 previous step. */
-                            float64_t dtRestoreThresholdAbs = stepperState_.dtLargestPrev *
-                                engineOptions_->stepper.dtRestoreThresholdRel;
-                            if (dt < dtLargest && dtLargest < dtRestoreThresholdAbs)
+                            break;
+                        }
+
+                        // Update buffer if really successful
+                        if (isStepSuccessful)
+                        {
+                            // Reset successive iteration failure counter
+                            successiveIterFailed = 0;
+
+                            /* Compute the actual joint acceleration and forces, based on
+                               up-to-date pinocchio::Data. */
+                            computeAllExtraTerms(systems_, systemsDataHolder_);
+
+                            // Synchronize the individual system states
+                            syncAllAccelerationsAndForces(systems_, contactForcesPrev_, fPrev_, aPrev_);
+                            syncSystemsStateWithStepper();
+
+                            /* Update the sensors and the telemetry within the step if they are not
+                               breakpoints. The end of the step is already handled if it is one. */
+                            if (stepperBreakPeriod_ > stepperUpdatePeriod_)
                             {
-                                dtLargest = stepperState_.dtLargestPrev;
+                                updateWithinStep(tStepStart, t, tNext - t > STEPPER_MIN_TIMESTEP);
                             }
-                        }
 
-                        /* Backup the stepper and systems' state on success only:
-                           - t at last successful iteration is used to compute dt,
-                             which is project the accelation in the state space
-                             instead of SO3^2.
-                           - dtLargestPrev is used to restore the largest step
-                             size in case of a breakpoint requiring lowering it.
-                           - the acceleration and effort at the last successful
-                             iteration is used to update the sensors' data in
-                             case of continuous sensing. */
-                        stepperState_.tPrev = t;
-                        stepperState_.dtLargestPrev = dtLargest;
-                        for (auto & systemData : systemsDataHolder_)
+                            // Increment the iteration counter only for successful steps
+                            ++stepperState_.iter;
+
+                            /* Restore the step size dt if it has been significantly
+                               decreased to because of a breakpoint. It is set
+                               equal to the last available largest dt to be known,
+                               namely the second to last successfull step. */
+                            if (isBreakpointReached)
+                            {
+                                /* Restore the step size if and only if:
+                                   - the next estimated largest step size is larger than
+                                     the requested one for the current (successful) step.
+                                   - the next estimated largest step size is significantly
+                                     smaller than the estimated largest step size for the
+                                     previous step. */
+                                float64_t dtRestoreThresholdAbs = stepperState_.dtLargestPrev *
+                                    engineOptions_->stepper.dtRestoreThresholdRel;
+                                if (dt < dtLargest && dtLargest < dtRestoreThresholdAbs)
+                                {
+                                    dtLargest = stepperState_.dtLargestPrev;
+                                }
+                            }
+
+                            /* Backup the stepper and systems' state on success only:
+                               - t at last successful iteration is used to compute dt,
+                                 which is project the accelation in the state space
+                                 instead of SO3^2.
+                               - dtLargestPrev is used to restore the largest step
+                                 size in case of a breakpoint requiring lowering it.
+                               - the acceleration and effort at the last successful
+                                 iteration is used to update the sensors' data in
+                                 case of continuous sensing. */
+                            stepperState_.tPrev = t;
+                            stepperState_.dtLargestPrev = dtLargest;
+                            for (auto & systemData : systemsDataHolder_)
+                            {
+                                systemData.statePrev = systemData.state;
+                            }
+                        }
+                        else
                         {
-                            systemData.statePrev = systemData.state;
+                            // Increment the failed iteration counters
+                            ++successiveIterFailed;
+                            ++stepperState_.iterFailed;
                         }
-                    }
-                    else
-                    {
-                        // Increment the failed iteration counters
-                        ++successiveIterFailed;
-                        ++stepperState_.iterFailed;
-                    }
 
-                    // Initialize the next dt
-                    dt = min(dtLargest, engineOptions_->stepper.dtMax);
+                        // Initialize the next dt
+                        dt = min(dtLargest, engineOptions_->stepper.dtMax);
+                    }
                 }
             }
             else
@@ -2306,7 +2726,7 @@ namespace jiminy
                     }
 
                     // Try to do a step
-                    isStepSuccessful = stepper_->tryStep(qSplit, vSplit, aSplit, t, dtLargest);
+                    isStepSuccessful = stepper_->tryStep(state, stateDerivative, t, dtLargest);
 
                     // Check if the integrator failed miserably even if successfully
                     isNan = std::isnan(dtLargest);
@@ -2436,6 +2856,9 @@ namespace jiminy
             systemData.robotLock.reset(nullptr);
         }
 
+        // The collision world refers to the robots, which may change from now on
+        collisionWorld_.clear();
+
         // Make sure that a simulation running
         if (!isSimulationRunning_)
         {
@@ -2452,14 +2875,184 @@ namespace jiminy
            Note that calling ``stop` or  `reset` does NOT clear
            the internal data buffer of telemetryRecorder_.
            Clearing is done at init time, so that it remains
-           accessible until the next initialization. */
+           accessible until the next initialization. The registered
+           variables and constants are kept as well, to be recycled
+           by the next simulation if possible. */
         telemetryRecorder_->reset();
-        telemetryData_->reset();
 
         // Update some internal flags
         isSimulationRunning_ = false;
     }
 
+    namespace
+    {
+        void processStepperState(StateArchive   & archive,
+                                 stepperState_t & stepperState)
+        {
+            archive.process(stepperState.iter);
+            archive.process(stepperState.iterFailed);
+            archive.process(stepperState.t);
+            archive.process(stepperState.tPrev);
+            archive.process(stepperState.tError);
+            archive.process(stepperState.dt);
+            archive.process(stepperState.dtLargest);
+            archive.process(stepperState.dtLargestPrev);
+            archive.process(stepperState.state.q);
+            archive.process(stepperState.state.v);
+            archive.process(stepperState.stateDerivative.v);
+            archive.process(stepperState.stateDerivative.a);
+        }
+
+        void processSystemState(StateArchive  & archive,
+                                systemState_t & systemState)
+        {
+            archive.process(systemState.q);
+            archive.process(systemState.v);
+            archive.process(systemState.a);
+            archive.process(systemState.command);
+            archive.process(systemState.u);
+            archive.process(systemState.uMotor);
+            archive.process(systemState.uInternal);
+            archive.process(systemState.uCustom);
+            archive.process(systemState.fExternal);
+        }
+    }
+
+    void EngineMultiRobot::processState(StateArchive & archive)
+    {
+        // State of the steppers, including the one of every group integrated independently
+        processStepperState(archive, stepperState_);
+        archive.checkSize(systemsGroups_.size());
+        for (systemsGroup_t & group : systemsGroups_)
+        {
+            processStepperState(archive, group.stepperState);
+        }
+
+        // Random number generator of the engine
+        archive.process(generator_);
+
+        // Accelerations and forces at the end of the previous step
+        archive.process(contactForcesPrev_);
+        archive.process(fPrev_);
+        archive.process(aPrev_);
+
+        archive.checkSize(systems_.size());
+        auto systemIt = systems_.begin();
+        auto systemDataIt = systemsDataHolder_.begin();
+        for ( ; systemIt != systems_.end(); ++systemIt, ++systemDataIt)
+        {
+            // Current and previous state of the system
+            processSystemState(archive, systemDataIt->state);
+            processSystemState(archive, systemDataIt->statePrev);
+
+            // External forces, the registered ones being the same as when the state has been saved
+            archive.checkSize(systemDataIt->forcesProfile.size());
+            for (forceProfile_t & forceProfile : systemDataIt->forcesProfile)
+            {
+                archive.process(forceProfile.forcePrev);
+            }
+            archive.process(systemDataIt->forcesImpulseActive);
+            archive.checkSize(systemDataIt->forcesImpulseBreaks.size());
+            std::size_t forcesImpulseBreakNextIdx = static_cast<std::size_t>(std::distance(
+                systemDataIt->forcesImpulseBreaks.cbegin(), systemDataIt->forcesImpulseBreakNextIt));
+            archive.processSize(forcesImpulseBreakNextIdx);
+            if (archive.getMode() == archiveMode_t::RESTORE)
+            {
+                systemDataIt->forcesImpulseBreakNextIt = std::next(
+                    systemDataIt->forcesImpulseBreaks.cbegin(),
+                    static_cast<std::ptrdiff_t>(forcesImpulseBreakNextIdx));
+            }
+
+            // Constraints, whose multipliers are used to warm start the solver
+            systemDataIt->constraintsHolder.foreach(
+                [&archive](
+                    std::shared_ptr<AbstractConstraintBase> const & constraint,
+                    constraintsHolderType_t const & /* holderType */)
+                {
+                    if (!constraint)
+                    {
+                        return;
+                    }
+                    bool_t isEnabled = constraint->getIsEnabled();
+                    archive.process(isEnabled);
+                    archive.process(constraint->lambda_);
+                    if (archive.getMode() == archiveMode_t::RESTORE)
+                    {
+                        if (isEnabled)
+                        {
+                            constraint->enable();
+                        }
+                        else
+                        {
+                            constraint->disable();
+                        }
+                    }
+                });
+            archive.process(systemDataIt->contactFramesForces);
+            archive.process(systemDataIt->collisionBodiesForces);
+
+            // Warm-start data of the constraint solver, if any
+            archive.checkSize(systemDataIt->constraintSolver ? 1U : 0U);
+            if (systemDataIt->constraintSolver)
+            {
+                systemDataIt->constraintSolver->processState(archive);
+            }
+
+            // Internal state of the robot and the controller
+            systemIt->robot->processState(archive);
+            systemIt->controller->processState(archive);
+        }
+    }
+
+    hresult_t EngineMultiRobot::saveState(std::vector<uint8_t> & state)
+    {
+        if (!isSimulationRunning_)
+        {
+            PRINT_ERROR("No simulation running. Please start it before saving its state.");
+            return hresult_t::ERROR_GENERIC;
+        }
+
+        StateArchive archive(state);
+        processState(archive);
+
+        return hresult_t::SUCCESS;
+    }
+
+    hresult_t EngineMultiRobot::restoreState(std::vector<uint8_t> const & state)
+    {
+        if (!isSimulationRunning_)
+        {
+            PRINT_ERROR("No simulation running. Please start it before restoring a state.");
+            return hresult_t::ERROR_GENERIC;
+        }
+
+        // Make sure that the state is consistent with the simulation before modifying anything
+        {
+            StateArchive archive(state, archiveMode_t::CHECK);
+            processState(archive);
+            if (!archive.getIsComplete())
+            {
+                PRINT_ERROR("The state is not consistent with the running simulation.");
+                return hresult_t::ERROR_BAD_INPUT;
+            }
+        }
+
+        StateArchive archive(state, archiveMode_t::RESTORE);
+        processState(archive);
+
+        // Update the kinematics of every system, which is not part of the state
+        auto systemIt = systems_.begin();
+        auto systemDataIt = systemsDataHolder_.begin();
+        for ( ; systemIt != systems_.end(); ++systemIt, ++systemDataIt)
+        {
+            systemState_t const & systemState = systemDataIt->state;
+            computeForwardKinematics(*systemIt, systemDataIt->kinematicsPlan,
+                                     systemState.q, systemState.v, systemState.a);
+        }
+
+        return hresult_t::SUCCESS;
+    }
+
     hresult_t EngineMultiRobot::registerForceImpulse(std::string      const & systemName,
                                                      std::string      const & frameName,
                                                      float64_t        const & t,
@@ -2519,30 +3112,6 @@ namespace jiminy
         return hresult_t::SUCCESS;
     }
 
-    template<typename ...Args>
-    std::tuple<bool_t, float64_t> isGcdIncluded(vector_aligned_t<systemDataHolder_t> const & systemsDataHolder,
-                                                Args... values)
-    {
-        if (systemsDataHolder.empty())
-        {
-            return isGcdIncluded(std::forward<Args>(values)...);
-        }
-
-        float64_t minValue = INF;
-        auto lambda = [&minValue, &values...](systemDataHolder_t const & systemData)
-        {
-            bool_t isIncluded; float64_t value;
-            std::tie(isIncluded, value) = isGcdIncluded(
-                systemData.forcesProfile.begin(),
-                systemData.forcesProfile.end(),
-                [](forceProfile_t const & force) { return force.updatePeriod; },
-                std::forward<Args>(values)...);
-            minValue = minClipped(minValue, value);
-            return isIncluded;
-        };
-        return {std::all_of(systemsDataHolder.begin(), systemsDataHolder.end(), lambda), minValue};
-    }
-
     hresult_t EngineMultiRobot::registerForceProfile(std::string const & systemName,
                                                      std::string const & frameName,
                                                      forceProfileFunctor_t const & forceFct,
@@ -2860,6 +3429,30 @@ namespace jiminy
             return hresult_t::ERROR_BAD_INPUT;
         }
 
+        // Make sure that the memory of the telemetry stays bounded in streaming mode
+        configHolder_t telemetryOptions = boost::get<configHolder_t>(engineOptions.at("telemetry"));
+        uint32_t const & maxInFlightChunks =
+            boost::get<uint32_t>(telemetryOptions.at("maxInFlightChunks"));
+        if (maxInFlightChunks < 2U)
+        {
+            PRINT_ERROR("The telemetry option 'maxInFlightChunks' must be at least 2.");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+
+        // Make sure the compression of the log files is supported
+        std::string const & compression = boost::get<std::string>(telemetryOptions.at("compression"));
+        if (compression != "gzip" && compression != "none")
+        {
+            PRINT_ERROR("The telemetry option 'compression' must be either 'gzip' or 'none'.");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+        uint32_t const & chunkSize = boost::get<uint32_t>(telemetryOptions.at("chunkSize"));
+        if (chunkSize < 1U)
+        {
+            PRINT_ERROR("The telemetry option 'chunkSize' must be strictly positive.");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+
         // Make sure the user-defined gravity force has the right dimension
         configHolder_t worldOptions = boost::get<configHolder_t>(engineOptions.at("world"));
         vectorN_t gravity = boost::get<vectorN_t>(worldOptions.at("gravity"));
@@ -2874,7 +3467,7 @@ namespace jiminy
         uint32_t randomSeed = boost::get<uint32_t>(stepperOptions.at("randomSeed"));
         if (!engineOptions_ || randomSeed != engineOptions_->stepper.randomSeed)
         {
-            resetRandomGenerators(randomSeed);
+            seedRandomGenerators(randomSeed);
         }
 
         // Update the internal options
@@ -2992,21 +3585,34 @@ namespace jiminy
         return STEPPER_MIN_TIMESTEP;
     }
 
+    void EngineMultiRobot::seedRandomGenerators(uint32_t const & seed)
+    {
+        // The stream 0 is reserved to the engine itself
+        generator_.seed(seed);
+        for (std::size_t i = 0; i < systems_.size(); ++i)
+        {
+            systems_[i].robot->generator_ = generator_.split(static_cast<uint32_t>(i + 1));
+        }
+    }
+
     // ========================================================
     // =================== Stepper utilities ==================
     // ========================================================
 
     void EngineMultiRobot::syncStepperStateWithSystems(void)
     {
-        auto qSplitIt = stepperState_.qSplit.begin();
-        auto vSplitIt = stepperState_.vSplit.begin();
-        auto aSplitIt = stepperState_.aSplit.begin();
+        // The velocity is stored twice, in the state and its derivative, so both must be updated
+        auto qSplitIt = stepperState_.state.q.begin();
+        auto vSplitIt = stepperState_.state.v.begin();
+        auto vDerivativeSplitIt = stepperState_.stateDerivative.v.begin();
+        auto aSplitIt = stepperState_.stateDerivative.a.begin();
         auto systemDataIt = systemsDataHolder_.begin();
         for ( ; systemDataIt != systemsDataHolder_.end();
-             ++systemDataIt, ++qSplitIt, ++vSplitIt, ++aSplitIt)
+             ++systemDataIt, ++qSplitIt, ++vSplitIt, ++vDerivativeSplitIt, ++aSplitIt)
         {
             *qSplitIt = systemDataIt->state.q;
             *vSplitIt = systemDataIt->state.v;
+            *vDerivativeSplitIt = systemDataIt->state.v;
             *aSplitIt = systemDataIt->state.a;
         }
     }
@@ -3015,7 +3621,7 @@ namespace jiminy
     {
         if (sync_acceleration_only)
         {
-            auto aSplitIt = stepperState_.aSplit.begin();
+            auto aSplitIt = stepperState_.stateDerivative.a.begin();
             auto systemDataIt = systemsDataHolder_.begin();
             for ( ; systemDataIt != systemsDataHolder_.end();
                 ++systemDataIt, ++aSplitIt)
@@ -3025,9 +3631,9 @@ namespace jiminy
         }
         else
         {
-            auto qSplitIt = stepperState_.qSplit.begin();
-            auto vSplitIt = stepperState_.vSplit.begin();
-            auto aSplitIt = stepperState_.aSplit.begin();
+            auto qSplitIt = stepperState_.state.q.begin();
+            auto vSplitIt = stepperState_.state.v.begin();
+            auto aSplitIt = stepperState_.stateDerivative.a.begin();
             auto systemDataIt = systemsDataHolder_.begin();
             for ( ; systemDataIt != systemsDataHolder_.end();
                 ++systemDataIt, ++qSplitIt, ++vSplitIt, ++aSplitIt)
@@ -3039,6 +3645,203 @@ namespace jiminy
         }
     }
 
+    void EngineMultiRobot::updateWithinStep(float64_t const & tStart,
+                                            float64_t const & tEnd,
+                                            bool_t    const & isEndIncluded)
+    {
+        float64_t const & sensorsUpdatePeriod = engineOptions_->stepper.sensorsUpdatePeriod;
+        bool_t const mustUpdateTelemetry = !engineOptions_->stepper.logInternalStepperSteps;
+
+        // Get the first sampling instant strictly after the start of the step
+        float64_t tSample = tStart - std::fmod(tStart, stepperUpdatePeriod_) + stepperUpdatePeriod_;
+        if (tSample - tStart < STEPPER_MIN_TIMESTEP)
+        {
+            tSample += stepperUpdatePeriod_;
+        }
+        float64_t const tSampleMax = isEndIncluded ? tEnd + STEPPER_MIN_TIMESTEP : tEnd - STEPPER_MIN_TIMESTEP;
+
+        bool_t isStateInterpolated = false;
+        for ( ; tSample < tSampleMax; tSample += stepperUpdatePeriod_)
+        {
+            // Sensors are only updated at multiples of their own update period
+            float64_t const dtNextSensorsUpdatePeriod = sensorsUpdatePeriod - std::fmod(tSample, sensorsUpdatePeriod);
+            bool_t const mustUpdateSensors = dtNextSensorsUpdatePeriod < SIMULATION_MIN_TIMESTEP
+                                          || sensorsUpdatePeriod - dtNextSensorsUpdatePeriod < STEPPER_MIN_TIMESTEP;
+            if (!mustUpdateSensors && !mustUpdateTelemetry)
+            {
+                continue;
+            }
+
+            // Interpolate the state of the systems from the continuous extension of the step
+            if (!stepper_->computeDenseOutput(tSample, denseOutputState_, denseOutputStateDerivative_))
+            {
+                break;
+            }
+            isStateInterpolated = true;
+
+            // Set the interpolated state as the current one, including the kinematics
+            auto systemIt = systems_.begin();
+            auto systemDataIt = systemsDataHolder_.begin();
+            for (std::size_t i = 0; systemIt != systems_.end(); ++systemIt, ++systemDataIt, ++i)
+            {
+                systemDataIt->state.q = denseOutputState_.q[i];
+                systemDataIt->state.v = denseOutputState_.v[i];
+                systemDataIt->state.a = denseOutputStateDerivative_.a[i];
+                computeForwardKinematics(*systemIt,
+                                         systemDataIt->kinematicsPlan,
+                                         systemDataIt->state.q,
+                                         systemDataIt->state.v,
+                                         systemDataIt->state.a);
+            }
+
+            // Update the sensors and the telemetry at the sampling instant
+            if (mustUpdateSensors)
+            {
+                systemIt = systems_.begin();
+                systemDataIt = systemsDataHolder_.begin();
+                for ( ; systemIt != systems_.end(); ++systemIt, ++systemDataIt)
+                {
+                    vectorN_t const & q = systemDataIt->state.q;
+                    vectorN_t const & v = systemDataIt->state.v;
+                    vectorN_t const & a = systemDataIt->state.a;
+                    vectorN_t const & uMotor = systemDataIt->state.uMotor;
+                    forceVector_t const & fext = systemDataIt->state.fExternal;
+                    systemIt->robot->setSensorsData(tSample, q, v, a, uMotor, fext);
+                }
+            }
+            if (mustUpdateTelemetry)
+            {
+                float64_t const tStep = stepperState_.t;
+                stepperState_.t = tSample;
+                updateTelemetry();
+                stepperState_.t = tStep;
+            }
+        }
+
+        // Restore the state of the systems at the end of the step
+        if (isStateInterpolated)
+        {
+            syncSystemsStateWithStepper();
+            auto systemIt = systems_.begin();
+            auto systemDataIt = systemsDataHolder_.begin();
+            for ( ; systemIt != systems_.end(); ++systemIt, ++systemDataIt)
+            {
+                computeForwardKinematics(*systemIt,
+                                         systemDataIt->kinematicsPlan,
+                                         systemDataIt->state.q,
+                                         systemDataIt->state.v,
+                                         systemDataIt->state.a);
+            }
+        }
+    }
+
+    void EngineMultiRobot::stepGroup(systemsGroup_t       & group,
+                                     float64_t      const & tEnd)
+    {
+        // Get references to the internal stepper buffers of the group
+        stepperState_t & stepperState = group.stepperState;
+        uint32_t & successiveIterFailed = group.successiveIterFailed;
+        bool_t & isNan = group.isNan;
+        float64_t & t = stepperState.t;
+        float64_t & dt = stepperState.dt;
+        float64_t & dtLargest = stepperState.dtLargest;
+
+        bool_t isBreakpointReached = false;
+        while (tEnd - t > STEPPER_MIN_TIMESTEP)
+        {
+            // Adjust stepsize to end up exactly at the breakpoint
+            dt = min(dt, tEnd - t);
+            if (tEnd - (t + dt) < (dtLargest > SIMULATION_MIN_TIMESTEP ? SIMULATION_MIN_TIMESTEP : STEPPER_MIN_TIMESTEP))
+            {
+                dt = tEnd - t;
+            }
+
+            // Trying to reach multiples of STEPPER_MIN_TIMESTEP whenever possible
+            if (dt > SIMULATION_MIN_TIMESTEP)
+            {
+                float64_t const dtResidual = std::fmod(dt, SIMULATION_MIN_TIMESTEP);
+                if (dtResidual > STEPPER_MIN_TIMESTEP
+                    && dtResidual < SIMULATION_MIN_TIMESTEP - STEPPER_MIN_TIMESTEP
+                    && dt - dtResidual > STEPPER_MIN_TIMESTEP)
+                {
+                    dt -= dtResidual;
+                }
+            }
+
+            // Break the loop if something is wrong. An exception will be raised by the caller.
+            if (dt < STEPPER_MIN_TIMESTEP)
+            {
+                break;
+            }
+            if (EPS < engineOptions_->stepper.timeout
+                && engineOptions_->stepper.timeout < timer_->getElapsed())
+            {
+                break;
+            }
+            if (successiveIterFailed > engineOptions_->stepper.successiveIterFailedMax)
+            {
+                break;
+            }
+
+            // Try doing one integration step
+            isBreakpointReached = (dtLargest > dt);
+            dtLargest = dt;
+            bool_t const isStepSuccessful = group.stepper->tryStep(
+                stepperState.state, stepperState.stateDerivative, t, dtLargest);
+            isNan = std::isnan(dtLargest);
+            if (isNan)
+            {
+                break;
+            }
+
+            if (isStepSuccessful)
+            {
+                // Reset successive iteration failure counter
+                successiveIterFailed = 0;
+
+                // Synchronize the individual system states and backup them
+                for (std::size_t k = 0; k < group.systemsIdx.size(); ++k)
+                {
+                    std::size_t const & i = group.systemsIdx[k];
+                    systemDataHolder_t & systemData = systemsDataHolder_[i];
+                    computeExtraTerms(systems_[i], systemData);
+                    syncAccelerationsAndForces(systems_[i], contactForcesPrev_[i], fPrev_[i], aPrev_[i]);
+                    systemData.state.q = stepperState.state.q[k];
+                    systemData.state.v = stepperState.state.v[k];
+                    systemData.state.a = stepperState.stateDerivative.a[k];
+                    systemData.statePrev = systemData.state;
+                }
+
+                // Increment the iteration counter only for successful steps
+                ++stepperState.iter;
+
+                // Restore the step size if it has been significantly decreased because of the breakpoint
+                if (isBreakpointReached)
+                {
+                    float64_t dtRestoreThresholdAbs = stepperState.dtLargestPrev *
+                        engineOptions_->stepper.dtRestoreThresholdRel;
+                    if (dt < dtLargest && dtLargest < dtRestoreThresholdAbs)
+                    {
+                        dtLargest = stepperState.dtLargestPrev;
+                    }
+                }
+
+                // Backup the stepper state on success only
+                stepperState.tPrev = t;
+                stepperState.dtLargestPrev = dtLargest;
+            }
+            else
+            {
+                // Increment the failed iteration counters
+                ++successiveIterFailed;
+                ++stepperState.iterFailed;
+            }
+
+            // Initialize the next dt
+            dt = min(dtLargest, engineOptions_->stepper.dtMax);
+        }
+    }
+
     // ========================================================
     // ================ Core physics utilities ================
     // ========================================================
@@ -3048,6 +3851,18 @@ namespace jiminy
                                                     vectorN_t      const & q,
                                                     vectorN_t      const & v,
                                                     vectorN_t      const & a)
+    {
+        // Compile a temporary plan, since none is available outside a simulation
+        kinematicsPlan_t kinematicsPlan;
+        kinematicsPlan.initialize(*system.robot);
+        computeForwardKinematics(system, kinematicsPlan, q, v, a);
+    }
+
+    void EngineMultiRobot::computeForwardKinematics(systemHolder_t         & system,
+                                                    kinematicsPlan_t const & kinematicsPlan,
+                                                    vectorN_t        const & q,
+                                                    vectorN_t        const & v,
+                                                    vectorN_t        const & a)
     {
         // Create proxies for convenience
         pinocchio::Model const & model = system.robot->pncModel_;
@@ -3055,64 +3870,43 @@ namespace jiminy
         pinocchio::GeometryModel const & geomModel = system.robot->collisionModel_;
         pinocchio::GeometryData & geomData = system.robot->collisionData_;
 
-        // Update forward kinematics
-        pinocchio::forwardKinematics(model, data, q, v, a);
+        // Update forward kinematics, using the specialized backend if available
+        if (AbstractDynamicsBackend const * backend = system.robot->getDynamicsBackend().get())
+        {
+            backend->forwardKinematics(model, data, q, v, a);
+        }
+        else
+        {
+            pinocchio::forwardKinematics(model, data, q, v, a);
+        }
 
-        // Update frame placements (avoiding redundant computations)
-        for (int32_t i=1; i < model.nframes; ++i)
+        /* Update frame placements (avoiding redundant computations).
+           The frames copied from other frames must be updated last. */
+        for (frameIndex_t const & frameIdx : kinematicsPlan.framesComposed)
         {
-            pinocchio::Frame const & frame = model.frames[i];
-            jointIndex_t const & parent = frame.parent;
-            switch (frame.type)
-            {
-            case pinocchio::FrameType::JOINT:
-                /* If the frame is associated with an actual joint, no need to compute
-                   anything new, since the frame transform is supposed to be identity. */
-                data.oMf[i] = data.oMi[parent];
-                break;
-            case pinocchio::FrameType::BODY:
-                if (model.frames[frame.previousFrame].type == pinocchio::FrameType::FIXED_JOINT)
-                {
-                    /* BODYs connected via FIXED_JOINT(s) have the same transform than the
-                    joint itself, so no need to compute them twice.
-                    Here we are doing the assumption that the previous frame transfrom has
-                    already been updated since it is closer to root in kinematic tree. */
-                    data.oMf[i] = data.oMf[frame.previousFrame];
-                }
-                else
-                {
-                    /* BODYs connected via JOINT(s) have the identity transform, so copying
-                    parent joint transform should be fine. */
-                    data.oMf[i] = data.oMi[parent];
-                }
-                break;
-            case pinocchio::FrameType::FIXED_JOINT:
-            case pinocchio::FrameType::SENSOR:
-            case pinocchio::FrameType::OP_FRAME:
-            default:
-                // Nothing special, doing the actual computation
-                data.oMf[i] = data.oMi[parent] * frame.placement;
-            }
+            pinocchio::Frame const & frame = model.frames[frameIdx];
+            data.oMf[frameIdx] = data.oMi[frame.parent] * frame.placement;
+        }
+        for (auto const & [frameIdx, jointIdx] : kinematicsPlan.framesFromJoint)
+        {
+            data.oMf[frameIdx] = data.oMi[jointIdx];
+        }
+        for (auto const & [frameIdx, previousFrameIdx] : kinematicsPlan.framesFromFrame)
+        {
+            data.oMf[frameIdx] = data.oMf[previousFrameIdx];
         }
 
         /* Update collision information selectively,
            ie only for geometries involved in at least one collision pair. */
-        std::unordered_set<geomIndex_t> activeGeometriesIdx;
-        for (auto const & pair : geomModel.collisionPairs)
-        {
-            activeGeometriesIdx.insert(pair.first);
-            activeGeometriesIdx.insert(pair.second);
-        }
-        for (geomIndex_t const & i : activeGeometriesIdx)
+        for (kinematicsPlan_t::geometry_t const & geom : kinematicsPlan.geometries)
         {
-            jointIndex_t const & jointIdx = geomModel.geometryObjects[i].parentJoint;
-            if (jointIdx > 0)
+            if (geom.jointIdx > 0)
             {
-                geomData.oMg[i] = data.oMi[jointIdx] * geomModel.geometryObjects[i].placement;
+                geomData.oMg[geom.geomIdx] = data.oMi[geom.jointIdx] * geom.placement;
             }
             else
             {
-                geomData.oMg[i] = geomModel.geometryObjects[i].placement;
+                geomData.oMg[geom.geomIdx] = geom.placement;
             }
         }
         pinocchio::computeCollisions(geomModel, geomData, false);
@@ -3209,8 +4003,45 @@ namespace jiminy
         }
     }
 
+    void EngineMultiRobot::computeGroundAtContactFrames(systemHolder_t     const & system,
+                                                        systemDataHolder_t       & systemData) const
+    {
+        // Define proxies for convenience
+        pinocchio::Data const & data = system.robot->pncData_;
+        std::vector<frameIndex_t> const & contactFramesIdx = system.robot->getContactFramesIdx();
+        heightmapFunctor_t const & groundProfile = engineOptions_->world.groundProfile;
+
+        /* Query all the contact points at once if the ground profile is a native grid,
+           bypassing the type-erased functor. Otherwise, query them one by one. */
+        GridHeightmap const * groundGrid = groundProfile.target<GridHeightmap>();
+        if (groundGrid)
+        {
+            for (std::size_t i = 0; i < contactFramesIdx.size(); ++i)
+            {
+                systemData.contactFramesPositions.col(static_cast<Eigen::Index>(i)) =
+                    data.oMf[contactFramesIdx[i]].translation();
+            }
+            (*groundGrid)(systemData.contactFramesPositions,
+                          systemData.contactFramesGroundHeights,
+                          systemData.contactFramesGroundNormals);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < contactFramesIdx.size(); ++i)
+            {
+                Eigen::Index const contactIdx = static_cast<Eigen::Index>(i);
+                auto const ground = groundProfile(data.oMf[contactFramesIdx[i]].translation());
+                systemData.contactFramesGroundHeights[contactIdx] = std::get<float64_t>(ground);
+                systemData.contactFramesGroundNormals.col(contactIdx) =
+                    std::get<vector3_t>(ground).normalized();  // Make sure the ground normal is normalized
+            }
+        }
+    }
+
     void EngineMultiRobot::computeContactDynamicsAtFrame(systemHolder_t const & system,
                                                          frameIndex_t const & frameIdx,
+                                                         float64_t const & zGround,
+                                                         vector3_t const & nGround,
                                                          std::shared_ptr<AbstractConstraintBase> & constraint,
                                                          pinocchio::Force & fextLocal) const
     {
@@ -3225,12 +4056,8 @@ namespace jiminy
         // Get the pose of the frame wrt the world
         pinocchio::SE3 const & transformFrameInWorld = data.oMf[frameIdx];
 
-        // Compute the ground normal and penetration depth at the contact point
+        // Compute the penetration depth at the contact point
         vector3_t const & posFrame = transformFrameInWorld.translation();
-        auto ground = engineOptions_->world.groundProfile(posFrame);
-        float64_t const & zGround = std::get<float64_t>(ground);
-        vector3_t & nGround = std::get<vector3_t>(ground);
-        nGround.normalize();  // Make sure the ground normal is normalized
         float64_t const depth = (posFrame[2] - zGround) * nGround[2];  // First-order projection (exact assuming no curvature)
 
         // Only compute the ground reaction force if the penetration depth is negative
@@ -3647,15 +4474,24 @@ namespace jiminy
                                                   systemDataHolder_t       & systemData,
                                                   forceVector_t            & fext) const
     {
+        // Compute the ground profile below all the contact points at once
+        computeGroundAtContactFrames(system, systemData);
+
         // Compute the forces at contact points
         std::vector<frameIndex_t> const & contactFramesIdx = system.robot->getContactFramesIdx();
         for (std::size_t i = 0; i < contactFramesIdx.size(); ++i)
         {
             // Compute force at the given contact frame.
+            Eigen::Index const contactIdx = static_cast<Eigen::Index>(i);
             frameIndex_t const & frameIdx = contactFramesIdx[i];
             auto & constraint = systemData.constraintsHolder.contactFrames[i].second;
             pinocchio::Force & fextLocal = systemData.contactFramesForces[i];
-            computeContactDynamicsAtFrame(system, frameIdx, constraint, fextLocal);
+            computeContactDynamicsAtFrame(system,
+                                          frameIdx,
+                                          systemData.contactFramesGroundHeights[contactIdx],
+                                          systemData.contactFramesGroundNormals.col(contactIdx),
+                                          constraint,
+                                          fextLocal);
 
             // Apply the force at the origin of the parent joint frame, in local joint frame
             jointIndex_t const & parentJointIdx = system.robot->pncModel_.frames[frameIdx].parent;
@@ -3688,6 +4524,40 @@ namespace jiminy
         }
     }
 
+    void EngineMultiRobot::computeBodiesCollisionForces(void)
+    {
+        for (collisionContact_t const & contact : collisionWorld_.computeContacts())
+        {
+            // Extract info about both bodies involved
+            Robot const & robot1 = *systems_[contact.systemIdx1].robot;
+            Robot const & robot2 = *systems_[contact.systemIdx2].robot;
+            forceVector_t & fext1 = systemsDataHolder_[contact.systemIdx1].state.fExternal;
+            forceVector_t & fext2 = systemsDataHolder_[contact.systemIdx2].state.fExternal;
+
+            // Compute the linear velocity of the contact point on each body in world frame
+            pinocchio::SE3 posContactInWorld = pinocchio::SE3::Identity();
+            posContactInWorld.translation() = contact.position;
+            pinocchio::SE3 const transformJoint1InContact =
+                posContactInWorld.actInv(robot1.pncData_.oMi[contact.jointIdx1]);
+            pinocchio::SE3 const transformJoint2InContact =
+                posContactInWorld.actInv(robot2.pncData_.oMi[contact.jointIdx2]);
+            vector3_t const vContact1InWorld =
+                transformJoint1InContact.act(robot1.pncData_.v[contact.jointIdx1]).linear();
+            vector3_t const vContact2InWorld =
+                transformJoint2InContact.act(robot2.pncData_.v[contact.jointIdx2]).linear();
+
+            /* Compute the force applied on the first body at contact point in world frame,
+               as if the second body were the ground. The normal goes from the first body
+               to the second one, so the normal of the 'ground' is the opposite. */
+            pinocchio::Force const fextAtContactInGlobal = computeContactDynamics(
+                - contact.normal, contact.depth, vContact1InWorld - vContact2InWorld);
+
+            // Apply the opposite forces at the origin of the parent joint frames, in local joint frames
+            fext1[contact.jointIdx1] += transformJoint1InContact.actInv(fextAtContactInGlobal);
+            fext2[contact.jointIdx2] -= transformJoint2InContact.actInv(fextAtContactInGlobal);
+        }
+    }
+
     void EngineMultiRobot::computeExternalForces(systemHolder_t     const & system,
                                                  systemDataHolder_t       & systemData,
                                                  float64_t          const & t,
@@ -3735,39 +4605,85 @@ namespace jiminy
     {
         for (auto & forceCoupling : forcesCoupling_)
         {
-            // Extract info about the first system involved
             int32_t const & systemIdx1 = forceCoupling.systemIdx1;
-            systemHolder_t const & system1 = systems_[systemIdx1];
-            vectorN_t const & q1 = qSplit[systemIdx1];
-            vectorN_t const & v1 = vSplit[systemIdx1];
-            frameIndex_t const & frameIdx1 = forceCoupling.frameIdx1;
-            forceVector_t & fext1 = systemsDataHolder_[systemIdx1].state.fExternal;
-
-            // Extract info about the second system involved
             int32_t const & systemIdx2 = forceCoupling.systemIdx2;
-            systemHolder_t const & system2 = systems_[systemIdx2];
-            vectorN_t const & q2 = qSplit[systemIdx2];
-            vectorN_t const & v2 = vSplit[systemIdx2];
-            frameIndex_t const & frameIdx2 = forceCoupling.frameIdx2;
-            forceVector_t & fext2 = systemsDataHolder_[systemIdx2].state.fExternal;
-
-            // Compute the coupling force
-            pinocchio::Force force = forceCoupling.forceFct(t, q1, v1, q2, v2);
-            jointIndex_t const & parentJointIdx1 = system1.robot->pncModel_.frames[frameIdx1].parent;
-            fext1[parentJointIdx1] += convertForceGlobalFrameToJoint(
-                system1.robot->pncModel_, system1.robot->pncData_, frameIdx1, force);
-
-            // Move force from frame1 to frame2 to apply it to the second system
-            force.toVector() *= -1;
-            jointIndex_t const & parentJointIdx2 = system2.robot->pncModel_.frames[frameIdx2].parent;
-            vector3_t const offset = system2.robot->pncData_.oMf[frameIdx2].translation() -
-                                     system1.robot->pncData_.oMf[frameIdx1].translation();
-            force.angular() -= offset.cross(force.linear());
-            fext2[parentJointIdx2] += convertForceGlobalFrameToJoint(
-                system2.robot->pncModel_, system2.robot->pncData_, frameIdx2, force);
+            computeForceCoupling(forceCoupling, t, qSplit[systemIdx1], vSplit[systemIdx1],
+                                 qSplit[systemIdx2], vSplit[systemIdx2]);
+        }
+    }
+
+    void EngineMultiRobot::computeForceCoupling(forceCoupling_t       & forceCoupling,
+                                                float64_t       const & t,
+                                                vectorN_t       const & q1,
+                                                vectorN_t       const & v1,
+                                                vectorN_t       const & q2,
+                                                vectorN_t       const & v2)
+    {
+        // Extract info about the first system involved
+        int32_t const & systemIdx1 = forceCoupling.systemIdx1;
+        systemHolder_t const & system1 = systems_[systemIdx1];
+        frameIndex_t const & frameIdx1 = forceCoupling.frameIdx1;
+        forceVector_t & fext1 = systemsDataHolder_[systemIdx1].state.fExternal;
+
+        // Extract info about the second system involved
+        int32_t const & systemIdx2 = forceCoupling.systemIdx2;
+        systemHolder_t const & system2 = systems_[systemIdx2];
+        frameIndex_t const & frameIdx2 = forceCoupling.frameIdx2;
+        forceVector_t & fext2 = systemsDataHolder_[systemIdx2].state.fExternal;
+
+        // Compute the coupling force
+        pinocchio::Force force = forceCoupling.forceFct(t, q1, v1, q2, v2);
+        jointIndex_t const & parentJointIdx1 = system1.robot->pncModel_.frames[frameIdx1].parent;
+        fext1[parentJointIdx1] += convertForceGlobalFrameToJoint(
+            system1.robot->pncModel_, system1.robot->pncData_, frameIdx1, force);
+
+        // Move force from frame1 to frame2 to apply it to the second system
+        force.toVector() *= -1;
+        jointIndex_t const & parentJointIdx2 = system2.robot->pncModel_.frames[frameIdx2].parent;
+        vector3_t const offset = system2.robot->pncData_.oMf[frameIdx2].translation() -
+                                 system1.robot->pncData_.oMf[frameIdx1].translation();
+        force.angular() -= offset.cross(force.linear());
+        fext2[parentJointIdx2] += convertForceGlobalFrameToJoint(
+            system2.robot->pncModel_, system2.robot->pncData_, frameIdx2, force);
+    }
+
+    void EngineMultiRobot::foreachSystem(std::function<void(std::size_t const &)> const & fct)
+    {
+        if (threadPool_)
+        {
+            threadPool_->parallelFor(systems_.size(), fct);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < systems_.size(); ++i)
+            {
+                fct(i);
+            }
         }
     }
 
+    void EngineMultiRobot::computeSystemTerms(systemHolder_t           & system,
+                                              systemDataHolder_t       & systemData,
+                                              float64_t          const & t,
+                                              vectorN_t          const & q,
+                                              vectorN_t          const & v)
+    {
+        // Define some proxies
+        forceVector_t & fext = systemData.state.fExternal;
+        vectorN_t & uInternal = systemData.state.uInternal;
+
+        /* Compute internal dynamics, namely the efforts in joint space associated
+           with position/velocity bounds dynamics, and flexibility dynamics. */
+        computeInternalDynamics(system, systemData, t, q, v, uInternal);
+
+        /* Compute the collision forces and estimated time at which the contact state
+           will changed (Take-off / Touch-down). */
+        computeCollisionForces(system, systemData, fext);
+
+        // Compute the external contact forces.
+        computeExternalForces(system, systemData, t, q, v, fext);
+    }
+
     void EngineMultiRobot::computeAllTerms(float64_t              const & t,
                                            std::vector<vectorN_t> const & qSplit,
                                            std::vector<vectorN_t> const & vSplit)
@@ -3782,32 +4698,64 @@ namespace jiminy
             systemData.state.uInternal.setZero();
         }
 
-        // Compute the internal forces
+        /* Compute the internal forces and the collisions between bodies.
+           They involve several systems at once, so they must be computed sequentially. */
         computeForcesCoupling(t, qSplit, vSplit);
+        computeBodiesCollisionForces();
 
         // Compute each individual system dynamics
-        auto systemIt = systems_.begin();
-        auto systemDataIt = systemsDataHolder_.begin();
-        auto qIt = qSplit.begin();
-        auto vIt = vSplit.begin();
-        for ( ; systemIt != systems_.end();
-             ++systemIt, ++systemDataIt, ++qIt, ++vIt)
+        foreachSystem(
+            [this, &t, &qSplit, &vSplit](std::size_t const & i)
+            {
+                computeSystemTerms(systems_[i], systemsDataHolder_[i], t, qSplit[i], vSplit[i]);
+            });
+    }
+
+    void EngineMultiRobot::computeSystemDynamics(systemHolder_t           & system,
+                                                 systemDataHolder_t       & systemData,
+                                                 float64_t          const & t,
+                                                 vectorN_t          const & q,
+                                                 vectorN_t          const & v,
+                                                 vectorN_t                & a)
+    {
+        // Define some proxies
+        vectorN_t & u = systemData.state.u;
+        vectorN_t & command = systemData.state.command;
+        vectorN_t & uMotor = systemData.state.uMotor;
+        vectorN_t & uInternal = systemData.state.uInternal;
+        vectorN_t & uCustom = systemData.state.uCustom;
+        forceVector_t & fext = systemData.state.fExternal;
+        vectorN_t const & aPrev = systemData.statePrev.a;
+
+        /* Update the controller command if necessary (only for infinite update frequency).
+           Make sure that the sensor state has been updated beforehand. */
+        if (engineOptions_->stepper.controllerUpdatePeriod < EPS)
         {
-            // Define some proxies
-            forceVector_t & fext = systemDataIt->state.fExternal;
-            vectorN_t & uInternal = systemDataIt->state.uInternal;
+            computeCommand(system, t, q, v, command);
+        }
 
-            /* Compute internal dynamics, namely the efforts in joint space associated
-               with position/velocity bounds dynamics, and flexibility dynamics. */
-            computeInternalDynamics(*systemIt, *systemDataIt, t, *qIt, *vIt, uInternal);
+        /* Compute the actual motor effort.
+           Note that it is impossible to have access to the current accelerations. */
+        system.robot->computeMotorsEfforts(t, q, v, aPrev, command);
+        uMotor = system.robot->getMotorsEfforts();
 
-            /* Compute the collision forces and estimated time at which the contact state
-               will changed (Take-off / Touch-down). */
-            computeCollisionForces(*systemIt, *systemDataIt, fext);
+        /* Compute the user-defined internal dynamics.
+           Make sure that the sensor state has been updated beforehand since
+           the user-defined internal dynamics may rely on it. */
+        uCustom.setZero();
+        system.controller->internalDynamics(t, q, v, uCustom);
 
-            // Compute the external contact forces.
-            computeExternalForces(*systemIt, *systemDataIt, t, *qIt, *vIt, fext);
+        // Compute the total effort vector
+        u = uInternal + uCustom;
+        for (auto const & motor : system.robot->getMotors())
+        {
+            std::size_t const & motorIdx = motor->getIdx();
+            int32_t const & motorVelocityIdx = motor->getJointVelocityIdx();
+            u[motorVelocityIdx] += uMotor[motorIdx];
         }
+
+        // Compute the dynamics
+        a = computeAcceleration(system, systemData, q, v, u, fext);
     }
 
     hresult_t EngineMultiRobot::computeSystemsDynamics(float64_t              const & t,
@@ -3817,7 +4765,11 @@ namespace jiminy
     {
         /* - Note that the position of the free flyer is in world frame,
              whereas the velocities and accelerations are relative to
-             the parent body frame. */
+             the parent body frame.
+           - The systems are only coupled through the coupling forces and the collisions
+             between bodies, which are processed sequentially. Everything else may be
+             processed concurrently, including the sensors, since each robot draws the
+             noise of its sensors from its own random number generator. */
 
         // Make sure that a simulation is running
         if (!isSimulationRunning_)
@@ -3830,16 +4782,13 @@ namespace jiminy
         aSplit.resize(vSplit.size());
 
         // Update the kinematics of each system
-        auto systemIt = systems_.begin();
-        auto systemDataIt = systemsDataHolder_.begin();
-        auto qIt = qSplit.begin();
-        auto vIt = vSplit.begin();
-        for ( ; systemIt != systems_.end();
-             ++systemIt, ++systemDataIt, ++qIt, ++vIt)
-        {
-            vectorN_t const & aPrev = systemDataIt->statePrev.a;
-            computeForwardKinematics(*systemIt, *qIt, *vIt, aPrev);
-        }
+        foreachSystem(
+            [this, &qSplit, &vSplit](std::size_t const & i)
+            {
+                systemDataHolder_t const & systemData = systemsDataHolder_[i];
+                computeForwardKinematics(systems_[i], systemData.kinematicsPlan,
+                                         qSplit[i], vSplit[i], systemData.statePrev.a);
+            });
 
         /* Compute internal and external forces and efforts applied on every systems,
            excluding user-specified internal dynamics if any.
@@ -3847,80 +4796,213 @@ namespace jiminy
            since the force sensor measurements rely on robot_->contactForces_. */
         computeAllTerms(t, qSplit, vSplit);
 
+        /* Update the sensor data if necessary (only for infinite update frequency).
+           Note that it is impossible to have access to the current accelerations
+           and efforts since they depend on the sensor values themselves. */
+        if (engineOptions_->stepper.sensorsUpdatePeriod < EPS)
+        {
+            foreachSystem(
+                [this, &t, &qSplit, &vSplit](std::size_t const & i)
+                {
+                    // Define some proxies
+                    Robot & robot = *systems_[i].robot;
+                    systemDataHolder_t const & systemData = systemsDataHolder_[i];
+
+                    // Roll back to forces and accelerations computed at previous iteration
+                    contactForcesPrev_[i].swap(robot.contactForces_);
+                    fPrev_[i].swap(robot.pncData_.f);
+                    aPrev_[i].swap(robot.pncData_.a);
+
+                    // Update sensors based on previous accelerations and forces
+                    robot.setSensorsData(t, qSplit[i], vSplit[i], systemData.statePrev.a,
+                                         systemData.statePrev.uMotor, systemData.statePrev.fExternal);
+
+                    // Restore current forces and accelerations
+                    contactForcesPrev_[i].swap(robot.contactForces_);
+                    fPrev_[i].swap(robot.pncData_.f);
+                    aPrev_[i].swap(robot.pncData_.a);
+                });
+        }
+
         // Compute each individual system dynamics
-        systemIt = systems_.begin();
-        systemDataIt = systemsDataHolder_.begin();
-        qIt = qSplit.begin();
-        vIt = vSplit.begin();
-        auto contactForcesPrevIt = contactForcesPrev_.begin();
-        auto fPrevIt = fPrev_.begin();
-        auto aPrevIt = aPrev_.begin();
-        auto aIt = aSplit.begin();
-        for ( ; systemIt != systems_.end();
-             ++systemIt, ++systemDataIt, ++qIt, ++vIt, ++aIt, ++contactForcesPrevIt, ++fPrevIt, ++aPrevIt)
-        {
-            // Define some proxies
-            vectorN_t & u = systemDataIt->state.u;
-            vectorN_t & command = systemDataIt->state.command;
-            vectorN_t & uMotor = systemDataIt->state.uMotor;
-            vectorN_t & uInternal = systemDataIt->state.uInternal;
-            vectorN_t & uCustom = systemDataIt->state.uCustom;
-            forceVector_t & fext = systemDataIt->state.fExternal;
-            vectorN_t const & aPrev = systemDataIt->statePrev.a;
-            vectorN_t const & uMotorPrev = systemDataIt->statePrev.uMotor;
-            forceVector_t const & fextPrev = systemDataIt->statePrev.fExternal;
-
-            /* Update the sensor data if necessary (only for infinite update frequency).
-               Note that it is impossible to have access to the current accelerations
-               and efforts since they depend on the sensor values themselves. */
-            if (engineOptions_->stepper.sensorsUpdatePeriod < EPS)
+        foreachSystem(
+            [this, &t, &qSplit, &vSplit, &aSplit](std::size_t const & i)
             {
-                // Roll back to forces and accelerations computed at previous iteration
-                contactForcesPrevIt->swap(systemIt->robot->contactForces_);
-                fPrevIt->swap(systemIt->robot->pncData_.f);
-                aPrevIt->swap(systemIt->robot->pncData_.a);
+                computeSystemDynamics(
+                    systems_[i], systemsDataHolder_[i], t, qSplit[i], vSplit[i], aSplit[i]);
+            });
 
-                // Update sensors based on previous accelerations and forces
-                systemIt->robot->setSensorsData(t, *qIt, *vIt, aPrev, uMotorPrev, fextPrev);
+        return hresult_t::SUCCESS;
+    }
 
-                // Restore current forces and accelerations
-                contactForcesPrevIt->swap(systemIt->robot->contactForces_);
-                fPrevIt->swap(systemIt->robot->pncData_.f);
-                aPrevIt->swap(systemIt->robot->pncData_.a);
+    void EngineMultiRobot::computeSystemLinearization(systemHolder_t           & system,
+                                                      systemDataHolder_t       & systemData,
+                                                      vectorN_t          const & q,
+                                                      vectorN_t          const & v,
+                                                      matrixN_t                & mass,
+                                                      matrixN_t                & stiffness,
+                                                      matrixN_t                & damping)
+    {
+        // Define some proxies
+        pinocchio::Model const & model = system.robot->pncModel_;
+        pinocchio::Data & data = system.robot->pncData_;
+
+        // Make sure the kinematics and the ground below the contact points are up-to-date
+        computeForwardKinematics(system, systemData.kinematicsPlan, q, v, systemData.statePrev.a);
+        computeGroundAtContactFrames(system, systemData);
+
+        // Compute the mass matrix, taking into account the armature (upper triangular part only)
+        if (AbstractDynamicsBackend const * backend = system.robot->getDynamicsBackend().get())
+        {
+            mass = backend->crba(model, data, q);
+        }
+        else
+        {
+            mass = pinocchio_overload::crba(model, data, q);
+        }
+        stiffness.setZero();
+        damping.setZero();
+
+        /* Linearize the flexibilities around the current deformation.
+           The variation of the jacobian of the log map is neglected. */
+        Robot::dynamicsOptions_t const & mdlDynOptions = system.robot->mdlOptions_->dynamics;
+        std::vector<jointIndex_t> const & flexibilityIdx = system.robot->getFlexibleJointsModelIdx();
+        for (std::size_t i = 0; i < flexibilityIdx.size(); ++i)
+        {
+            uint32_t const & velocityIdx = model.joints[flexibilityIdx[i]].idx_v();
+            stiffness.diagonal().segment<3>(velocityIdx) += mdlDynOptions.flexibilityConfig[i].stiffness;
+            damping.diagonal().segment<3>(velocityIdx) += mdlDynOptions.flexibilityConfig[i].damping;
+        }
+
+        /* Linearize the normal spring-damper contact forces of the frames in contact.
+           The friction is not stiff, so it is left explicit. */
+        std::vector<frameIndex_t> const & contactFramesIdx = system.robot->getContactFramesIdx();
+        if (contactModel_ != contactModel_t::SPRING_DAMPER || contactFramesIdx.empty())
+        {
+            return;
+        }
+        contactOptions_t const & contactOptions = engineOptions_->contacts;
+        matrix6N_t & frameJacobian = systemData.contactFrameJacobian;
+        vectorN_t & jacobianNormal = systemData.contactJacobianNormal;
+        pinocchio::computeJointJacobians(model, data);
+        for (std::size_t i = 0; i < contactFramesIdx.size(); ++i)
+        {
+            // Skip the frames that are not in contact
+            Eigen::Index const contactIdx = static_cast<Eigen::Index>(i);
+            vector3_t const nGround = systemData.contactFramesGroundNormals.col(contactIdx);
+            float64_t const & zGround = systemData.contactFramesGroundHeights[contactIdx];
+            float64_t const depth = (data.oMf[contactFramesIdx[i]].translation()[2] - zGround) * nGround[2];
+            if (depth >= 0.0)
+            {
+                continue;
             }
 
-            /* Update the controller command if necessary (only for infinite update frequency).
-               Make sure that the sensor state has been updated beforehand. */
-            if (engineOptions_->stepper.controllerUpdatePeriod < EPS)
+            // Apply the same blending law as the contact force
+            float64_t blendingLaw = 1.0;
+            if (contactOptions.transitionEps > EPS)
+            {
+                blendingLaw = std::tanh(- 2.0 * depth / contactOptions.transitionEps);
+            }
+
+            // Project the normal stiffness and damping in joint space
+            frameJacobian.setZero();
+            pinocchio::getFrameJacobian(
+                model, data, contactFramesIdx[i], pinocchio::LOCAL_WORLD_ALIGNED, frameJacobian);
+            jacobianNormal.noalias() = frameJacobian.topRows<3>().transpose() * nGround;
+            stiffness.noalias() += (blendingLaw * contactOptions.stiffness) * jacobianNormal * jacobianNormal.transpose();
+            damping.noalias() += (blendingLaw * contactOptions.damping) * jacobianNormal * jacobianNormal.transpose();
+        }
+    }
+
+    void EngineMultiRobot::computeSystemsLinearization(float64_t              const & /* t */,
+                                                       std::vector<vectorN_t> const & qSplit,
+                                                       std::vector<vectorN_t> const & vSplit,
+                                                       std::vector<matrixN_t>       & massSplit,
+                                                       std::vector<matrixN_t>       & stiffnessSplit,
+                                                       std::vector<matrixN_t>       & dampingSplit)
+    {
+        foreachSystem(
+            [this, &qSplit, &vSplit, &massSplit, &stiffnessSplit, &dampingSplit](std::size_t const & i)
+            {
+                computeSystemLinearization(systems_[i], systemsDataHolder_[i], qSplit[i], vSplit[i],
+                                           massSplit[i], stiffnessSplit[i], dampingSplit[i]);
+            });
+    }
+
+    void EngineMultiRobot::computeGroupDynamics(systemsGroup_t         const & group,
+                                                float64_t              const & t,
+                                                std::vector<vectorN_t> const & qSplit,
+                                                std::vector<vectorN_t> const & vSplit,
+                                                std::vector<vectorN_t>       & aSplit)
+    {
+        std::vector<std::size_t> const & systemsIdx = group.systemsIdx;
+
+        /* Update the kinematics of each system, then reinitialize the external forces
+           and internal efforts. The other groups are left untouched. */
+        for (std::size_t k = 0; k < systemsIdx.size(); ++k)
+        {
+            systemHolder_t & system = systems_[systemsIdx[k]];
+            systemDataHolder_t & systemData = systemsDataHolder_[systemsIdx[k]];
+            computeForwardKinematics(system, systemData.kinematicsPlan,
+                                     qSplit[k], vSplit[k], systemData.statePrev.a);
+            for (pinocchio::Force & fext_i : systemData.state.fExternal)
             {
-                computeCommand(*systemIt, t, *qIt, *vIt, command);
+                fext_i.setZero();
             }
+            systemData.state.uInternal.setZero();
+        }
 
-            /* Compute the actual motor effort.
-               Note that it is impossible to have access to the current accelerations. */
-            systemIt->robot->computeMotorsEfforts(t, *qIt, *vIt, aPrev, command);
-            uMotor = systemIt->robot->getMotorsEfforts();
+        // Compute the coupling forces between the systems of the group
+        for (std::size_t const & couplingIdx : group.couplingsIdx)
+        {
+            forceCoupling_t & forceCoupling = forcesCoupling_[couplingIdx];
+            auto const systemIt1 = std::lower_bound(
+                systemsIdx.begin(), systemsIdx.end(), static_cast<std::size_t>(forceCoupling.systemIdx1));
+            auto const systemIt2 = std::lower_bound(
+                systemsIdx.begin(), systemsIdx.end(), static_cast<std::size_t>(forceCoupling.systemIdx2));
+            std::size_t const k1 = static_cast<std::size_t>(std::distance(systemsIdx.begin(), systemIt1));
+            std::size_t const k2 = static_cast<std::size_t>(std::distance(systemsIdx.begin(), systemIt2));
+            computeForceCoupling(forceCoupling, t, qSplit[k1], vSplit[k1], qSplit[k2], vSplit[k2]);
+        }
 
-            /* Compute the user-defined internal dynamics.
-               Make sure that the sensor state has been updated beforehand since
-               the user-defined internal dynamics may rely on it. */
-            uCustom.setZero();
-            systemIt->controller->internalDynamics(t, *qIt, *vIt, uCustom);
+        // Compute the efforts and forces applied on each system, then its dynamics
+        for (std::size_t k = 0; k < systemsIdx.size(); ++k)
+        {
+            std::size_t const & i = systemsIdx[k];
+            systemHolder_t & system = systems_[i];
+            systemDataHolder_t & systemData = systemsDataHolder_[i];
+            computeSystemTerms(system, systemData, t, qSplit[k], vSplit[k]);
 
-            // Compute the total effort vector
-            u = uInternal + uCustom;
-            for (auto const & motor : systemIt->robot->getMotors())
+            // Update the sensor data if necessary (only for infinite update frequency)
+            if (engineOptions_->stepper.sensorsUpdatePeriod < EPS)
             {
-                std::size_t const & motorIdx = motor->getIdx();
-                int32_t const & motorVelocityIdx = motor->getJointVelocityIdx();
-                u[motorVelocityIdx] += uMotor[motorIdx];
+                contactForcesPrev_[i].swap(system.robot->contactForces_);
+                fPrev_[i].swap(system.robot->pncData_.f);
+                aPrev_[i].swap(system.robot->pncData_.a);
+                system.robot->setSensorsData(t, qSplit[k], vSplit[k], systemData.statePrev.a,
+                                             systemData.statePrev.uMotor, systemData.statePrev.fExternal);
+                contactForcesPrev_[i].swap(system.robot->contactForces_);
+                fPrev_[i].swap(system.robot->pncData_.f);
+                aPrev_[i].swap(system.robot->pncData_.a);
             }
 
-            // Compute the dynamics
-            *aIt = computeAcceleration(*systemIt, *systemDataIt, *qIt, *vIt, u, fext);
+            computeSystemDynamics(system, systemData, t, qSplit[k], vSplit[k], aSplit[k]);
         }
+    }
 
-        return hresult_t::SUCCESS;
+    void EngineMultiRobot::computeGroupLinearization(systemsGroup_t         const & group,
+                                                     std::vector<vectorN_t> const & qSplit,
+                                                     std::vector<vectorN_t> const & vSplit,
+                                                     std::vector<matrixN_t>       & massSplit,
+                                                     std::vector<matrixN_t>       & stiffnessSplit,
+                                                     std::vector<matrixN_t>       & dampingSplit)
+    {
+        for (std::size_t k = 0; k < group.systemsIdx.size(); ++k)
+        {
+            std::size_t const & i = group.systemsIdx[k];
+            computeSystemLinearization(systems_[i], systemsDataHolder_[i], qSplit[k], vSplit[k],
+                                       massSplit[k], stiffnessSplit[k], dampingSplit[k]);
+        }
     }
 
     vectorN_t const & EngineMultiRobot::computeAcceleration(systemHolder_t & system,
@@ -3936,24 +5018,12 @@ namespace jiminy
 
         if (system.robot->hasConstraints())
         {
-            // Define some proxies for convenience
-            matrix6N_t & jointJacobian = systemData.jointJacobian;
-
             // Compute kinematic constraints
             system.robot->computeConstraints(q, v);
 
             // Project external forces from cartesian space to joint space
             data.u = u;
-            for (int32_t i = 1; i < model.njoints; ++i)
-            {
-                jointJacobian.setZero();
-                pinocchio::getJointJacobian(model,
-                                            data,
-                                            i,
-                                            pinocchio::LOCAL,
-                                            jointJacobian);
-                data.u.noalias() += jointJacobian.transpose() * fext[i].toVector();
-            }
+            pinocchio_overload::computeGeneralizedForces(model, data, fext, data.u);
 
             // Compute non-linear effects
             pinocchio::nonLinearEffects(model, data, q, v);
@@ -4052,7 +5122,11 @@ namespace jiminy
         }
         else
         {
-            // No kinematic constraint: run aba algorithm
+            // No kinematic constraint: run aba algorithm, using the specialized backend if available
+            if (AbstractDynamicsBackend const * backend = system.robot->getDynamicsBackend().get())
+            {
+                return backend->aba(model, data, q, v, u, fext);
+            }
             return pinocchio_overload::aba(model, data, q, v, u, fext);
         }
     }
@@ -4215,8 +5289,161 @@ namespace jiminy
         return hresult_t::ERROR_BAD_INPUT;
     }
 
+    namespace
+    {
+        /// \brief Deflate level of the compressed HDF5 log files.
+        int const HDF5_DEFLATE_LEVEL = 4;
+
+        /// \brief Number of chunks compressed concurrently by each thread before being written,
+        ///        which bounds the memory usage regardless of the size of the log.
+        std::size_t const HDF5_CHUNKS_PER_THREAD = 4U;
+
+        /// \brief Gather a chunk of a given variable, then shuffle its bytes the same way as the
+        ///        shuffle filter of HDF5, ie the i-th byte of every element is stored contiguously.
+        ///
+        /// \details The variables are stored in the rows of a column-major matrix, so gathering
+        ///          and shuffling at once avoids any temporary copy. The end of the last chunk is
+        ///          padded with zeros, since HDF5 always stores full chunks.
+        template<typename Scalar>
+        void shuffleChunk(Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> const & data,
+                          Eigen::Index const & varIdx,
+                          Eigen::Index const & startIdx,
+                          Eigen::Index const & chunkSize,
+                          uint8_t            * buffer)
+        {
+            Eigen::Index const length = std::min(chunkSize, data.cols() - startIdx);
+            for (Eigen::Index t = 0; t < length; ++t)
+            {
+                Scalar const value = data(varIdx, startIdx + t);
+                uint8_t const * bytes = reinterpret_cast<uint8_t const *>(&value);
+                for (std::size_t j = 0; j < sizeof(Scalar); ++j)
+                {
+                    buffer[j * chunkSize + t] = bytes[j];
+                }
+            }
+            for (std::size_t j = 0; j < sizeof(Scalar); ++j)
+            {
+                std::fill(buffer + j * chunkSize + length, buffer + (j + 1) * chunkSize, uint8_t(0));
+            }
+        }
+
+        template<typename Scalar>
+        hresult_t writeVariablesHdf5(H5::Group                                          & variablesGroup,
+                                     std::vector<std::string>::const_iterator             fieldnameIt,
+                                     Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> const & data,
+                                     H5::PredType                                 const & dataType,
+                                     std::string                                  const & compression,
+                                     uint32_t                                     const & chunkSize,
+                                     ThreadPool                                         * threadPool)
+        {
+            hsize_t const numVar = static_cast<hsize_t>(data.rows());
+            hsize_t const numData = static_cast<hsize_t>(data.cols());
+            if (numVar == 0U)
+            {
+                return hresult_t::SUCCESS;
+            }
+            hsize_t const timeDims[1] = {numData};
+            H5::DataSpace const valueSpace(1, timeDims);
+
+            // Enable compression and shuffling, with chunks of bounded size
+            bool_t const isCompressed = (compression != "none");
+            hsize_t const chunkDims[1] = {std::min(static_cast<hsize_t>(chunkSize), numData)};
+            H5::DSetCreatPropList plist;
+            if (isCompressed)
+            {
+                plist.setChunk(1, chunkDims);
+                plist.setShuffle();
+                plist.setDeflate(HDF5_DEFLATE_LEVEL);
+            }
+
+            /* Create the datasets of every variable beforehand, since HDF5 is not thread-safe.
+               Without compression, the values are written right away, directly from the matrix
+               by selecting the right column of it seen as a row-major matrix. */
+            std::vector<H5::DataSet> valueDatasets;
+            valueDatasets.reserve(numVar);
+            hsize_t const memDims[2] = {numData, numVar};
+            H5::DataSpace memSpace(2, memDims);
+            for (hsize_t i = 0; i < numVar; ++i, ++fieldnameIt)
+            {
+                // Create group for field
+                H5::Group fieldGroup(variablesGroup.createGroup(*fieldnameIt));
+
+                // Create time dataset using symbolic link
+                fieldGroup.link(H5L_TYPE_HARD, "/" + GLOBAL_TIME, "time");
+
+                // Create variable dataset
+                valueDatasets.push_back(fieldGroup.createDataSet("value", dataType, valueSpace, plist));
+
+                // Write values in one-shot if not compressed
+                if (!isCompressed)
+                {
+                    hsize_t const start[2] = {0U, i};
+                    hsize_t const count[2] = {numData, 1U};
+                    memSpace.selectHyperslab(H5S_SELECT_SET, count, start);
+                    valueDatasets.back().write(data.data(), dataType, memSpace, valueSpace);
+                }
+            }
+            if (!isCompressed)
+            {
+                return hresult_t::SUCCESS;
+            }
+
+            /* Compress the chunks by batches, then write them directly, bypassing the filter
+               pipeline of HDF5. The buffers are allocated once and reused for every batch. */
+            Eigen::Index const chunkLength = static_cast<Eigen::Index>(chunkDims[0]);
+            std::size_t const numChunksPerVar = (numData + chunkDims[0] - 1U) / chunkDims[0];
+            std::size_t const numChunks = numVar * numChunksPerVar;
+            std::size_t const rawSize = sizeof(Scalar) * static_cast<std::size_t>(chunkLength);
+            std::size_t const batchSize = std::min(
+                numChunks, HDF5_CHUNKS_PER_THREAD * threadPool->getThreadsNum());
+            std::vector<std::vector<uint8_t> > rawBuffers(batchSize, std::vector<uint8_t>(rawSize));
+            std::vector<std::vector<uint8_t> > compressedBuffers(
+                batchSize, std::vector<uint8_t>(compressBound(static_cast<uLong>(rawSize))));
+            std::vector<uLongf> compressedSizes(batchSize);
+            std::vector<int> compressStatus(batchSize);
+            for (std::size_t batchStart = 0; batchStart < numChunks; batchStart += batchSize)
+            {
+                std::size_t const batchLength = std::min(batchSize, numChunks - batchStart);
+                threadPool->parallelFor(batchLength,
+                    [&](std::size_t const & k)
+                    {
+                        std::size_t const chunkIdx = batchStart + k;
+                        Eigen::Index const varIdx = static_cast<Eigen::Index>(chunkIdx / numChunksPerVar);
+                        Eigen::Index const startIdx = static_cast<Eigen::Index>(
+                            (chunkIdx % numChunksPerVar) * chunkDims[0]);
+                        shuffleChunk(data, varIdx, startIdx, chunkLength, rawBuffers[k].data());
+                        compressedSizes[k] = static_cast<uLongf>(compressedBuffers[k].size());
+                        compressStatus[k] = compress2(
+                            compressedBuffers[k].data(), &compressedSizes[k],
+                            rawBuffers[k].data(), static_cast<uLong>(rawSize), HDF5_DEFLATE_LEVEL);
+                    });
+
+                for (std::size_t k = 0; k < batchLength; ++k)
+                {
+                    if (compressStatus[k] != Z_OK)
+                    {
+                        PRINT_ERROR("Impossible to compress the log data.");
+                        return hresult_t::ERROR_GENERIC;
+                    }
+                    std::size_t const chunkIdx = batchStart + k;
+                    hsize_t const offset[1] = {(chunkIdx % numChunksPerVar) * chunkDims[0]};
+                    if (H5Dwrite_chunk(valueDatasets[chunkIdx / numChunksPerVar].getId(), H5P_DEFAULT,
+                                       0U, offset, compressedSizes[k], compressedBuffers[k].data()) < 0)
+                    {
+                        PRINT_ERROR("Impossible to write the log data.");
+                        return hresult_t::ERROR_GENERIC;
+                    }
+                }
+            }
+
+            return hresult_t::SUCCESS;
+        }
+    }
+
     hresult_t writeLogHdf5(std::string                      const & filename,
-                           std::shared_ptr<logData_t const> const & logData)
+                           std::shared_ptr<logData_t const> const & logData,
+                           std::string                      const & compression,
+                           uint32_t                         const & chunkSize)
     {
         // Open HDF5 logfile
         std::unique_ptr<H5::H5File> file;
@@ -4274,14 +5501,6 @@ namespace jiminy
             constantDataSet.write(value, stringType);
         }
 
-        // Temporary contiguous storage for variables
-        Eigen::Matrix<int64_t, Eigen::Dynamic, 1> intVector;
-        Eigen::Matrix<float64_t, Eigen::Dynamic, 1> floatVector;
-
-        // Get the number of integer and float variables
-        Eigen::Index const numInt = logData->intData.rows();
-        Eigen::Index const numFloat = logData->floatData.rows();
-
         /* Add group "variables".
            C++ helper `file->createGroup("variables")` cannot be used
            because we want to preserve order. */
@@ -4291,70 +5510,32 @@ namespace jiminy
         hid_t group_id = H5Gcreate(
             file->getId(), "/variables/",
             H5P_DEFAULT, group_creation_plist, H5P_DEFAULT);
+        H5Pclose(group_creation_plist);
         H5::Group variablesGroup(group_id);
 
-        // Store all integers
-        for (Eigen::Index i = 0; i < numInt; ++i)
+        // Compress the chunks concurrently, since it is by far the most expensive part
+        std::unique_ptr<ThreadPool> threadPool;
+        if (compression != "none")
         {
-            std::string const & key = logData->fieldnames[i];
-
-            // Create group for field
-            H5::Group fieldGroup = variablesGroup.createGroup(key);
-
-            // Enable compression and shuffling
-            H5::DSetCreatPropList plist;
-            hsize_t chunkSize[1];
-            chunkSize[0] = logData->timestamps.size();  // Read the whole vector at once.
-            plist.setChunk(1, chunkSize);
-            plist.setShuffle();
-            plist.setDeflate(4);
-
-            // Create time dataset using symbolic link
-            fieldGroup.link(H5L_TYPE_HARD, "/" + GLOBAL_TIME, "time");
-
-            // Create variable dataset
-            H5::DataSpace valueSpace = H5::DataSpace(1, timeDims);
-            H5::DataSet valueDataset = fieldGroup.createDataSet(
-                "value", H5::PredType::NATIVE_INT64, valueSpace, plist);
-
-            // Write values in one-shot for efficiency
-            intVector = logData->intData.row(i);
-            valueDataset.write(intVector.data(), H5::PredType::NATIVE_INT64);
+            threadPool = std::make_unique<ThreadPool>();
         }
 
-        // Store all floats
-        for (Eigen::Index i = 0; i < numFloat; ++i)
+        // Store all integers, then all floats
+        Eigen::Index const numInt = logData->intData.rows();
+        hresult_t returnCode = writeVariablesHdf5(
+            variablesGroup, logData->fieldnames.begin() + 1, logData->intData,
+            H5::PredType::NATIVE_INT64, compression, chunkSize, threadPool.get());
+        if (returnCode == hresult_t::SUCCESS)
         {
-            std::string const & key = logData->fieldnames[i + 1 + numInt];
-
-            // Create group for field
-            H5::Group fieldGroup(variablesGroup.createGroup(key));
-
-            // Enable compression and shuffling
-            H5::DSetCreatPropList plist;
-            hsize_t chunkSize[1];
-            chunkSize[0] = logData->timestamps.size();  // Read the whole vector at once.
-            plist.setChunk(1, chunkSize);
-            plist.setShuffle();
-            plist.setDeflate(4);
-
-            // Create time dataset using symbolic link
-            fieldGroup.link(H5L_TYPE_HARD, "/" + GLOBAL_TIME, "time");
-
-            // Create variable dataset
-            H5::DataSpace valueSpace = H5::DataSpace(1, timeDims);
-            H5::DataSet valueDataset = fieldGroup.createDataSet(
-                "value", H5::PredType::NATIVE_DOUBLE, valueSpace, plist);
-
-            // Write values
-            floatVector = logData->floatData.row(i);
-            valueDataset.write(floatVector.data(), H5::PredType::NATIVE_DOUBLE);
+            returnCode = writeVariablesHdf5(
+                variablesGroup, logData->fieldnames.begin() + 1 + numInt, logData->floatData,
+                H5::PredType::NATIVE_DOUBLE, compression, chunkSize, threadPool.get());
         }
 
         // Close file once done
         file->close();
 
-        return hresult_t::SUCCESS;
+        return returnCode;
     }
 
     hresult_t EngineMultiRobot::writeLog(std::string const & filename,
@@ -4395,7 +5576,9 @@ namespace jiminy
                 // Write log data
                 if (returnCode == hresult_t::SUCCESS)
                 {
-                    returnCode = writeLogHdf5(filename, logData);
+                    returnCode = writeLogHdf5(filename, logData,
+                                              engineOptions_->telemetry.compression,
+                                              engineOptions_->telemetry.chunkSize);
                 }
             }
             else
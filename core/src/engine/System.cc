@@ -159,4 +159,76 @@ namespace jiminy
         uCustom.resize(0);
         fExternal.clear();
     }
+
+    // ==================================================
+    // ================ kinematicsPlan_t ================
+    // ==================================================
+
+    void kinematicsPlan_t::initialize(Robot const & robot)
+    {
+        pinocchio::Model const & model = robot.pncModel_;
+        pinocchio::GeometryModel const & geomModel = robot.collisionModel_;
+
+        // Dispatch the frames according to the way their placement must be updated
+        clear();
+        for (frameIndex_t i = 1; i < static_cast<frameIndex_t>(model.nframes); ++i)
+        {
+            pinocchio::Frame const & frame = model.frames[i];
+            switch (frame.type)
+            {
+            case pinocchio::FrameType::JOINT:
+                /* If the frame is associated with an actual joint, no need to compute
+                   anything new, since the frame transform is supposed to be identity. */
+                framesFromJoint.emplace_back(i, frame.parent);
+                break;
+            case pinocchio::FrameType::BODY:
+                if (model.frames[frame.previousFrame].type == pinocchio::FrameType::FIXED_JOINT)
+                {
+                    /* BODYs connected via FIXED_JOINT(s) have the same transform than the
+                       joint itself, so no need to compute them twice. The previous frame
+                       is closer to root in kinematic tree, so it has a lower index and
+                       its placement is always updated first. */
+                    framesFromFrame.emplace_back(i, frame.previousFrame);
+                }
+                else
+                {
+                    /* BODYs connected via JOINT(s) have the identity transform, so copying
+                       parent joint transform should be fine. */
+                    framesFromJoint.emplace_back(i, frame.parent);
+                }
+                break;
+            case pinocchio::FrameType::FIXED_JOINT:
+            case pinocchio::FrameType::SENSOR:
+            case pinocchio::FrameType::OP_FRAME:
+            default:
+                // Nothing special, doing the actual computation
+                framesComposed.push_back(i);
+            }
+        }
+
+        /* Gather the geometries involved in at least one collision pair, without
+           repetitions and sorted by index for contiguous access. */
+        std::vector<bool_t> isGeometryActive(geomModel.geometryObjects.size(), false);
+        for (pinocchio::CollisionPair const & pair : geomModel.collisionPairs)
+        {
+            isGeometryActive[pair.first] = true;
+            isGeometryActive[pair.second] = true;
+        }
+        for (geomIndex_t i = 0; i < isGeometryActive.size(); ++i)
+        {
+            if (isGeometryActive[i])
+            {
+                pinocchio::GeometryObject const & geom = geomModel.geometryObjects[i];
+                geometries.push_back({i, geom.parentJoint, geom.placement});
+            }
+        }
+    }
+
+    void kinematicsPlan_t::clear(void)
+    {
+        framesComposed.clear();
+        framesFromJoint.clear();
+        framesFromFrame.clear();
+        geometries.clear();
+    }
 }
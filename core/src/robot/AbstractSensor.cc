@@ -1,11 +1,94 @@
 #include "jiminy/core/robot/Robot.h"
 
 #include "jiminy/core/utilities/Random.h"
+#include "jiminy/core/Constants.h"
 #include "jiminy/core/robot/AbstractSensor.h"
 
 
 namespace jiminy
 {
+    float64_t & SensorSharedDataHolder_t::timeAt(std::size_t const & i)
+    {
+        return time_[static_cast<Eigen::Index>((head_ + i) % static_cast<std::size_t>(time_.size()))];
+    }
+
+    float64_t const & SensorSharedDataHolder_t::timeAt(std::size_t const & i) const
+    {
+        return time_[static_cast<Eigen::Index>((head_ + i) % static_cast<std::size_t>(time_.size()))];
+    }
+
+    Eigen::Block<matrixN_t, Eigen::Dynamic, Eigen::Dynamic, true> SensorSharedDataHolder_t::dataAt(std::size_t const & i)
+    {
+        std::size_t const slot = (head_ + i) % static_cast<std::size_t>(time_.size());
+        return data_.middleCols(static_cast<Eigen::Index>(slot * num_), static_cast<Eigen::Index>(num_));
+    }
+
+    std::ptrdiff_t SensorSharedDataHolder_t::bisectLeft(float64_t const & t) const
+    {
+        // Bisection method can be used since times are sorted
+        std::size_t left = 0;
+        std::size_t right = size_;
+        while (left < right)
+        {
+            std::size_t const mid = (left + right) / 2;
+            if (t < timeAt(mid))
+            {
+                right = mid;
+            }
+            else
+            {
+                left = mid + 1;
+            }
+        }
+        return static_cast<std::ptrdiff_t>(left) - 1;
+    }
+
+    void SensorSharedDataHolder_t::resetBuffer(matrixN_t const & data,
+                                               float64_t const & t)
+    {
+        time_ = vectorN_t::Constant(1, t);
+        data_ = data;
+        head_ = 0U;
+        size_ = 1U;
+    }
+
+    void SensorSharedDataHolder_t::reserve(std::size_t const & capacity)
+    {
+        // Copy the stored timesteps in chronological order, starting at the beginning of the new buffer
+        vectorN_t time(static_cast<Eigen::Index>(capacity));
+        matrixN_t data(data_.rows(), static_cast<Eigen::Index>(capacity * num_));
+        for (std::size_t i = 0; i < size_; ++i)
+        {
+            time[static_cast<Eigen::Index>(i)] = timeAt(i);
+            data.middleCols(static_cast<Eigen::Index>(i * num_), static_cast<Eigen::Index>(num_)) = dataAt(i);
+        }
+        time_.swap(time);
+        data_.swap(data);
+        head_ = 0U;
+    }
+
+    void SensorSharedDataHolder_t::pushBack(float64_t const & t)
+    {
+        if (size_ == static_cast<std::size_t>(time_.size()))
+        {
+            reserve(size_ + DELAY_MIN_BUFFER_RESERVE);
+        }
+        ++size_;
+        timeAt(size_ - 1) = t;
+        dataAt(size_ - 1) = dataAt(size_ - 2);
+    }
+
+    void SensorSharedDataHolder_t::popBack(void)
+    {
+        --size_;
+    }
+
+    void SensorSharedDataHolder_t::popFront(void)
+    {
+        head_ = (head_ + 1) % static_cast<std::size_t>(time_.size());
+        --size_;
+    }
+
     AbstractSensorBase::AbstractSensorBase(std::string const & name) :
     baseSensorOptions_(nullptr),
     sensorOptionsHolder_(),
@@ -14,7 +97,9 @@ namespace jiminy
     isTelemetryConfigured_(false),
     robot_(),
     name_(name),
-    telemetrySender_()
+    noise_(),
+    telemetrySender_(),
+    telemetryHandle_()
     {
         // Initialize the options
         setOptions(getDefaultSensorOptions());
@@ -33,7 +118,8 @@ namespace jiminy
 
         if (returnCode == hresult_t::SUCCESS)
         {
-            if (!isTelemetryConfigured_)
+            // The variables must be registered again if the telemetry has been reset meanwhile
+            if (!isTelemetryConfigured_ || !telemetrySender_.getIsConfigured())
             {
                 if (telemetryData)
                 {
@@ -43,7 +129,7 @@ namespace jiminy
                         objectName = objectPrefixName + TELEMETRY_FIELDNAME_DELIMITER + objectName;
                     }
                     telemetrySender_.configureObject(telemetryData, objectName);
-                    returnCode = telemetrySender_.registerVariable(getFieldnames(), get());
+                    returnCode = telemetrySender_.registerVariable(getFieldnames(), get(), telemetryHandle_);
                     if (returnCode == hresult_t::SUCCESS)
                     {
                         isTelemetryConfigured_ = true;
@@ -64,7 +150,7 @@ namespace jiminy
     {
         if (isTelemetryConfigured_)
         {
-            telemetrySender_.updateValue(getFieldnames(), get());
+            telemetrySender_.updateValue(telemetryHandle_, get());
         }
     }
 
@@ -73,7 +159,8 @@ namespace jiminy
         // Add white noise
         if (baseSensorOptions_->noiseStd.size())
         {
-            get() += randVectorNormal(baseSensorOptions_->noiseStd);
+            fillRandomNormal(robot_.lock()->generator_, noise_, baseSensorOptions_->noiseStd);
+            get() += noise_;
         }
 
         // Add bias
@@ -87,6 +174,7 @@ namespace jiminy
     {
         sensorOptionsHolder_ = sensorOptions;
         baseSensorOptions_ = std::make_unique<abstractSensorOptions_t const>(sensorOptionsHolder_);
+        noise_.resize(baseSensorOptions_->noiseStd.size());
         return hresult_t::SUCCESS;
     }
 
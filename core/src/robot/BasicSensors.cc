@@ -193,7 +193,8 @@ namespace jiminy
         if (baseSensorOptions_->noiseStd.size())
         {
             // Accel + gyroscope: simply apply additive noise
-            get() += randVectorNormal(baseSensorOptions_->noiseStd);
+            fillRandomNormal(robot_.lock()->generator_, noise_, baseSensorOptions_->noiseStd);
+            get() += noise_;
         }
 
         // Add measurement bias
@@ -0,0 +1,142 @@
+#include <mutex>
+#include <algorithm>
+
+#include "pinocchio/multibody/model.hpp"  // `pinocchio::Model`
+
+#include "jiminy/core/robot/DynamicsBackend.h"
+
+
+namespace jiminy
+{
+    namespace
+    {
+        struct dynamicsBackendRegistry_t
+        {
+            std::mutex mutex;
+            std::vector<std::shared_ptr<AbstractDynamicsBackend const> > backends;
+        };
+
+        /* The registry is a function-local static, so that it is initialized on first use. It is
+           required since the backends are registered during static initialization, the order of
+           which is unspecified across translation units. */
+        dynamicsBackendRegistry_t & getDynamicsBackendRegistry(void)
+        {
+            static dynamicsBackendRegistry_t registry;
+            return registry;
+        }
+    }
+
+    bool_t modelTopology_t::operator == (modelTopology_t const & other) const
+    {
+        return nq == other.nq && nv == other.nv
+            && parents == other.parents && jointsShortname == other.jointsShortname;
+    }
+
+    modelTopology_t getModelTopology(pinocchio::Model const & model)
+    {
+        modelTopology_t topology;
+        topology.nq = model.nq;
+        topology.nv = model.nv;
+        for (int32_t i = 1; i < model.njoints; ++i)
+        {
+            topology.jointsShortname.push_back(model.joints[i].shortname());
+            topology.parents.push_back(model.parents[i]);
+        }
+        return topology;
+    }
+
+    AbstractDynamicsBackend::AbstractDynamicsBackend(std::string     const & name,
+                                                     modelTopology_t const & topology) :
+    name_(name),
+    topology_(topology)
+    {
+        // Empty on purpose
+    }
+
+    std::string const & AbstractDynamicsBackend::getName(void) const
+    {
+        return name_;
+    }
+
+    modelTopology_t const & AbstractDynamicsBackend::getTopology(void) const
+    {
+        return topology_;
+    }
+
+    bool_t AbstractDynamicsBackend::isCompatible(pinocchio::Model const & model) const
+    {
+        // Quick rejection before comparing the type of every joint
+        if (model.nq != topology_.nq || model.nv != topology_.nv
+         || static_cast<std::size_t>(model.njoints) != topology_.parents.size() + 1U)
+        {
+            return false;
+        }
+        return getModelTopology(model) == topology_;
+    }
+
+    hresult_t registerDynamicsBackend(std::shared_ptr<AbstractDynamicsBackend const> backend)
+    {
+        if (!backend)
+        {
+            PRINT_ERROR("The backend must not be empty.");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+
+        dynamicsBackendRegistry_t & registry = getDynamicsBackendRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto backendIt = std::find_if(registry.backends.begin(), registry.backends.end(),
+                                      [&backend](auto const & elem)
+                                      {
+                                          return elem->getName() == backend->getName();
+                                      });
+        if (backendIt != registry.backends.end())
+        {
+            PRINT_ERROR("A backend named '", backend->getName(), "' is already registered.");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+        registry.backends.push_back(std::move(backend));
+
+        return hresult_t::SUCCESS;
+    }
+
+    std::shared_ptr<AbstractDynamicsBackend const> findDynamicsBackend(pinocchio::Model const & model)
+    {
+        dynamicsBackendRegistry_t & registry = getDynamicsBackendRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (auto const & backend : registry.backends)
+        {
+            if (backend->isCompatible(model))
+            {
+                return backend;
+            }
+        }
+        return {};
+    }
+
+    std::shared_ptr<AbstractDynamicsBackend const> findDynamicsBackend(std::string const & name)
+    {
+        dynamicsBackendRegistry_t & registry = getDynamicsBackendRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (auto const & backend : registry.backends)
+        {
+            if (backend->getName() == name)
+            {
+                return backend;
+            }
+        }
+        return {};
+    }
+
+    std::vector<std::string> getDynamicsBackendNames(void)
+    {
+        dynamicsBackendRegistry_t & registry = getDynamicsBackendRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        std::vector<std::string> names;
+        names.reserve(registry.backends.size());
+        for (auto const & backend : registry.backends)
+        {
+            names.push_back(backend->getName());
+        }
+        return names;
+    }
+}
@@ -27,6 +27,7 @@
 
 #include "jiminy/core/robot/BasicSensors.h"
 #include "jiminy/core/robot/PinocchioOverloadAlgorithms.h"
+#include "jiminy/core/robot/DynamicsBackend.h"
 #include "jiminy/core/constraints/AbstractConstraint.h"
 #include "jiminy/core/constraints/JointConstraint.h"
 #include "jiminy/core/constraints/SphereConstraint.h"
@@ -188,6 +189,7 @@ namespace jiminy
     visualData_(),
     mdlOptions_(nullptr),
     contactForces_(),
+    generator_(),
     isInitialized_(false),
     urdfPath_(),
     urdfData_(),
@@ -213,11 +215,17 @@ namespace jiminy
     logFieldnamesVelocity_(),
     logFieldnamesAcceleration_(),
     logFieldnamesForceExternal_(),
+    dynamicsBackend_(),
+    dynamicsBackendForced_(),
     pncModelFlexibleOrig_(),
     jointsAcceleration_(),
+    qNeutral_(),
+    vZero_(),
     nq_(0),
     nv_(0),
-    nx_(0)
+    nx_(0),
+    pncModelOrigBackup_(),
+    areModelsInvalid_(true)
     {
         setOptions(getDefaultModelOptions());
     }
@@ -374,12 +382,20 @@ namespace jiminy
 
         if (isInitialized_)
         {
-            /* Re-generate the true flexible model in case the original rigid
-               model has been manually modified by the user. */
-            generateModelFlexible();
-
-            // Update the biases added to the dynamics properties of the model
-            generateModelBiased();
+            /* Re-generate the true flexible model only if the options have changed, or
+               if the original rigid model has been manually modified by the user. */
+            if (areModelsInvalid_ || !(pncModelOrig_ == pncModelOrigBackup_))
+            {
+                generateModelFlexible();
+                generateModelBiased();
+            }
+            else
+            {
+                /* Draw new biases for the dynamics properties of the model in place.
+                   The topology is unchanged, so there is no need to re-allocate the
+                   data nor to refresh the proxies. */
+                updateModelBiased();
+            }
         }
     }
 
@@ -1114,66 +1130,22 @@ namespace jiminy
             // Initially set effortLimit to zero systematically
             pncModel_.effortLimit.setZero();
 
-            for (std::string const & jointName : rigidJointsNames_)
-            {
-                jointIndex_t const & jointIdx = pncModel_.getJointId(jointName);
+            // Add biases to the dynamics properties of the model
+            applyModelBiases();
 
-                // Add bias to com position
-                float64_t const & comBiasStd = mdlOptions_->dynamics.centerOfMassPositionBodiesBiasStd;
-                if (comBiasStd > EPS)
-                {
-                    vector3_t & comRelativePositionBody = pncModel_.inertias[jointIdx].lever();
-                    comRelativePositionBody.array() *= 1.0 + randVectorNormal(3U, comBiasStd).array();
-                }
-
-                /* Add bias to body mass.
-                   Note that it cannot be less than min(original mass, 1g) for numerical stability. */
-                float64_t const & massBiasStd = mdlOptions_->dynamics.massBodiesBiasStd;
-                if (massBiasStd > EPS)
-                {
-                    float64_t & massBody = pncModel_.inertias[jointIdx].mass();
-                    massBody = std::max(massBody * (1.0 + randNormal(0.0, massBiasStd)),
-                                        std::min(massBody, 1.0e-3));
-                }
-
-                /* Add bias to inertia matrix of body.
-                   To preserve positive semi-definite property after noise addition, the principal
-                   axes and moments are computed from the original inertia matrix, then independent
-                   gaussian distributed noise is added on each principal moments, and a random small
-                   rotation is applied to the principal axes based on a randomly generated rotation
-                   axis. Finally, the biased inertia matrix is obtained doing A @ diag(M) @ A.T.
-                   If no bias, the original inertia matrix is recovered. */
-                float64_t const & inertiaBiasStd = mdlOptions_->dynamics.inertiaBodiesBiasStd;
-                if (inertiaBiasStd > EPS)
-                {
-                    pinocchio::Symmetric3 & inertiaBody = pncModel_.inertias[jointIdx].inertia();
-                    Eigen::SelfAdjointEigenSolver<matrix3_t> solver(inertiaBody.matrix());
-                    vector3_t inertiaBodyMoments = solver.eigenvalues();
-                    matrix3_t inertiaBodyAxes = solver.eigenvectors();
-                    vector3_t const randAxis = randVectorNormal(3U, inertiaBiasStd);
-                    inertiaBodyAxes = inertiaBodyAxes * quaternion_t(pinocchio::exp3(randAxis));
-                    inertiaBodyMoments.array() *= 1.0 + randVectorNormal(3U, inertiaBiasStd).array();
-                    inertiaBody = pinocchio::Symmetric3((
-                        inertiaBodyAxes * inertiaBodyMoments.asDiagonal() * inertiaBodyAxes.transpose()).eval());
-                }
-
-                // Add bias to relative body position (rotation excluded !)
-                float64_t const & relativeBodyPosBiasStd = mdlOptions_->dynamics.relativePositionBodiesBiasStd;
-                if (relativeBodyPosBiasStd > EPS)
-                {
-                    vector3_t & relativePositionBody = pncModel_.jointPlacements[jointIdx].translation();
-                    relativePositionBody.array() *= 1.0 + randVectorNormal(3U, relativeBodyPosBiasStd).array();
-                }
-            }
+            // Neutral configuration and zero velocity, kept for the next resets
+            qNeutral_ = pinocchio::neutral(pncModel_);
+            vZero_.setZero(pncModel_.nv);
 
             // Initialize Pinocchio Data internal state
             pncData_ = pinocchio::Data(pncModel_);
-            pinocchio::forwardKinematics(pncModel_, pncData_,
-                                         pinocchio::neutral(pncModel_),
-                                         vectorN_t::Zero(pncModel_.nv));
+            pinocchio::forwardKinematics(pncModel_, pncData_, qNeutral_, vZero_);
             pinocchio::updateFramePlacements(pncModel_, pncData_);
-            pinocchio::centerOfMass(pncModel_, pncData_,
-                                    pinocchio::neutral(pncModel_));
+            pinocchio::centerOfMass(pncModel_, pncData_, qNeutral_);
+
+            // Backup the original model from which it has been generated, to detect any change
+            pncModelOrigBackup_ = pncModelOrig_;
+            areModelsInvalid_ = false;
 
             // Refresh internal proxies
             returnCode = refreshProxies();
@@ -1182,6 +1154,80 @@ namespace jiminy
         return returnCode;
     }
 
+    void Model::updateModelBiased(void)
+    {
+        /* Restore the original dynamics properties. The size of the vectors is unchanged,
+           so that they are copied without any memory allocation. */
+        pinocchio::Model const & pncModelSource =
+            mdlOptions_->dynamics.enableFlexibleModel ? pncModelFlexibleOrig_ : pncModelOrig_;
+        pncModel_.inertias = pncModelSource.inertias;
+        pncModel_.jointPlacements = pncModelSource.jointPlacements;
+
+        // Add new biases to the dynamics properties of the model
+        applyModelBiases();
+
+        /* Update the kinematic quantities stored in data that depend on them. The neutral
+           configuration only depends on the topology, so it is still up-to-date. */
+        pinocchio::forwardKinematics(pncModel_, pncData_, qNeutral_, vZero_);
+        pinocchio::updateFramePlacements(pncModel_, pncData_);
+        pinocchio::centerOfMass(pncModel_, pncData_, qNeutral_);
+    }
+
+    void Model::applyModelBiases(void)
+    {
+        for (std::string const & jointName : rigidJointsNames_)
+        {
+            jointIndex_t const & jointIdx = pncModel_.getJointId(jointName);
+
+            // Add bias to com position
+            float64_t const & comBiasStd = mdlOptions_->dynamics.centerOfMassPositionBodiesBiasStd;
+            if (comBiasStd > EPS)
+            {
+                vector3_t & comRelativePositionBody = pncModel_.inertias[jointIdx].lever();
+                comRelativePositionBody.array() *= 1.0 + randVectorNormal(generator_, 3U, comBiasStd).array();
+            }
+
+            /* Add bias to body mass.
+               Note that it cannot be less than min(original mass, 1g) for numerical stability. */
+            float64_t const & massBiasStd = mdlOptions_->dynamics.massBodiesBiasStd;
+            if (massBiasStd > EPS)
+            {
+                float64_t & massBody = pncModel_.inertias[jointIdx].mass();
+                massBody = std::max(massBody * (1.0 + randNormal(generator_, 0.0, massBiasStd)),
+                                    std::min(massBody, 1.0e-3));
+            }
+
+            /* Add bias to inertia matrix of body.
+               To preserve positive semi-definite property after noise addition, the principal
+               axes and moments are computed from the original inertia matrix, then independent
+               gaussian distributed noise is added on each principal moments, and a random small
+               rotation is applied to the principal axes based on a randomly generated rotation
+               axis. Finally, the biased inertia matrix is obtained doing A @ diag(M) @ A.T.
+               If no bias, the original inertia matrix is recovered. */
+            float64_t const & inertiaBiasStd = mdlOptions_->dynamics.inertiaBodiesBiasStd;
+            if (inertiaBiasStd > EPS)
+            {
+                pinocchio::Symmetric3 & inertiaBody = pncModel_.inertias[jointIdx].inertia();
+                Eigen::SelfAdjointEigenSolver<matrix3_t> solver(inertiaBody.matrix());
+                vector3_t inertiaBodyMoments = solver.eigenvalues();
+                matrix3_t inertiaBodyAxes = solver.eigenvectors();
+                vector3_t const randAxis = randVectorNormal(generator_, 3U, inertiaBiasStd);
+                inertiaBodyAxes = inertiaBodyAxes * quaternion_t(pinocchio::exp3(randAxis));
+                inertiaBodyMoments.array() *= 1.0 + randVectorNormal(generator_, 3U, inertiaBiasStd).array();
+                inertiaBody = pinocchio::Symmetric3((
+                    inertiaBodyAxes * inertiaBodyMoments.asDiagonal() * inertiaBodyAxes.transpose()).eval());
+            }
+
+            // Add bias to relative body position (rotation excluded !)
+            float64_t const & relativeBodyPosBiasStd = mdlOptions_->dynamics.relativePositionBodiesBiasStd;
+            if (relativeBodyPosBiasStd > EPS)
+            {
+                vector3_t & relativePositionBody = pncModel_.jointPlacements[jointIdx].translation();
+                relativePositionBody.array() *= 1.0 + randVectorNormal(generator_, 3U, relativeBodyPosBiasStd).array();
+            }
+        }
+    }
+
     void Model::computeConstraints(vectorN_t const & q,
                                    vectorN_t const & v)
     {
@@ -1205,7 +1251,14 @@ namespace jiminy
            `computeJointJacobians` manually. However, it is less stable
            numerically, and it messes some variables (Ycrb[0] keeps accumulating
            and com[0] is "wrongly defined"). So using it must be avoided. */
-        pinocchio_overload::crba(pncModel_, pncData_, q);
+        if (dynamicsBackend_)
+        {
+            dynamicsBackend_->crba(pncModel_, pncData_, q);
+        }
+        else
+        {
+            pinocchio_overload::crba(pncModel_, pncData_, q);
+        }
 
         /* Computing forward kinematics without acceleration to get the drift.
            Note that it will alter the actual joints spatial accelerations, so
@@ -1444,9 +1497,40 @@ namespace jiminy
             returnCode = refreshConstraintsProxies();
         }
 
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            refreshDynamicsBackend();
+        }
+
         return returnCode;
     }
 
+    void Model::refreshDynamicsBackend(void)
+    {
+        dynamicsBackend_.reset();
+        if (!mdlOptions_->dynamics.enableDynamicsBackend)
+        {
+            return;
+        }
+
+        if (dynamicsBackendForced_)
+        {
+            if (dynamicsBackendForced_->isCompatible(pncModel_))
+            {
+                dynamicsBackend_ = dynamicsBackendForced_;
+            }
+            else
+            {
+                PRINT_WARNING("The dynamics backend '", dynamicsBackendForced_->getName(), "' is not "
+                              "compatible with the model anymore. Falling back to generic algorithms.");
+            }
+        }
+        else
+        {
+            dynamicsBackend_ = findDynamicsBackend(pncModel_);
+        }
+    }
+
     hresult_t Model::refreshGeometryProxies(void)
     {
         hresult_t returnCode = hresult_t::SUCCESS;
@@ -1696,6 +1780,13 @@ namespace jiminy
             {
                 areModelsInvalid = true;
             }
+
+            // Check if the specialized dynamics backend must be selected again
+            bool_t const & enableDynamicsBackend = boost::get<bool_t>(dynOptionsHolder.at("enableDynamicsBackend"));
+            if (mdlOptions_ && enableDynamicsBackend != mdlOptions_->dynamics.enableDynamicsBackend)
+            {
+                internalBuffersMustBeUpdated = true;
+            }
         }
 
         // Check that the collisions options are valid
@@ -1736,6 +1827,7 @@ namespace jiminy
         if (areModelsInvalid)
         {
             // Trigger models regeneration
+            areModelsInvalid_ = true;
             reset();
         }
         else if (internalBuffersMustBeUpdated)
@@ -1787,6 +1879,31 @@ namespace jiminy
         return hasFreeflyer_;
     }
 
+    hresult_t Model::setDynamicsBackend(std::shared_ptr<AbstractDynamicsBackend const> backend)
+    {
+        if (!isInitialized_)
+        {
+            PRINT_ERROR("Model not initialized.");
+            return hresult_t::ERROR_INIT_FAILED;
+        }
+
+        if (backend && !backend->isCompatible(pncModel_))
+        {
+            PRINT_ERROR("The dynamics backend '", backend->getName(), "' is not compatible with the model.");
+            return hresult_t::ERROR_BAD_INPUT;
+        }
+
+        dynamicsBackendForced_ = std::move(backend);
+        refreshDynamicsBackend();
+
+        return hresult_t::SUCCESS;
+    }
+
+    std::shared_ptr<AbstractDynamicsBackend const> const & Model::getDynamicsBackend(void) const
+    {
+        return dynamicsBackend_;
+    }
+
     hresult_t Model::getFlexibleConfigurationFromRigid(vectorN_t const & qRigid,
                                                        vectorN_t       & qFlex) const
     {
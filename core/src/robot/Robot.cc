@@ -8,6 +8,7 @@
 #include "jiminy/core/utilities/Helpers.h"
 #include "jiminy/core/utilities/Pinocchio.h"
 #include "jiminy/core/utilities/Json.h"
+#include "jiminy/core/utilities/StateArchive.h"
 
 #include "jiminy/core/robot/Robot.h"
 
@@ -1295,6 +1296,44 @@ namespace jiminy
         }
     }
 
+    void Robot::processState(StateArchive & archive)
+    {
+        // Random number generator used for the noise of the sensors
+        archive.process(generator_);
+
+        // Efforts of the motors
+        archive.process(motorsSharedHolder_->data_);
+
+        for (auto & sensorSharedItem : sensorsSharedHolder_)
+        {
+            SensorSharedDataHolder_t & sensorShared = *sensorSharedItem.second;
+
+            // Current measurements
+            archive.process(sensorShared.dataMeasured_);
+
+            /* Past data of the sensors in chronological order. The ring buffer may have
+               been reallocated meanwhile, so its layout is not saved as is. */
+            std::size_t const dataSize = static_cast<std::size_t>(sensorShared.data_.rows()) * sensorShared.num_;
+            archive.checkSize(dataSize);
+            std::size_t size = sensorShared.size_;
+            archive.processSize(size);
+            if (archive.getMode() == archiveMode_t::RESTORE)
+            {
+                if (size > static_cast<std::size_t>(sensorShared.time_.size()))
+                {
+                    sensorShared.reserve(size);
+                }
+                sensorShared.head_ = 0U;
+                sensorShared.size_ = size;
+            }
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                archive.process(&sensorShared.timeAt(i), 1U);
+                archive.process(sensorShared.dataAt(i).data(), dataSize);
+            }
+        }
+    }
+
     hresult_t Robot::getLock(std::unique_ptr<LockGuardLocal> & lock)
     {
         if (mutexLocal_->isLocked())
@@ -1,3 +1,6 @@
+#include <tuple>
+#include <numeric>
+
 #include "pinocchio/multibody/model.hpp"     // `pinocchio::Model`
 #include "pinocchio/multibody/data.hpp"      // `pinocchio::Data`
 #include "pinocchio/algorithm/cholesky.hpp"  // `pinocchio::cholesky::`
@@ -6,6 +9,7 @@
 #include "jiminy/core/constraints/AbstractConstraint.h"
 #include "jiminy/core/utilities/Random.h"
 #include "jiminy/core/utilities/Helpers.h"
+#include "jiminy/core/utilities/StateArchive.h"
 #include "jiminy/core/Constants.h"
 
 #include "jiminy/core/solver/ConstraintSolvers.h"
@@ -13,14 +17,20 @@
 
 namespace jiminy
 {
-    PGSSolver::PGSSolver(pinocchio::Model const * model,
-                         pinocchio::Data * data,
-                         constraintsHolder_t * constraintsHolder,
-                         float64_t const & friction,
-                         float64_t const & torsion,
-                         float64_t const & tolAbs,
-                         float64_t const & tolRel,
-                         uint32_t const & maxIter) :
+    void AbstractConstraintSolver::processState(StateArchive & archive)
+    {
+        archive.process(iterNum_);
+    }
+
+    AbstractBoxedConstraintSolver::AbstractBoxedConstraintSolver(pinocchio::Model const * model,
+                                                                 pinocchio::Data * data,
+                                                                 constraintsHolder_t * constraintsHolder,
+                                                                 float64_t const & friction,
+                                                                 float64_t const & torsion,
+                                                                 float64_t const & tolAbs,
+                                                                 float64_t const & tolRel,
+                                                                 uint32_t const & maxIter) :
+    AbstractConstraintSolver(),
     model_(model),
     data_(data),
     maxIter_(maxIter),
@@ -30,9 +40,8 @@ namespace jiminy
     gamma_(),
     lambda_(),
     constraintsData_(),
-    b_(),
-    y_(),
-    yPrev_()
+    jacobianBlocks_(),
+    b_()
     {
         Eigen::Index constraintsRowsMax = 0U;
         constraintsHolder->foreach(
@@ -91,6 +100,28 @@ namespace jiminy
                 }
                 constraintData.dim = constraintDim;
                 constraintData.constraint = constraint.get();
+                constraintData.mode = contactMode_t::STICKING;
+                constraintData.isSkipped = false;
+
+                /* Expand the column support of the jacobian.
+                   It is considered dense if the constraint does not provide it. */
+                auto const & jacobianSupport = constraint->getJacobianSupport();
+                if (jacobianSupport.empty())
+                {
+                    constraintData.colsIdx.resize(static_cast<std::size_t>(model_->nv));
+                    std::iota(constraintData.colsIdx.begin(), constraintData.colsIdx.end(), 0);
+                }
+                else
+                {
+                    for (auto const & slice : jacobianSupport)
+                    {
+                        for (Eigen::Index i = slice.first; i < slice.first + slice.second; ++i)
+                        {
+                            constraintData.colsIdx.push_back(i);
+                        }
+                    }
+                }
+
                 constraintsData_.emplace_back(std::move(constraintData));
                 constraintsRowsMax += constraintDim;
             });
@@ -100,14 +131,46 @@ namespace jiminy
         gamma_.resize(constraintsRowsMax);
         lambda_.resize(constraintsRowsMax);
         b_.resize(constraintsRowsMax);
-        y_.resize(constraintsRowsMax);
-        yPrev_.resize(constraintsRowsMax);
+        jacobianBlocks_.reserve(constraintsData_.size());
+    }
+
+    void AbstractBoxedConstraintSolver::processState(StateArchive & archive)
+    {
+        AbstractConstraintSolver::processState(archive);
+
+        // Mode of the constraints at the end of the last solve, used to warm-start the next one
+        archive.checkSize(constraintsData_.size());
+        for (ConstraintData & constraintData : constraintsData_)
+        {
+            archive.process(constraintData.mode);
+            archive.process(constraintData.isSkipped);
+        }
+        archive.process(lambda_);
+    }
+
+    PGSSolver::PGSSolver(pinocchio::Model const * model,
+                         pinocchio::Data * data,
+                         constraintsHolder_t * constraintsHolder,
+                         float64_t const & friction,
+                         float64_t const & torsion,
+                         float64_t const & tolAbs,
+                         float64_t const & tolRel,
+                         uint32_t const & maxIter) :
+    AbstractBoxedConstraintSolver(
+        model, data, constraintsHolder, friction, torsion, tolAbs, tolRel, maxIter),
+    y_(b_.size())
+    {
+        // Empty on purpose
     }
 
-    void PGSSolver::ProjectedGaussSeidelIter(matrixN_t const & A,
-                                             vectorN_t::SegmentReturnType const & b,
-                                             vectorN_t::SegmentReturnType & x)
+    std::pair<float64_t, float64_t> PGSSolver::ProjectedGaussSeidelIter(matrixN_t const & A,
+                                                                        vectorN_t::SegmentReturnType const & b,
+                                                                        vectorN_t::SegmentReturnType & x)
     {
+        // Keep track of the largest variation and value of the multipliers
+        float64_t dxMax = 0.0;
+        float64_t xMax = 0.0;
+
         // First, loop over all unbounded constraints
         for (ConstraintData const & constraintData : constraintsData_)
         {
@@ -123,7 +186,10 @@ namespace jiminy
             for (; i < endIdx ; ++i)
             {
                 y_[i] = b[i] - A.col(i).dot(x);
-                x[i] += y_[i] / A(i, i);
+                float64_t const dx = y_[i] / A(i, i);
+                x[i] += dx;
+                dxMax = std::max(dxMax, std::abs(dx));
+                xMax = std::max(xMax, std::abs(x[i]));
             }
         }
 
@@ -135,8 +201,8 @@ namespace jiminy
         {
             for (ConstraintData const & constraintData : constraintsData_)
             {
-                // Bypass inactive or unbounded constraints or no block left
-                if (constraintData.isInactive || constraintData.nBlocks <= i)
+                // Bypass inactive, skipped or unbounded constraints or no block left
+                if (constraintData.isInactive || constraintData.isSkipped || constraintData.nBlocks <= i)
                 {
                     continue;
                 }
@@ -163,6 +229,13 @@ namespace jiminy
                     continue;
                 }
 
+                // Backup the coefficients before update
+                float64_t xPrev[3];
+                for (std::uint_fast8_t j = 0; j < std::max(fSize - 1, 1); ++j)
+                {
+                    xPrev[j] = x[o + fIdx[j]];
+                }
+
                 // Update several coefficients at once with the same step
                 float64_t A_max = A(i0, i0);
                 y_[i0] = b[i0] - A.col(i0).dot(x);
@@ -217,13 +290,23 @@ namespace jiminy
                         }
                     }
                 }
+
+                // Update the largest variation and value of the multipliers
+                for (std::uint_fast8_t j = 0; j < std::max(fSize - 1, 1); ++j)
+                {
+                    float64_t const & xj = x[o + fIdx[j]];
+                    dxMax = std::max(dxMax, std::abs(xj - xPrev[j]));
+                    xMax = std::max(xMax, std::abs(xj));
+                }
             }
         }
+
+        return {dxMax, xMax};
     }
 
-    bool_t PGSSolver::ProjectedGaussSeidelSolver(matrixN_t const & A,
-                                                 vectorN_t::SegmentReturnType const & b,
-                                                 vectorN_t::SegmentReturnType & x)
+    bool_t PGSSolver::SolveBoxedLCP(matrixN_t const & A,
+                                    vectorN_t::SegmentReturnType const & b,
+                                    vectorN_t::SegmentReturnType & x)
     {
         /* For some reason, it is impossible to get a better accuracy than 1e-5
            for the absolute tolerance, even if unconstrained. It seems to be
@@ -231,35 +314,116 @@ namespace jiminy
 
         assert(b.size() > 0 && "The number of inequality constraints must be larger than 0.");
 
-        // Reset the residuals
-        y_.setZero();
+        /* Warm-start from the multipliers of the last solve, which are stored in the
+           constraints themselves. The bounded constraints that were separated are
+           skipped, assuming that they will remain so. This assumption is checked
+           once the other constraints have converged. */
+        for (ConstraintData & constraintData : constraintsData_)
+        {
+            constraintData.isSkipped = !constraintData.isInactive && constraintData.nBlocks > 0
+                && constraintData.mode == contactMode_t::SEPARATED;
+            if (constraintData.isSkipped)
+            {
+                x.segment(constraintData.startIdx, constraintData.dim).setZero();
+            }
+        }
 
         // Perform multiple PGS loop until convergence or max iter reached
-        for (uint32_t iter = 0; iter < maxIter_; ++iter)
+        for (iterNum_ = 1; iterNum_ <= maxIter_; ++iterNum_)
         {
-            // Backup previous residuals
-            yPrev_ = y_;
-
             // Do a single iteration
-            ProjectedGaussSeidelIter(A, b, x);
+            float64_t dxMax, xMax;
+            std::tie(dxMax, xMax) = ProjectedGaussSeidelIter(A, b, x);
 
             // Check if terminate conditions are satisfied
-            float64_t const tol = tolAbs_ + tolRel_ * y_.cwiseAbs().maxCoeff();
-            if (((y_ - yPrev_).array().abs() < tol).all())
+            if (dxMax > tolAbs_ + tolRel_ * xMax)
+            {
+                continue;
+            }
+
+            /* Make sure that the skipped constraints would remain separated, ie the
+               first update of their normal multiplier would be clamped to zero.
+               Otherwise, stop skipping them and keep iterating. */
+            bool_t isActivated = false;
+            for (ConstraintData & constraintData : constraintsData_)
+            {
+                if (constraintData.isSkipped)
+                {
+                    Eigen::Index const i0 = constraintData.startIdx + constraintData.blocks[0].fIdx[0];
+                    if (b[i0] - A.col(i0).dot(x) > 0.0)
+                    {
+                        constraintData.isSkipped = false;
+                        isActivated = true;
+                    }
+                }
+            }
+            if (!isActivated)
             {
                 return true;
             }
         }
 
         // Impossible to converge
+        iterNum_ = maxIter_;
         return false;
     }
 
-    bool_t PGSSolver::SolveBoxedForwardDynamics(float64_t const & inv_damping,
-                                                bool_t const & ignoreBounds)
+    void AbstractBoxedConstraintSolver::updateContactModes(vectorN_t::SegmentReturnType const & x)
     {
-        // Update constraints start indices, jacobian, drift and multipliers
+        for (ConstraintData & constraintData : constraintsData_)
+        {
+            // Inactive constraints are separated by definition
+            if (constraintData.isInactive)
+            {
+                constraintData.mode = contactMode_t::SEPARATED;
+                continue;
+            }
+
+            // Unbounded constraints are always sticking
+            if (constraintData.nBlocks == 0)
+            {
+                constraintData.mode = contactMode_t::STICKING;
+                continue;
+            }
+
+            // The constraint is separated if its normal multiplier is zero
+            auto xConst = x.segment(constraintData.startIdx, constraintData.dim);
+            float64_t const & normal = xConst[constraintData.blocks[0].fIdx[0]];
+            if (normal < EPS)
+            {
+                constraintData.mode = contactMode_t::SEPARATED;
+                continue;
+            }
+
+            // The constraint is sliding if the tangential force lies on the friction cone
+            constraintData.mode = contactMode_t::STICKING;
+            if (constraintData.nBlocks == 3)
+            {
+                ConstraintBlock const & block = constraintData.blocks[2];
+                if (!block.isZero)
+                {
+                    float64_t const tangential = std::sqrt(
+                        std::pow(xConst[block.fIdx[0]], 2) + std::pow(xConst[block.fIdx[1]], 2));
+                    if (tangential > (1.0 - EPS) * block.hi * normal)
+                    {
+                        constraintData.mode = contactMode_t::SLIDING;
+                    }
+                }
+                else
+                {
+                    constraintData.mode = contactMode_t::SLIDING;
+                }
+            }
+        }
+    }
+
+    bool_t AbstractBoxedConstraintSolver::SolveBoxedForwardDynamics(float64_t const & inv_damping,
+                                                                    bool_t const & ignoreBounds)
+    {
+        /* Update constraints start indices, jacobian, drift and multipliers.
+           Only the columns of the jacobian within its support are copied. */
         Eigen::Index constraintRows = 0U;
+        jacobianBlocks_.clear();
         for (auto & constraintData : constraintsData_)
         {
             AbstractConstraintBase * constraint = constraintData.constraint;
@@ -269,10 +433,24 @@ namespace jiminy
                 continue;
             }
             Eigen::Index const constraintDim = constraintData.dim;
-            J_.middleRows(constraintRows, constraintDim) = constraint->getJacobian();
+            matrixN_t const & jacobian = constraint->getJacobian();
+            auto const & jacobianSupport = constraint->getJacobianSupport();
+            if (jacobianSupport.empty())
+            {
+                J_.middleRows(constraintRows, constraintDim) = jacobian;
+            }
+            else
+            {
+                for (auto const & slice : jacobianSupport)
+                {
+                    J_.block(constraintRows, slice.first, constraintDim, slice.second) =
+                        jacobian.middleCols(slice.first, slice.second);
+                }
+            }
             gamma_.segment(constraintRows, constraintDim) = constraint->getDrift();
             lambda_.segment(constraintRows, constraintDim) = constraint->lambda_;
             constraintData.startIdx = constraintRows;
+            jacobianBlocks_.push_back({constraintRows, constraintDim, &constraintData.colsIdx});
             constraintRows += constraintDim;
         };
 
@@ -293,7 +471,7 @@ namespace jiminy
            Abort computation if the inertia matrix is not positive definite,
            which is never supposed to happen in theory but in practice it is
            not sure because of compounding of errors. */
-        hresult_t returnCode = pinocchio_overload::computeJMinvJt(*model_, *data_, J);
+        hresult_t returnCode = pinocchio_overload::computeJMinvJt(*model_, *data_, J, jacobianBlocks_);
         if (returnCode != hresult_t::SUCCESS)
         {
             data_->ddq.setConstant(qNAN);
@@ -315,10 +493,16 @@ namespace jiminy
         data_->torque_residual = data_->u - data_->nle;
         pinocchio::cholesky::solve(*model_, *data_, data_->torque_residual);
 
-        /* Compute b.
-           - TODO: Leverage sparsity of J to avoid dense matrix multiplication */
+        // Compute b, only over the support of each block of the jacobian
         b = - gamma;
-        b.noalias() -= J * data_->torque_residual;
+        for (pinocchio_overload::JacobianBlock const & block : jacobianBlocks_)
+        {
+            auto bBlock = b.segment(block.startRow, block.dim);
+            for (Eigen::Index const & k : *block.colsIdx)
+            {
+                bBlock -= J.col(k).segment(block.startRow, block.dim) * data_->torque_residual[k];
+            }
+        }
 
         // Compute resulting forces solving forward dynamics
         bool_t isSuccess = false;
@@ -335,6 +519,7 @@ namespace jiminy
             lambda = pinocchio_overload::solveJMinvJtv(*data_, b, true);
 
             // Always successful
+            iterNum_ = 0U;
             isSuccess = true;
         }
         else
@@ -342,10 +527,13 @@ namespace jiminy
             // Full matrix is needed to enable vectorization
             A.triangularView<Eigen::StrictlyUpper>() = A.transpose();
 
-            // Run standard PGS algorithm
-            isSuccess = ProjectedGaussSeidelSolver(A, b, lambda);
+            // Run the solver-specific algorithm
+            isSuccess = SolveBoxedLCP(A, b, lambda);
         }
 
+        // Update the mode of the constraints, used to warm-start the next solve
+        updateContactModes(lambda);
+
         // Update lagrangian multipliers associated with the constraint
         constraintRows = 0U;
         for (auto const & constraintData : constraintsData_)
@@ -361,10 +549,287 @@ namespace jiminy
         };
 
         // Compute resulting acceleration, no matter if computing forces was successful
-        data_->ddq.noalias() = J.transpose() * lambda;
+        data_->ddq.setZero();
+        for (pinocchio_overload::JacobianBlock const & block : jacobianBlocks_)
+        {
+            auto lambdaBlock = lambda.segment(block.startRow, block.dim);
+            for (Eigen::Index const & k : *block.colsIdx)
+            {
+                data_->ddq[k] += J.col(k).segment(block.startRow, block.dim).dot(lambdaBlock);
+            }
+        }
         pinocchio::cholesky::solve(*model_, *data_, data_->ddq);
         data_->ddq += data_->torque_residual;
 
         return isSuccess;
     }
+
+    BlockPGSSolver::BlockPGSSolver(pinocchio::Model const * model,
+                                   pinocchio::Data * data,
+                                   constraintsHolder_t * constraintsHolder,
+                                   float64_t const & friction,
+                                   float64_t const & torsion,
+                                   float64_t const & tolAbs,
+                                   float64_t const & tolRel,
+                                   uint32_t const & maxIter) :
+    PGSSolver(model, data, constraintsHolder, friction, torsion, tolAbs, tolRel, maxIter),
+    contactBlocksInv_(constraintsData_.size(), matrix3_t::Zero())
+    {
+        // Empty on purpose
+    }
+
+    void BlockPGSSolver::processState(StateArchive & archive)
+    {
+        PGSSolver::processState(archive);
+        archive.process(contactBlocksInv_);
+    }
+
+    bool_t BlockPGSSolver::SolveBoxedLCP(matrixN_t const & A,
+                                         vectorN_t::SegmentReturnType const & b,
+                                         vectorN_t::SegmentReturnType & x)
+    {
+        /* Invert the diagonal block of A associated with the normal and tangential
+           multipliers of every active contact. It is done once per solve since A
+           does not change during the iterations. */
+        for (std::size_t i = 0; i < constraintsData_.size(); ++i)
+        {
+            ConstraintData const & constraintData = constraintsData_[i];
+            if (!constraintData.isInactive && constraintData.nBlocks == 3)
+            {
+                Eigen::Index const & o = constraintData.startIdx;
+                contactBlocksInv_[i] = A.block<3, 3>(o, o).inverse();
+            }
+        }
+
+        // Run standard PGS algorithm, relying on block updates
+        return PGSSolver::SolveBoxedLCP(A, b, x);
+    }
+
+    std::pair<float64_t, float64_t> BlockPGSSolver::ProjectedGaussSeidelIter(matrixN_t const & A,
+                                                                             vectorN_t::SegmentReturnType const & b,
+                                                                             vectorN_t::SegmentReturnType & x)
+    {
+        // Keep track of the largest variation and value of the multipliers
+        float64_t dxMax = 0.0;
+        float64_t xMax = 0.0;
+        auto updateMax = [&dxMax, &xMax](float64_t const & xNew, float64_t const & xOld)
+        {
+            dxMax = std::max(dxMax, std::abs(xNew - xOld));
+            xMax = std::max(xMax, std::abs(xNew));
+        };
+
+        for (std::size_t i = 0; i < constraintsData_.size(); ++i)
+        {
+            // Bypass inactive or skipped constraints
+            ConstraintData const & constraintData = constraintsData_[i];
+            if (constraintData.isInactive || constraintData.isSkipped)
+            {
+                continue;
+            }
+            Eigen::Index const & o = constraintData.startIdx;
+
+            // Unbounded constraints are updated one coefficient at a time
+            if (constraintData.nBlocks == 0)
+            {
+                for (Eigen::Index k = o; k < o + constraintData.dim; ++k)
+                {
+                    float64_t const xPrev = x[k];
+                    x[k] += (b[k] - A.col(k).dot(x)) / A(k, k);
+                    updateMax(x[k], xPrev);
+                }
+                continue;
+            }
+
+            // Joint bounds only involve a single bounded coefficient
+            if (constraintData.nBlocks == 1)
+            {
+                ConstraintBlock const & block = constraintData.blocks[0];
+                Eigen::Index const k = o + block.fIdx[0];
+                float64_t const xPrev = x[k];
+                x[k] += (b[k] - A.col(k).dot(x)) / A(k, k);
+                x[k] = std::clamp(x[k], block.lo, block.hi);
+                updateMax(x[k], xPrev);
+                continue;
+            }
+
+            /* Update the normal and tangential multipliers at once, which are
+               assumed to be the first three coefficients of contact constraints. */
+            ConstraintBlock const & frictionBlock = constraintData.blocks[2];
+            auto xBlock = x.segment<3>(o);
+            vector3_t const xBlockPrev = xBlock;
+            if (frictionBlock.isZero)
+            {
+                // No friction, so only the normal multiplier must be updated
+                xBlock.head<2>().setZero();
+                xBlock[2] += (b[o + 2] - A.col(o + 2).dot(x)) / A(o + 2, o + 2);
+                xBlock[2] = std::max(xBlock[2], 0.0);
+            }
+            else
+            {
+                // Solve the 3x3 block exactly, the other multipliers being fixed
+                vector3_t const residual = b.segment<3>(o) - A.middleCols<3>(o).transpose() * x;
+                xBlock.noalias() += contactBlocksInv_[i] * residual;
+
+                // Project the multipliers on the friction cone
+                xBlock[2] = std::max(xBlock[2], 0.0);
+                float64_t const thr = frictionBlock.hi * xBlock[2];
+                float64_t const tangentialNorm = xBlock.head<2>().norm();
+                if (tangentialNorm > thr)
+                {
+                    xBlock.head<2>() *= thr / tangentialNorm;
+                }
+            }
+            for (Eigen::Index j = 0; j < 3; ++j)
+            {
+                updateMax(xBlock[j], xBlockPrev[j]);
+            }
+
+            // Update the torsional multiplier
+            ConstraintBlock const & torsionBlock = constraintData.blocks[1];
+            Eigen::Index const k = o + torsionBlock.fIdx[0];
+            float64_t const xPrev = x[k];
+            if (torsionBlock.isZero)
+            {
+                x[k] = 0.0;
+            }
+            else
+            {
+                x[k] += (b[k] - A.col(k).dot(x)) / A(k, k);
+                float64_t const thr = torsionBlock.hi * xBlock[2];
+                x[k] = std::clamp(x[k], -thr, thr);
+            }
+            updateMax(x[k], xPrev);
+        }
+
+        return {dxMax, xMax};
+    }
+
+    ADMMSolver::ADMMSolver(pinocchio::Model const * model,
+                           pinocchio::Data * data,
+                           constraintsHolder_t * constraintsHolder,
+                           float64_t const & friction,
+                           float64_t const & torsion,
+                           float64_t const & tolAbs,
+                           float64_t const & tolRel,
+                           uint32_t const & maxIter) :
+    AbstractBoxedConstraintSolver(
+        model, data, constraintsHolder, friction, torsion, tolAbs, tolRel, maxIter),
+    H_(),
+    llt_(),
+    z_(b_.size()),
+    zPrev_(b_.size()),
+    u_(b_.size())
+    {
+        // Empty on purpose
+    }
+
+    void ADMMSolver::processState(StateArchive & archive)
+    {
+        AbstractBoxedConstraintSolver::processState(archive);
+        archive.process(z_);
+        archive.process(zPrev_);
+        archive.process(u_);
+    }
+
+    void ADMMSolver::project(vectorN_t::SegmentReturnType & z)
+    {
+        for (ConstraintData const & constraintData : constraintsData_)
+        {
+            // Bypass inactive constraints
+            if (constraintData.isInactive)
+            {
+                continue;
+            }
+
+            // Project the blocks in order, since the normal multiplier is involved in the others
+            auto zConst = z.segment(constraintData.startIdx, constraintData.dim);
+            for (std::uint_fast8_t i = 0; i < constraintData.nBlocks; ++i)
+            {
+                ConstraintBlock const & block = constraintData.blocks[i];
+                Eigen::Index const * fIdx = block.fIdx;
+                float64_t & e = zConst[fIdx[0]];
+                if (block.isZero)
+                {
+                    e = 0.0;
+                    if (block.fSize == 3)
+                    {
+                        zConst[fIdx[1]] = 0.0;
+                    }
+                }
+                else if (block.fSize == 1)
+                {
+                    e = std::clamp(e, block.lo, block.hi);
+                }
+                else if (block.fSize == 2)
+                {
+                    float64_t const thr = block.hi * zConst[fIdx[1]];
+                    e = std::clamp(e, -thr, thr);
+                }
+                else
+                {
+                    float64_t const thr = block.hi * zConst[fIdx[2]];
+                    float64_t const norm = std::sqrt(e * e + zConst[fIdx[1]] * zConst[fIdx[1]]);
+                    if (norm > thr)
+                    {
+                        float64_t const scale = thr / norm;
+                        e *= scale;
+                        zConst[fIdx[1]] *= scale;
+                    }
+                }
+            }
+        }
+    }
+
+    bool_t ADMMSolver::SolveBoxedLCP(matrixN_t const & A,
+                                     vectorN_t::SegmentReturnType const & b,
+                                     vectorN_t::SegmentReturnType & x)
+    {
+        // Define some proxies for convenience
+        Eigen::Index const n = b.size();
+        auto z = z_.head(n);
+        auto zPrev = zPrev_.head(n);
+        auto u = u_.head(n);
+
+        /* Factorize the shifted operational-space inertia matrix once and for all.
+           The penalty parameter is scaled wrt. its average diagonal value. */
+        float64_t const rho = A.diagonal().mean();
+        H_ = A;
+        H_.diagonal().array() += rho;
+        llt_.compute(H_);
+
+        // Warm-start from the multipliers of the last solve
+        z = x;
+        project(z);
+        u.setZero();
+
+        for (iterNum_ = 1; iterNum_ <= maxIter_; ++iterNum_)
+        {
+            // Backup previous projected multipliers
+            zPrev = z;
+
+            // Minimize the unconstrained augmented lagrangian wrt. the multipliers
+            x = b + rho * (z - u);
+            llt_.solveInPlace(x);
+
+            // Project on the bounds and friction cones
+            z = x + u;
+            project(z);
+
+            // Update the scaled dual variables
+            u += x - z;
+
+            // Check if both primal and dual residuals are small enough
+            float64_t const tol = tolAbs_ + tolRel_ * z.cwiseAbs().maxCoeff();
+            if ((x - z).cwiseAbs().maxCoeff() < tol && (z - zPrev).cwiseAbs().maxCoeff() < tol)
+            {
+                x = z;
+                return true;
+            }
+        }
+
+        // Impossible to converge. Return the projected multipliers, which are admissible.
+        x = z;
+        iterNum_ = maxIter_;
+        return false;
+    }
 }
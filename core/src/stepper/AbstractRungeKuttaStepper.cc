@@ -18,8 +18,10 @@ namespace jiminy
     ki_(cNodes.size(), stateDerivative_t(robots)),
     stateIncrement_(robots),
     stateBuffer_(robots),
-    candidateSolution_(robots)
-
+    candidateSolution_(robots),
+    stepInitialState_(robots),
+    stepInitialTime_(0.0),
+    stepDuration_(0.0)
     {
         assert(A_.rows() == A_.cols());
         assert(c_.size() == A_.rows());
@@ -31,6 +33,9 @@ namespace jiminy
                                                   float64_t         const & t,
                                                   float64_t               & dt)
     {
+        // Backup the step size, since it is updated in place by the step adjustment
+        float64_t const dtStep = dt;
+
         // First ki is simply the provided stateDerivative
         ki_[0] = stateDerivative;
 
@@ -42,7 +47,7 @@ namespace jiminy
                 stateIncrement_.sumInPlace(ki_[j], dt * A_(i, j));  // Equivalent to `stateIncrement_ += dt * A_(i, j) * ki_[j]` but more efficient because it avoid temporaries
             }
             state.sum(stateIncrement_, stateBuffer_);
-            ki_[i] = f(t + c_[i] * dt, stateBuffer_);
+            f(t + c_[i] * dt, stateBuffer_, ki_[i]);
         }
 
         /* Now we have all the ki's: compute the solution.
@@ -61,6 +66,14 @@ namespace jiminy
         // Update state and compute derivative if success
         if (hasSucceeded)
         {
+            // Keep track of the starting point of the step, from which the dense output is computed
+            if (hasDenseOutput())
+            {
+                stepInitialState_ = state;
+                stepInitialTime_ = t;
+                stepDuration_ = dtStep;
+            }
+
             state = candidateSolution_;
             if (isFSAL_)
             {
@@ -68,7 +81,7 @@ namespace jiminy
             }
             else
             {
-                stateDerivative = f(t, state);
+                f(t, state, stateDerivative);
             }
         }
 
@@ -6,34 +6,26 @@ namespace jiminy
     AbstractStepper::AbstractStepper(systemDynamics const & f,
                                      std::vector<Robot const *> const & robots):
     f_(f),
-    robots_(robots),
-    state_(robots),
-    stateDerivative_(robots),
-    fOutput_(robots)
+    robots_(robots)
     {
         // Empty on purpose
     }
 
-    bool_t AbstractStepper::tryStep(std::vector<vectorN_t> & qSplit,
-                                    std::vector<vectorN_t> & vSplit,
-                                    std::vector<vectorN_t> & aSplit,
-                                    float64_t              & t,
-                                    float64_t              & dt)
+    bool_t AbstractStepper::tryStep(state_t           & state,
+                                    stateDerivative_t & stateDerivative,
+                                    float64_t         & t,
+                                    float64_t         & dt)
     {
-        // Update buffers
-        float64_t t_next = t + dt;
-        state_.q = qSplit;
-        state_.v = vSplit;
-        stateDerivative_.v = vSplit;
-        stateDerivative_.a = aSplit;
+        // Backup the final time, since dt is updated by the stepper
+        float64_t const tNext = t + dt;
 
         // Try doing a single step
-        bool_t result = tryStepImpl(state_, stateDerivative_, t, dt);
+        bool_t result = tryStepImpl(state, stateDerivative, t, dt);
 
         // Make sure everything went fine
         if (result)
         {
-            for (vectorN_t const & a : stateDerivative_.a)
+            for (vectorN_t const & a : stateDerivative.a)
             {
                 if ((a.array() != a.array()).any())
                 {
@@ -43,22 +35,31 @@ namespace jiminy
             }
         }
 
-        // Update output if successful
+        // Update the time if successful
         if (result)
         {
-            t = t_next;
-            qSplit = state_.q;
-            vSplit = state_.v;
-            aSplit = stateDerivative_.a;
+            t = tNext;
         }
         return result;
     }
 
-    stateDerivative_t const & AbstractStepper::f(float64_t const & t,
-                                                 state_t   const & state)
+    bool_t AbstractStepper::hasDenseOutput(void) const
     {
-        f_(t, state.q, state.v, fOutput_.a);
-        fOutput_.v = state.v;
-        return fOutput_;
+        return false;
+    }
+
+    bool_t AbstractStepper::computeDenseOutput(float64_t         const & /* t */,
+                                               state_t                 & /* state */,
+                                               stateDerivative_t       & /* stateDerivative */)
+    {
+        return false;
+    }
+
+    void AbstractStepper::f(float64_t         const & t,
+                            state_t           const & state,
+                            stateDerivative_t       & stateDerivative)
+    {
+        f_(t, state.q, state.v, stateDerivative.a);
+        stateDerivative.v = state.v;
     }
 }
@@ -19,7 +19,7 @@ namespace jiminy
         state.sumInPlace(stateDerivative, dt);
 
         // Compute the next state derivative
-        stateDerivative = f(t, state);
+        f(t, state, stateDerivative);
 
         /* By default INF is returned in case of fixed time step, so that the
            engine will always try to perform the latest timestep possible,
@@ -0,0 +1,75 @@
+
+#include "jiminy/core/stepper/EulerLinearImplicitStepper.h"
+
+namespace jiminy
+{
+    EulerLinearImplicitStepper::EulerLinearImplicitStepper(systemDynamics const & f,
+                                                           systemLinearization const & g,
+                                                           std::vector<Robot const *> const & robots):
+    AbstractStepper(f, robots),
+    g_(g),
+    massSplit_(),
+    stiffnessSplit_(),
+    dampingSplit_(),
+    ldlt_(),
+    stateIncrement_(robots)
+    {
+        // Allocate the buffers once and for all
+        massSplit_.reserve(robots.size());
+        stiffnessSplit_.reserve(robots.size());
+        dampingSplit_.reserve(robots.size());
+        ldlt_.reserve(robots.size());
+        for (Robot const * const & robot : robots)
+        {
+            massSplit_.emplace_back(matrixN_t::Zero(robot->nv(), robot->nv()));
+            stiffnessSplit_.emplace_back(matrixN_t::Zero(robot->nv(), robot->nv()));
+            dampingSplit_.emplace_back(matrixN_t::Zero(robot->nv(), robot->nv()));
+            ldlt_.emplace_back(robot->nv());
+        }
+    }
+
+    bool_t EulerLinearImplicitStepper::tryStepImpl(state_t                 & state,
+                                                   stateDerivative_t       & stateDerivative,
+                                                   float64_t         const & t,
+                                                   float64_t               & dt)
+    {
+        // Linearize the stiff efforts around the current state
+        g_(t, state.q, state.v, massSplit_, stiffnessSplit_, dampingSplit_);
+
+        for (std::size_t i = 0; i < massSplit_.size(); ++i)
+        {
+            matrixN_t & M = massSplit_[i];
+            matrixN_t const & K = stiffnessSplit_[i];
+            matrixN_t const & D = dampingSplit_[i];
+            vectorN_t const & v = stateDerivative.v[i];
+            vectorN_t const & a = stateDerivative.a[i];
+            vectorN_t & dv = stateIncrement_.a[i];
+
+            // Compute the right hand side dt (M a - dt K v)
+            dv.noalias() = M.selfadjointView<Eigen::Upper>() * a;
+            dv.noalias() -= dt * (K * v);
+            dv *= dt;
+
+            // Solve (M + dt D + dt^2 K) dv = rhs, only the upper triangular part being used
+            M.noalias() += dt * D;
+            M.noalias() += (dt * dt) * K;
+            ldlt_[i].compute(M);
+            ldlt_[i].solveInPlace(dv);
+
+            // The configuration is integrated using the velocity at the end of the step
+            stateIncrement_.v[i] = dt * v + dt * dv;
+        }
+        state.sumInPlace(stateIncrement_);
+
+        // Compute the next state derivative
+        f(t + dt, state, stateDerivative);
+
+        /* By default INF is returned in case of fixed time step, so that the
+           engine will always try to perform the latest timestep possible,
+           or stop to the next breakpoint otherwise. */
+        dt = INF;
+
+        // Scheme never considers failure.
+        return true;
+    }
+}
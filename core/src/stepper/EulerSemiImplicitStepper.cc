@@ -0,0 +1,39 @@
+
+#include "jiminy/core/stepper/EulerSemiImplicitStepper.h"
+
+namespace jiminy
+{
+    EulerSemiImplicitStepper::EulerSemiImplicitStepper(systemDynamics const & f,
+                                                       std::vector<Robot const *> const & robots):
+    AbstractStepper(f, robots),
+    stateIncrement_(robots)
+    {
+        // Empty on purpose
+    }
+
+    bool_t EulerSemiImplicitStepper::tryStepImpl(state_t                 & state,
+                                                 stateDerivative_t       & stateDerivative,
+                                                 float64_t         const & t,
+                                                 float64_t               & dt)
+    {
+        /* Semi-implicit Euler: v(t + dt) = v(t) + dt a(t), q(t + dt) = q(t) + dt v(t + dt).
+           The configuration is integrated using the velocity at the end of the step. */
+        for (std::size_t i = 0; i < stateIncrement_.a.size(); ++i)
+        {
+            stateIncrement_.a[i] = dt * stateDerivative.a[i];
+            stateIncrement_.v[i] = dt * stateDerivative.v[i] + dt * stateIncrement_.a[i];
+        }
+        state.sumInPlace(stateIncrement_);
+
+        // Compute the next state derivative
+        f(t + dt, state, stateDerivative);
+
+        /* By default INF is returned in case of fixed time step, so that the
+           engine will always try to perform the latest timestep possible,
+           or stop to the next breakpoint otherwise. */
+        dt = INF;
+
+        // Scheme never considers failure.
+        return true;
+    }
+}
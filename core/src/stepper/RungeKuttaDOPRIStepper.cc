@@ -15,6 +15,52 @@ namespace jiminy
         // Empty on purpose
     }
 
+    bool_t RungeKuttaDOPRIStepper::hasDenseOutput(void) const
+    {
+        return true;
+    }
+
+    bool_t RungeKuttaDOPRIStepper::computeDenseOutput(float64_t         const & t,
+                                                      state_t                 & state,
+                                                      stateDerivative_t       & stateDerivative)
+    {
+        // Make sure the requested time lies within the last successful step
+        if (stepDuration_ < EPS)
+        {
+            return false;
+        }
+        float64_t const theta = (t - stepInitialTime_) / stepDuration_;
+        if (theta < - EPS || 1.0 + EPS < theta)
+        {
+            return false;
+        }
+
+        // Compute the weights of every stage and their derivative wrt theta
+        vector4_t thetaPowers, thetaPowersDiff;
+        thetaPowers << theta, theta * theta, theta * theta * theta, theta * theta * theta * theta;
+        thetaPowersDiff << 1.0, 2.0 * theta, 3.0 * theta * theta, 4.0 * theta * theta * theta;
+        Eigen::Matrix<float64_t, 7, 1> const weights = DOPRI::P * thetaPowers;
+        Eigen::Matrix<float64_t, 7, 1> const weightsDiff = DOPRI::P * thetaPowersDiff;
+
+        // Interpolate the state, summing the velocities before integrating them on the Lie group
+        stateIncrement_.setZero();
+        for (std::size_t i = 0; i < ki_.size(); ++i)
+        {
+            stateIncrement_.sumInPlace(ki_[i], stepDuration_ * weights[i]);
+        }
+        stepInitialState_.sum(stateIncrement_, state);
+
+        // Interpolate the acceleration, namely the time derivative of the interpolated velocity
+        stateDerivative.setZero();
+        for (std::size_t i = 0; i < ki_.size(); ++i)
+        {
+            stateDerivative.sumInPlace(ki_[i], weightsDiff[i]);
+        }
+        stateDerivative.v = state.v;
+
+        return true;
+    }
+
     bool_t RungeKuttaDOPRIStepper::adjustStep(state_t   const & initialState,
                                               state_t   const & solution,
                                               float64_t       & dt)
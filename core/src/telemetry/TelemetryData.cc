@@ -4,6 +4,8 @@
 ///
 //////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include "jiminy/core/Constants.h"
 
 #include "jiminy/core/telemetry/TelemetryData.h"
@@ -13,9 +15,20 @@ namespace jiminy
 {
     TelemetryData::TelemetryData() :
     constantsRegistry_(),
+    integersNames_(),
+    floatsNames_(),
     integersRegistry_(),
     floatsRegistry_(),
-    isRegisteringAvailable_(false)
+    dataArena_(),
+    integersData_(nullptr),
+    floatsData_(nullptr),
+    isRegisteringAvailable_(false),
+    isRecycling_(false),
+    isHeaderOutdated_(false),
+    integersRecycled_(),
+    floatsRecycled_(),
+    constantsRecycled_(),
+    generation_(0U)
     {
         reset();
     }
@@ -23,16 +36,56 @@ namespace jiminy
     void TelemetryData::reset()
     {
         constantsRegistry_.clear();
+        integersNames_.clear();
+        floatsNames_.clear();
         integersRegistry_.clear();
         floatsRegistry_.clear();
+        dataArena_.clear();
+        integersData_ = nullptr;
+        floatsData_ = nullptr;
         isRegisteringAvailable_ = true;
+        isRecycling_ = false;
+        isHeaderOutdated_ = false;
+        integersRecycled_.clear();
+        floatsRecycled_.clear();
+        constantsRecycled_.clear();
+        ++generation_;
+    }
+
+    bool_t TelemetryData::rewind(void)
+    {
+        // Nothing to recycle if the previous simulation has not even been started
+        if (isRegisteringAvailable_)
+        {
+            return false;
+        }
+
+        isRecycling_ = true;
+        isHeaderOutdated_ = false;
+        integersRecycled_.assign(integersNames_.size(), false);
+        floatsRecycled_.assign(floatsNames_.size(), false);
+        constantsRecycled_.assign(constantsRegistry_.size(), false);
+        return true;
+    }
+
+    bool_t TelemetryData::getIsRecycled(void) const
+    {
+        auto isTrue = [](bool_t const & flag) { return flag; };
+        return isRecycling_
+            && std::all_of(integersRecycled_.begin(), integersRecycled_.end(), isTrue)
+            && std::all_of(floatsRecycled_.begin(), floatsRecycled_.end(), isTrue);
+    }
+
+    uint64_t const & TelemetryData::getGeneration(void) const
+    {
+        return generation_;
     }
 
     hresult_t TelemetryData::registerConstant(std::string const & variableNameIn,
                                               std::string const & constantValueIn)
     {
-        // Check if registration is possible
-        if (!isRegisteringAvailable_)
+        // Check if registration is possible. The constants can always be updated while recycling.
+        if (!isRegisteringAvailable_ && !isRecycling_)
         {
             PRINT_ERROR("Registration is locked.");
             return hresult_t::ERROR_GENERIC;
@@ -48,19 +101,61 @@ namespace jiminy
             });
         if (variableIt != constantsRegistry_.end())
         {
-            PRINT_ERROR("Entry already exists.");
-            return hresult_t::ERROR_GENERIC;
+            /* While recycling, the constant of the previous simulation is updated,
+               but it must still be registered only once per simulation. */
+            std::size_t const constantIdx = static_cast<std::size_t>(
+                std::distance(constantsRegistry_.begin(), variableIt));
+            if (!isRecycling_ || constantsRecycled_[constantIdx])
+            {
+                PRINT_ERROR("Entry already exists.");
+                return hresult_t::ERROR_GENERIC;
+            }
+            constantsRecycled_[constantIdx] = true;
+            if (variableIt->second != constantValueIn)
+            {
+                variableIt->second = constantValueIn;
+                isHeaderOutdated_ = true;
+            }
+            return hresult_t::SUCCESS;
         }
 
         // Register new constant
         constantsRegistry_.emplace_back(variableNameIn, constantValueIn);
+        if (isRecycling_)
+        {
+            constantsRecycled_.push_back(true);
+            isHeaderOutdated_ = true;
+        }
         return hresult_t::SUCCESS;
     }
 
     void TelemetryData::formatHeader(std::vector<char_t> & header)
     {
-        // Lock registering
-        isRegisteringAvailable_ = false;
+        // Lock registering and gather the variables in a single buffer
+        if (isRegisteringAvailable_)
+        {
+            isRegisteringAvailable_ = false;
+            allocateDataArena();
+        }
+
+        /* Drop the constants of the previous simulation that have not been registered
+           again, then keep the header as is if nothing has changed. */
+        if (isRecycling_)
+        {
+            isRecycling_ = false;
+            for (std::size_t i = constantsRecycled_.size(); i > 0; --i)
+            {
+                if (!constantsRecycled_[i - 1])
+                {
+                    constantsRegistry_.erase(constantsRegistry_.begin() + static_cast<std::ptrdiff_t>(i - 1));
+                    isHeaderOutdated_ = true;
+                }
+            }
+            if (!isHeaderOutdated_ && !header.empty())
+            {
+                return;
+            }
+        }
 
         // Make sure provided header is empty
         header.clear();
@@ -104,16 +199,16 @@ namespace jiminy
         header.push_back('\0');
 
         // Record integers
-        for (std::pair<std::string, int64_t> const & keyValue : integersRegistry_)
+        for (std::string const & name : integersNames_)
         {
-            header.insert(header.end(), keyValue.first.begin(), keyValue.first.end());
+            header.insert(header.end(), name.begin(), name.end());
             header.push_back('\0');
         }
 
         // Record floats
-        for (std::pair<std::string, float64_t> const & keyValue : floatsRegistry_)
+        for (std::string const & name : floatsNames_)
         {
-            header.insert(header.end(), keyValue.first.begin(), keyValue.first.end());
+            header.insert(header.end(), name.begin(), name.end());
             header.push_back('\0');
         }
 
@@ -122,15 +217,56 @@ namespace jiminy
         header.push_back('\0');
     }
 
+    void TelemetryData::allocateDataArena(void)
+    {
+        // The line of data starts with the time, followed by the integers then the floats
+        std::size_t const dataSize = sizeof(int64_t) * (1U + integersRegistry_.size())
+                                   + sizeof(float64_t) * floatsRegistry_.size();
+        std::size_t const linesNum = (dataSize + sizeof(cacheLine_t) - 1U) / sizeof(cacheLine_t);
+        dataArena_.assign(linesNum, cacheLine_t{});
+        char_t * const timePtr = dataArena_[0].data;
+
+        // Move the variables in the arena, integers first
+        integersData_ = reinterpret_cast<int64_t *>(timePtr + sizeof(int64_t));
+        std::copy(integersRegistry_.begin(), integersRegistry_.end(), integersData_);
+        floatsData_ = reinterpret_cast<float64_t *>(integersData_ + integersRegistry_.size());
+        std::copy(floatsRegistry_.begin(), floatsRegistry_.end(), floatsData_);
+
+        // Release the memory used while registering
+        integersRegistry_ = {};
+        floatsRegistry_ = {};
+    }
+
+    char_t * TelemetryData::getDataSnapshot(void)
+    {
+        if (isRegisteringAvailable_)
+        {
+            return nullptr;
+        }
+        return dataArena_[0].data;
+    }
+
+    template<>
+    int64_t * const * TelemetryData::getRegistry<int64_t>(void)
+    {
+        return &integersData_;
+    }
+
+    template<>
+    float64_t * const * TelemetryData::getRegistry<float64_t>(void)
+    {
+        return &floatsData_;
+    }
+
     template<>
-    std::deque<std::pair<std::string, int64_t> > * TelemetryData::getRegistry<int64_t>(void)
+    std::vector<std::string> * TelemetryData::getRegistryNames<int64_t>(void)
     {
-        return &integersRegistry_;
+        return &integersNames_;
     }
 
     template<>
-    std::deque<std::pair<std::string, float64_t> > * TelemetryData::getRegistry<float64_t>(void)
+    std::vector<std::string> * TelemetryData::getRegistryNames<float64_t>(void)
     {
-        return &floatsRegistry_;
+        return &floatsNames_;
     }
 }// end of namespace jiminy
\ No newline at end of file
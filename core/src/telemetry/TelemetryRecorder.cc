@@ -6,9 +6,11 @@
 
 #include <math.h>
 #include <cmath>
+#include <chrono>
+#include <cstring>
 #include <iomanip>
 #include <fstream>
-
+#include <filesystem>
 
 #include "jiminy/core/io/FileDevice.h"
 #include "jiminy/core/telemetry/TelemetryData.h"
@@ -19,16 +21,66 @@
 
 namespace jiminy
 {
-    TelemetryRecorder::~TelemetryRecorder(void)
+    namespace
     {
-        if (!flows_.empty())
+        /// \brief Append the lines of data of a chunk to a log file, prepending the token to every line.
+        hresult_t writeChunk(AbstractIODevice     & device,
+                             uint8_t const        * chunk,
+                             int64_t        const & linesNum,
+                             int64_t        const & lineSize,
+                             std::vector<uint8_t> & buffer)
         {
-            flows_.back().close();
+            std::size_t const tokenSize = START_LINE_TOKEN.size();
+            std::size_t const lineSizeBytes = static_cast<std::size_t>(lineSize);
+            buffer.resize(static_cast<std::size_t>(linesNum) * (tokenSize + lineSizeBytes));
+            uint8_t * bufferPtr = buffer.data();
+            uint8_t const * linePtr = chunk;
+            for (int64_t j = 0; j < linesNum; ++j)
+            {
+                std::memcpy(bufferPtr, START_LINE_TOKEN.data(), tokenSize);
+                std::memcpy(bufferPtr + tokenSize, linePtr, lineSizeBytes);
+                bufferPtr += tokenSize + lineSizeBytes;
+                linePtr += lineSizeBytes;
+            }
+            return device.write(buffer);
         }
     }
 
+    TelemetryRecorder::TelemetryRecorder(void) :
+    header_(),
+    chunks_(),
+    isInitialized_(false),
+    chunkLinesMax_(0),
+    chunkLinesNum_(0),
+    recordedBytesDataLine_(0),
+    headerSize_(0),
+    dataSnapshot_(nullptr),
+    integerSectionSize_(0),
+    floatSectionSize_(0),
+    timeUnitInv_(1.0),
+    chunk_(nullptr),
+    streamingPath_(),
+    streamingFile_(nullptr),
+    streamingChunks_(),
+    streamingChunkIdx_(0U),
+    fullChunks_(),
+    freeChunks_(),
+    writerThread_(),
+    isStreaming_(false),
+    hasStreamingFailed_(false)
+    {
+        // Empty on purpose
+    }
+
+    TelemetryRecorder::~TelemetryRecorder(void)
+    {
+        stopStreaming();
+    }
+
     hresult_t TelemetryRecorder::initialize(TelemetryData       * telemetryData,
-                                            float64_t     const & timeUnit)
+                                            float64_t     const & timeUnit,
+                                            std::string   const & streamingPath,
+                                            uint32_t      const & maxInFlightChunks)
     {
         hresult_t returnCode = hresult_t::SUCCESS;
 
@@ -44,37 +96,93 @@ namespace jiminy
         timeUnitStr << std::scientific << std::setprecision(precision) << timeUnit;
         telemetryData->registerConstant(TIME_UNIT, timeUnitStr.str());
 
-        std::vector<char_t> header;
-        if (returnCode == hresult_t::SUCCESS)
+        if (!streamingPath.empty() && maxInFlightChunks < 2U)
         {
-            // Clear the MemoryDevice buffer
-            flows_.clear();
-
-            // Get telemetry data infos
-            integersRegistry_ = telemetryData->getRegistry<int64_t>();
-            integerSectionSize_ = sizeof(int64_t) * integersRegistry_->size();
-            floatsRegistry_ = telemetryData->getRegistry<float64_t>();
-            floatSectionSize_ = sizeof(float64_t) * floatsRegistry_->size();
-            recordedBytesDataLine_ = integerSectionSize_ + floatSectionSize_
-                                   + static_cast<int64_t>(START_LINE_TOKEN.size() + sizeof(int64_t));  // int64_t for Global.Time
-
-            // Get the header
-            telemetryData->formatHeader(header);
-            headerSize_ = static_cast<int64_t>(header.size());
-
-            // Create a new MemoryDevice and open it
-            returnCode = createNewChunk();
+            PRINT_ERROR("At least 2 chunks must be in flight in streaming mode.");
+            returnCode = hresult_t::ERROR_BAD_INPUT;
         }
 
-        // Write the Header
         if (returnCode == hresult_t::SUCCESS)
         {
-            returnCode = flows_[0].write(header);
+            // Stop streaming the data of the previous simulation if not already done
+            stopStreaming();
+
+            // Get telemetry data infos
+            integerSectionSize_ = sizeof(int64_t) * telemetryData->getRegistryNames<int64_t>()->size();
+            floatSectionSize_ = sizeof(float64_t) * telemetryData->getRegistryNames<float64_t>()->size();
+            recordedBytesDataLine_ = integerSectionSize_ + floatSectionSize_ + sizeof(int64_t);  // int64_t for Global.Time
+            chunkLinesMax_ = std::max(TELEMETRY_MIN_BUFFER_SIZE / recordedBytesDataLine_, int64_t(1));
+
+            // Get the header. The line of data is only available afterward.
+            telemetryData->formatHeader(header_);
+            headerSize_ = static_cast<int64_t>(header_.size());
+            dataSnapshot_ = telemetryData->getDataSnapshot();
+
+            // Open the log file and write the header right away in streaming mode
+            streamingPath_ = streamingPath;
+            if (!streamingPath_.empty())
+            {
+                streamingFile_ = std::make_unique<FileDevice>(streamingPath_);
+                streamingFile_->open(openMode_t::WRITE_ONLY | openMode_t::TRUNCATE);
+                if (!streamingFile_->isOpen())
+                {
+                    PRINT_ERROR("Impossible to create the log file. Check if root folder exists and if you have writing permissions.");
+                    streamingFile_.reset();
+                    returnCode = hresult_t::ERROR_BAD_INPUT;
+                }
+                else
+                {
+                    returnCode = streamingFile_->write(header_);
+                }
+            }
         }
 
         if (returnCode == hresult_t::SUCCESS)
         {
-            recordedBytes_ = headerSize_;
+            if (streamingFile_)
+            {
+                // Clear the recorded data, since they are stored in the log file instead
+                chunks_.clear();
+
+                /* Allocate all the chunks once and for all. All of them but the first one,
+                   which is being filled, are available for recording. */
+                streamingChunks_.resize(maxInFlightChunks);
+                for (std::vector<uint8_t> & chunk : streamingChunks_)
+                {
+                    chunk.resize(static_cast<std::size_t>(chunkLinesMax_ * recordedBytesDataLine_));
+                }
+                fullChunks_.reset(maxInFlightChunks);
+                freeChunks_.reset(maxInFlightChunks);
+                for (std::size_t i = 1; i < streamingChunks_.size(); ++i)
+                {
+                    freeChunks_.tryPush(i);
+                }
+                streamingChunkIdx_ = 0U;
+                chunk_ = streamingChunks_[0].data();
+                chunkLinesNum_ = 0;
+
+                // Start the writer thread
+                hasStreamingFailed_ = false;
+                isStreaming_ = true;
+                writerThread_ = std::thread(&TelemetryRecorder::writerLoop, this);
+            }
+            else
+            {
+                /* Clear the recorded data, but keep the first chunk if the size of the
+                   lines is unchanged, to avoid allocating it again at every simulation. */
+                std::size_t const chunkSize = static_cast<std::size_t>(chunkLinesMax_ * recordedBytesDataLine_);
+                if (!chunks_.empty() && chunks_[0].size() == chunkSize)
+                {
+                    chunks_.resize(1);
+                    chunk_ = chunks_[0].data();
+                    chunkLinesNum_ = 0;
+                }
+                else
+                {
+                    chunks_.clear();
+                    createNewChunk();
+                }
+            }
             isInitialized_ = true;
         }
 
@@ -98,99 +206,174 @@ namespace jiminy
 
     void TelemetryRecorder::reset(void)
     {
-        // Close the current MemoryDevice, if any and if it was opened
-        if (!flows_.empty())
+        // Write the last chunk, even if partially filled, then close the log file
+        if (isInitialized_ && writerThread_.joinable() && chunkLinesNum_ > 0)
         {
-            flows_.back().close();
+            fullChunks_.tryPush({streamingChunkIdx_, chunkLinesNum_});
         }
+        stopStreaming();
 
+        // The recorded data are kept until the next initialization
         isInitialized_ = false;
     }
 
-    hresult_t TelemetryRecorder::createNewChunk()
+    void TelemetryRecorder::createNewChunk(void)
     {
-        hresult_t returnCode = hresult_t::SUCCESS;
+        chunks_.emplace_back(static_cast<std::size_t>(chunkLinesMax_ * recordedBytesDataLine_));
+        chunk_ = chunks_.back().data();
+        chunkLinesNum_ = 0;
+    }
 
-        // Close the current MemoryDevice, if any and if it was opened
-        if (!flows_.empty())
+    void TelemetryRecorder::pushChunk(int64_t const & linesNum)
+    {
+        /* The queue of full chunks can hold all of them, so pushing cannot fail.
+           Then, wait for a chunk to be written if all of them are in flight. */
+        fullChunks_.tryPush({streamingChunkIdx_, linesNum});
+        while (!freeChunks_.tryPop(streamingChunkIdx_))
         {
-            flows_.back().close();
+            std::this_thread::yield();
         }
+        chunk_ = streamingChunks_[streamingChunkIdx_].data();
+        chunkLinesNum_ = 0;
+    }
 
-        /* Create a new chunk.
-           The size of the first chunk is chosen to be large enough
-           to contain the whole header (with constants). Doing this
-           does not really affect the performances since it is written
-           only once, at init of the simulation. The optimized buffer
-           size is used for the log data. */
-        int64_t isHeaderThere = flows_.empty();
-        int64_t maxBufferSize = std::max(TELEMETRY_MIN_BUFFER_SIZE, isHeaderThere * headerSize_);
-        int64_t maxRecordedDataLines = (maxBufferSize - isHeaderThere * headerSize_) / recordedBytesDataLine_;
-        recordedBytesLimits_ = isHeaderThere * headerSize_ + maxRecordedDataLines * recordedBytesDataLine_;
-        flows_.emplace_back(recordedBytesLimits_);
-        returnCode = flows_.back().open(openMode_t::READ_WRITE);
-
-        if (returnCode == hresult_t::SUCCESS)
+    void TelemetryRecorder::writerLoop(void)
+    {
+        std::vector<uint8_t> bufferChunk;
+        std::pair<std::size_t, int64_t> chunk;
+        while (true)
         {
-            recordedBytes_ = 0;
-        }
+            if (fullChunks_.tryPop(chunk))
+            {
+                /* Keep recycling the chunks even if writing has failed,
+                   so that the recording never gets stuck. */
+                if (!hasStreamingFailed_.load(std::memory_order_relaxed))
+                {
+                    hresult_t const returnCode = writeChunk(
+                        *streamingFile_, streamingChunks_[chunk.first].data(),
+                        chunk.second, recordedBytesDataLine_, bufferChunk);
+                    if (returnCode != hresult_t::SUCCESS)
+                    {
+                        hasStreamingFailed_ = true;
+                    }
+                }
+                freeChunks_.tryPush(chunk.first);
+                continue;
+            }
 
-        return returnCode;
+            // A last chunk may have been pushed right before stopping
+            if (!isStreaming_.load(std::memory_order_acquire))
+            {
+                if (fullChunks_.empty())
+                {
+                    break;
+                }
+                continue;
+            }
+
+            // Nothing to do for now. Do not spin to leave the cores to the simulation.
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
     }
 
-    hresult_t TelemetryRecorder::flushDataSnapshot(float64_t const & timestamp)
+    void TelemetryRecorder::stopStreaming(void)
     {
-        hresult_t returnCode = hresult_t::SUCCESS;
-
-        if (recordedBytes_ == recordedBytesLimits_)
+        if (writerThread_.joinable())
         {
-            returnCode = createNewChunk();
+            isStreaming_.store(false, std::memory_order_release);
+            writerThread_.join();
         }
-
-        if (returnCode == hresult_t::SUCCESS)
+        if (streamingFile_)
         {
-            // Write new line token
-            flows_.back().write(START_LINE_TOKEN);
+            streamingFile_->close();
+            streamingFile_.reset();
 
-            // Write time
-            flows_.back().write(static_cast<int64_t>(std::round(timestamp * timeUnitInv_)));
+            // Release the memory, since the data are now available in the log file
+            streamingChunks_.clear();
+            streamingChunks_.shrink_to_fit();
+            chunk_ = nullptr;
 
-            // Write data, integers first
-            for (std::pair<std::string, int64_t> const & keyValue : *integersRegistry_)
+            if (hasStreamingFailed_)
             {
-                flows_.back().write(keyValue.second);
+                PRINT_ERROR("Failed to stream the telemetry to the log file '", streamingPath_,
+                            "'. Check the remaining disk space.");
             }
+        }
+    }
 
-            // Write data, floats last
-            for (std::pair<std::string, float64_t> const & keyValue : *floatsRegistry_)
+    hresult_t TelemetryRecorder::flushDataSnapshot(float64_t const & timestamp)
+    {
+        if (chunkLinesNum_ == chunkLinesMax_)
+        {
+            if (writerThread_.joinable())
             {
-                flows_.back().write(keyValue.second);
+                pushChunk(chunkLinesNum_);
+            }
+            else
+            {
+                createNewChunk();
             }
-
-            // Update internal counter
-            recordedBytes_ += recordedBytesDataLine_;
         }
 
-        return returnCode;
+        // Update the time in the current line of data
+        int64_t const time = static_cast<int64_t>(std::round(timestamp * timeUnitInv_));
+        std::memcpy(dataSnapshot_, &time, sizeof(int64_t));
+
+        /* Copy the whole line at once, since the time, the integers and
+           the floats are already stored contiguously in that order. */
+        std::memcpy(chunk_ + chunkLinesNum_ * recordedBytesDataLine_,
+                    dataSnapshot_, static_cast<std::size_t>(recordedBytesDataLine_));
+        ++chunkLinesNum_;
+
+        return hresult_t::SUCCESS;
     }
 
     hresult_t TelemetryRecorder::writeLog(std::string const & filename)
     {
+        // In streaming mode, the log file already exists, so it is only copied if necessary
+        if (!streamingPath_.empty())
+        {
+            if (writerThread_.joinable())
+            {
+                PRINT_ERROR("The log file is still being streamed. Please stop the simulation before writing log.");
+                return hresult_t::ERROR_GENERIC;
+            }
+            if (hasStreamingFailed_)
+            {
+                PRINT_ERROR("The log file is incomplete since streaming has failed.");
+                return hresult_t::ERROR_GENERIC;
+            }
+            try
+            {
+                std::filesystem::path const streamingPath(streamingPath_);
+                std::filesystem::path const path(filename);
+                if (!std::filesystem::exists(path) || !std::filesystem::equivalent(streamingPath, path))
+                {
+                    std::filesystem::copy_file(
+                        streamingPath, path, std::filesystem::copy_options::overwrite_existing);
+                }
+            }
+            catch (std::filesystem::filesystem_error const & e)
+            {
+                PRINT_ERROR("Impossible to copy the log file.\nRaised from exception: ", e.what());
+                return hresult_t::ERROR_BAD_INPUT;
+            }
+            return hresult_t::SUCCESS;
+        }
+
         FileDevice myFile(filename);
         myFile.open(openMode_t::WRITE_ONLY | openMode_t::TRUNCATE);
         if (myFile.isOpen())
         {
-            for (auto & flow : flows_)
-            {
-                int64_t const pos_old = flow.pos();
-                flow.seek(0);
+            // Write the header
+            myFile.write(header_);
 
-                std::vector<uint8_t> bufferChunk;
-                bufferChunk.resize(static_cast<std::size_t>(pos_old));
-                flow.read(bufferChunk);
-                myFile.write(bufferChunk);
-
-                flow.seek(pos_old);
+            // Write the data chunk by chunk, prepending the token to every line
+            std::vector<uint8_t> bufferChunk;
+            for (std::size_t i = 0; i < chunks_.size(); ++i)
+            {
+                int64_t const linesNum = (i + 1 < chunks_.size()) ? chunkLinesMax_ : chunkLinesNum_;
+                writeChunk(myFile, chunks_[i].data(), linesNum, recordedBytesDataLine_, bufferChunk);
             }
 
             myFile.close();
@@ -370,14 +553,65 @@ namespace jiminy
 
     hresult_t TelemetryRecorder::getLog(logData_t & logData)
     {
-        std::vector<AbstractIODevice *> abstractFlows_;
-        for (MemoryDevice & device: flows_)
+        // Return empty log data if nothing has been recorded so far
+        if (header_.empty())
         {
-            abstractFlows_.push_back(&device);
+            logData = {};
+            return hresult_t::SUCCESS;
         }
 
-        return parseLogDataRaw(
-            abstractFlows_, integerSectionSize_, floatSectionSize_, headerSize_, logData);
+        // In streaming mode, the data must be read back from the log file
+        if (!streamingPath_.empty())
+        {
+            if (writerThread_.joinable())
+            {
+                PRINT_ERROR("The log file is still being streamed. Please stop the simulation before getting log.");
+                return hresult_t::ERROR_GENERIC;
+            }
+            return readLog(streamingPath_, logData);
+        }
+
+        // Parse the header, to get the version, the constants and the fieldnames
+        MemoryDevice headerDevice(std::vector<uint8_t>(header_.begin(), header_.end()));
+        headerDevice.open(openMode_t::READ_ONLY);
+        std::vector<AbstractIODevice *> flows{&headerDevice};
+        hresult_t returnCode = parseLogDataRaw(
+            flows, integerSectionSize_, floatSectionSize_, headerSize_, logData);
+
+        if (returnCode == hresult_t::SUCCESS)
+        {
+            // Allocate memory
+            Eigen::Index const numInt = static_cast<Eigen::Index>(integerSectionSize_ / sizeof(int64_t));
+            Eigen::Index const numFloat = static_cast<Eigen::Index>(floatSectionSize_ / sizeof(float64_t));
+            Eigen::Index const numData = static_cast<Eigen::Index>(
+                (chunks_.size() - 1) * chunkLinesMax_ + chunkLinesNum_);
+            logData.timestamps.resize(numData);
+            logData.intData.resize(numInt, numData);
+            logData.floatData.resize(numFloat, numData);
+
+            /* Copy the data chunk by chunk. The lines of data are the columns of a
+               matrix whose outer stride is the size of a whole line. */
+            Eigen::OuterStride<> const lineStride(1 + numInt + numFloat);
+            Eigen::Index timeIdx = 0;
+            for (std::size_t i = 0; i < chunks_.size(); ++i)
+            {
+                Eigen::Index const linesNum = static_cast<Eigen::Index>(
+                    (i + 1 < chunks_.size()) ? chunkLinesMax_ : chunkLinesNum_);
+                int64_t const * chunkPtr = reinterpret_cast<int64_t const *>(chunks_[i].data());
+                logData.timestamps.segment(timeIdx, linesNum) =
+                    Eigen::Map<Eigen::Matrix<int64_t, Eigen::Dynamic, 1> const, 0, Eigen::InnerStride<> >(
+                        chunkPtr, linesNum, Eigen::InnerStride<>(lineStride.outer()));
+                logData.intData.middleCols(timeIdx, linesNum) =
+                    Eigen::Map<Eigen::Matrix<int64_t, Eigen::Dynamic, Eigen::Dynamic> const, 0, Eigen::OuterStride<> >(
+                        chunkPtr + 1, numInt, linesNum, lineStride);
+                logData.floatData.middleCols(timeIdx, linesNum) =
+                    Eigen::Map<Eigen::Matrix<float64_t, Eigen::Dynamic, Eigen::Dynamic> const, 0, Eigen::OuterStride<> >(
+                        reinterpret_cast<float64_t const *>(chunkPtr + 1 + numInt), numFloat, linesNum, lineStride);
+                timeIdx += linesNum;
+            }
+        }
+
+        return returnCode;
     }
 
     hresult_t TelemetryRecorder::readLog(std::string const & filename,
@@ -15,71 +15,47 @@ namespace jiminy
     TelemetrySender::TelemetrySender(void) :
     objectName_(DEFAULT_TELEMETRY_NAMESPACE),
     telemetryData_(nullptr),
-    intBufferPosition_(),
-    floatBufferPosition_()
+    intBuffer_(nullptr),
+    floatBuffer_(nullptr),
+    localNumEntries_(0U),
+    generation_(0U)
     {
         // Empty on purpose
     }
 
     template<>
-    void TelemetrySender::updateValue<int64_t>(std::string const & fieldnameIn,
-                                               int64_t     const & value)
+    hresult_t TelemetrySender::registerVariable<int64_t>(std::string                const & fieldnameIn,
+                                                         int64_t                    const & initialValue,
+                                                         telemetryHandle_t<int64_t>       & handle)
     {
-        auto it = intBufferPosition_.find(fieldnameIn);
-        if (it == intBufferPosition_.end())
-        {
-            PRINT_ERROR("Cannot log the variable: it was never registered as an int64_t before! |", fieldnameIn.c_str(), "|");
-            return;
-        }
-
-        // Write the value directly in the buffer holder using the pointer stored in the map.
-        *(it->second) = value;
-    }
-
-    template<>
-    void TelemetrySender::updateValue<float64_t>(std::string const & fieldnameIn,
-                                                 float64_t   const & value)
-    {
-        auto it = floatBufferPosition_.find(fieldnameIn);
-        if (it == floatBufferPosition_.end())
-        {
-            PRINT_ERROR("Cannot log the variable: it was never registered as a float64_t before! |", fieldnameIn.c_str(), "|");
-            return;
-        }
-
-        // Write the value directly in the buffer holder using the pointer stored in the map.
-        *(it->second) = value;
-    }
-
-    template<>
-    hresult_t TelemetrySender::registerVariable<int64_t>(std::string const & fieldnameIn,
-                                                         int64_t     const & initialValue)
-    {
-        int64_t * positionInBuffer = nullptr;
+        std::size_t index = 0U;
         std::string const fullFieldName = objectName_ + TELEMETRY_FIELDNAME_DELIMITER + fieldnameIn;
 
-        hresult_t returnCode = telemetryData_->registerVariable(fullFieldName, positionInBuffer);
+        hresult_t returnCode = telemetryData_->registerVariable<int64_t>(fullFieldName, index);
         if (returnCode == hresult_t::SUCCESS)
         {
-            intBufferPosition_[fieldnameIn] = positionInBuffer;
-            updateValue(fieldnameIn, initialValue);
+            handle = {index, 1U};
+            updateValue(handle, initialValue);
+            ++localNumEntries_;
         }
 
         return returnCode;
     }
 
     template<>
-    hresult_t TelemetrySender::registerVariable<float64_t>(std::string const & fieldnameIn,
-                                                           float64_t   const & initialValue)
+    hresult_t TelemetrySender::registerVariable<float64_t>(std::string                  const & fieldnameIn,
+                                                           float64_t                    const & initialValue,
+                                                           telemetryHandle_t<float64_t>       & handle)
     {
-        float64_t * positionInBuffer = nullptr;
+        std::size_t index = 0U;
         std::string const fullFieldName = objectName_ + TELEMETRY_FIELDNAME_DELIMITER + fieldnameIn;
 
-        hresult_t returnCode = telemetryData_->registerVariable(fullFieldName, positionInBuffer);
+        hresult_t returnCode = telemetryData_->registerVariable<float64_t>(fullFieldName, index);
         if (returnCode == hresult_t::SUCCESS)
         {
-            floatBufferPosition_[fieldnameIn] = positionInBuffer;
-            updateValue(fieldnameIn, initialValue);
+            handle = {index, 1U};
+            updateValue(handle, initialValue);
+            ++localNumEntries_;
         }
 
         return returnCode;
@@ -97,13 +73,20 @@ namespace jiminy
     {
         objectName_ = objectNameIn;
         telemetryData_ = telemetryDataInstance;
-        intBufferPosition_.clear();
-        floatBufferPosition_.clear();
+        intBuffer_ = telemetryData_->getRegistry<int64_t>();
+        floatBuffer_ = telemetryData_->getRegistry<float64_t>();
+        localNumEntries_ = 0U;
+        generation_ = telemetryData_->getGeneration();
+    }
+
+    bool_t TelemetrySender::getIsConfigured(void) const
+    {
+        return telemetryData_ && generation_ == telemetryData_->getGeneration();
     }
 
     uint32_t TelemetrySender::getLocalNumEntries(void) const
     {
-        return static_cast<uint32_t>(floatBufferPosition_.size() + intBufferPosition_.size());
+        return localNumEntries_;
     }
 
     std::string const & TelemetrySender::getObjectName(void) const
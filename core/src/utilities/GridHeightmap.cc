@@ -0,0 +1,165 @@
+#include <cmath>
+#include <algorithm>
+
+#include "jiminy/core/utilities/Random.h"
+
+#include "jiminy/core/utilities/GridHeightmap.h"
+
+
+namespace jiminy
+{
+    namespace
+    {
+        /// \brief Catmull-Rom spline weights of the 4 neighbouring samples, and their derivative.
+        void catmullRomWeights(float64_t const & t,
+                               vector4_t       & weights,
+                               vector4_t       & weightsDiff)
+        {
+            float64_t const t2 = t * t;
+            float64_t const t3 = t2 * t;
+            weights << 0.5 * (- t3 + 2.0 * t2 - t),
+                       0.5 * (3.0 * t3 - 5.0 * t2 + 2.0),
+                       0.5 * (- 3.0 * t3 + 4.0 * t2 + t),
+                       0.5 * (t3 - t2);
+            weightsDiff << 0.5 * (- 3.0 * t2 + 4.0 * t - 1.0),
+                           0.5 * (9.0 * t2 - 10.0 * t),
+                           0.5 * (- 9.0 * t2 + 8.0 * t + 1.0),
+                           0.5 * (3.0 * t2 - 2.0 * t);
+        }
+    }
+
+    GridHeightmap::GridHeightmap(matrixN_t                const & heights,
+                                 vector2_t                const & origin,
+                                 float64_t                const & resolution,
+                                 heightmapInterpolation_t const & interpolation) :
+    heights_(std::make_shared<matrixN_t const>(heights)),
+    origin_(origin),
+    resolution_(resolution),
+    resolutionInv_(1.0 / resolution),
+    interpolation_(interpolation)
+    {
+        assert(heights.rows() > 1 && heights.cols() > 1 && "The grid must have at least 2 points along each axis.");
+        assert(resolution > EPS && "The resolution of the grid must be strictly positive.");
+    }
+
+    GridHeightmap GridHeightmap::fromHeightmap(heightmapFunctor_t       const & heightmap,
+                                               float64_t                const & gridSize,
+                                               float64_t                const & gridUnit,
+                                               heightmapInterpolation_t const & interpolation)
+    {
+        // Sample the heightmap, then extract the heights, stored column-major wrt (x, y)
+        matrixN_t const heightGrid = discretizeHeightmap(heightmap, gridSize, gridUnit);
+        Eigen::Index const gridDim = static_cast<Eigen::Index>(
+            std::lround(std::sqrt(static_cast<float64_t>(heightGrid.rows()))));
+        matrixN_t const heights = Eigen::Map<matrixN_t const>(heightGrid.col(2).data(), gridDim, gridDim);
+        return {heights, heightGrid.block<1, 2>(0, 0).transpose(), gridUnit, interpolation};
+    }
+
+    void GridHeightmap::evaluate(float64_t const & x,
+                                 float64_t const & y,
+                                 float64_t       & height,
+                                 vector3_t       & normal) const
+    {
+        matrixN_t const & heights = *heights_;
+        Eigen::Index const nx = heights.rows();
+        Eigen::Index const ny = heights.cols();
+
+        /* Compute the continuous grid coordinates. They are clamped to extend the
+           height of the border outside the grid, where the slope is zero. */
+        float64_t const uRaw = (x - origin_[0]) * resolutionInv_;
+        float64_t const vRaw = (y - origin_[1]) * resolutionInv_;
+        float64_t const u = std::clamp(uRaw, 0.0, static_cast<float64_t>(nx - 1));
+        float64_t const v = std::clamp(vRaw, 0.0, static_cast<float64_t>(ny - 1));
+        Eigen::Index const i = std::min(static_cast<Eigen::Index>(u), nx - 2);
+        Eigen::Index const j = std::min(static_cast<Eigen::Index>(v), ny - 2);
+        float64_t const tx = u - static_cast<float64_t>(i);
+        float64_t const ty = v - static_cast<float64_t>(j);
+
+        // Interpolate the height and its gradient wrt the grid coordinates
+        float64_t dzdu, dzdv;
+        if (interpolation_ == heightmapInterpolation_t::BICUBIC)
+        {
+            Eigen::Matrix<float64_t, 4, 4> patch;
+            for (Eigen::Index a = 0; a < 4; ++a)
+            {
+                Eigen::Index const ia = std::clamp(i - 1 + a, Eigen::Index(0), nx - 1);
+                for (Eigen::Index b = 0; b < 4; ++b)
+                {
+                    Eigen::Index const jb = std::clamp(j - 1 + b, Eigen::Index(0), ny - 1);
+                    patch(a, b) = heights(ia, jb);
+                }
+            }
+            vector4_t wx, dwx, wy, dwy;
+            catmullRomWeights(tx, wx, dwx);
+            catmullRomWeights(ty, wy, dwy);
+            vector4_t const patchWy = patch * wy;
+            height = wx.dot(patchWy);
+            dzdu = dwx.dot(patchWy);
+            dzdv = wx.dot(patch * dwy);
+        }
+        else
+        {
+            float64_t const & z00 = heights(i, j);
+            float64_t const & z10 = heights(i + 1, j);
+            float64_t const & z01 = heights(i, j + 1);
+            float64_t const & z11 = heights(i + 1, j + 1);
+            height = (1.0 - ty) * ((1.0 - tx) * z00 + tx * z10) + ty * ((1.0 - tx) * z01 + tx * z11);
+            dzdu = (1.0 - ty) * (z10 - z00) + ty * (z11 - z01);
+            dzdv = (1.0 - tx) * (z01 - z00) + tx * (z11 - z10);
+        }
+        if (u != uRaw)
+        {
+            dzdu = 0.0;
+        }
+        if (v != vRaw)
+        {
+            dzdv = 0.0;
+        }
+
+        // The normal is orthogonal to the tangent plane (1, 0, dz/dx) x (0, 1, dz/dy)
+        normal << - dzdu * resolutionInv_, - dzdv * resolutionInv_, 1.0;
+        normal.normalize();
+    }
+
+    std::pair<float64_t, vector3_t> GridHeightmap::operator()(vector3_t const & pos) const
+    {
+        std::pair<float64_t, vector3_t> ground;
+        evaluate(pos[0], pos[1], ground.first, ground.second);
+        return ground;
+    }
+
+    void GridHeightmap::operator()(matrix3N_t const & positions,
+                                   vectorN_t        & heights,
+                                   matrix3N_t       & normals) const
+    {
+        assert(heights.size() == positions.cols() && normals.cols() == positions.cols()
+            && "The outputs must be pre-allocated.");
+
+        for (Eigen::Index i = 0; i < positions.cols(); ++i)
+        {
+            vector3_t normal;
+            evaluate(positions(0, i), positions(1, i), heights[i], normal);
+            normals.col(i) = normal;
+        }
+    }
+
+    matrixN_t const & GridHeightmap::getHeights(void) const
+    {
+        return *heights_;
+    }
+
+    vector2_t const & GridHeightmap::getOrigin(void) const
+    {
+        return origin_;
+    }
+
+    float64_t const & GridHeightmap::getResolution(void) const
+    {
+        return resolution_;
+    }
+
+    heightmapInterpolation_t const & GridHeightmap::getInterpolation(void) const
+    {
+        return interpolation_;
+    }
+}
@@ -66,6 +66,12 @@ namespace jiminy
         dt = timeDiff.count();
     }
 
+    float64_t Timer::getElapsed(void) const
+    {
+        std::chrono::duration<float64_t> const timeDiff = Time::now() - t0;
+        return timeDiff.count();
+    }
+
     // ************ IO file and Directory utilities **************
 
     #ifndef _WIN32
@@ -8,62 +8,184 @@ namespace jiminy
     static float64_t const PERLIN_NOISE_PERSISTENCE = 1.50;
     static float64_t const PERLIN_NOISE_LACUNARITY = 1.15;
 
-    // ***************** Random number generator_ *****************
+    // ***************** Counter-based random number generator *****************
+
+    namespace philox
+    {
+        uint32_t const M0 = 0xD2511F53U;
+        uint32_t const M1 = 0xCD9E8D57U;
+        uint32_t const W0 = 0x9E3779B9U;
+        uint32_t const W1 = 0xBB67AE85U;
+        uint8_t const ROUNDS = 10U;
+
+        inline uint32_t mulhilo(uint32_t const & a,
+                                uint32_t const & b,
+                                uint32_t       & hi)
+        {
+            uint64_t const product = static_cast<uint64_t>(a) * static_cast<uint64_t>(b);
+            hi = static_cast<uint32_t>(product >> 32);
+            return static_cast<uint32_t>(product);
+        }
+    }
+
+    PhiloxGenerator::PhiloxGenerator(uint32_t const & seed,
+                                     uint32_t const & stream) :
+    key_(),
+    counter_(),
+    block_(),
+    blockIdx_(4U)
+    {
+        this->seed(seed, stream);
+    }
+
+    void PhiloxGenerator::seed(uint32_t const & seed,
+                               uint32_t const & stream)
+    {
+        key_ = {seed, stream};
+        counter_.fill(0U);
+        blockIdx_ = 4U;
+    }
+
+    PhiloxGenerator PhiloxGenerator::split(uint32_t const & stream) const
+    {
+        return PhiloxGenerator(key_[0], stream);
+    }
+
+    void PhiloxGenerator::setCounter(std::array<uint32_t, 4> const & counter)
+    {
+        counter_ = counter;
+        blockIdx_ = 4U;
+    }
+
+    void PhiloxGenerator::generateBlock(void)
+    {
+        std::array<uint32_t, 4> ctr = counter_;
+        std::array<uint32_t, 2> key = key_;
+        for (uint8_t i = 0; i < philox::ROUNDS; ++i)
+        {
+            uint32_t hi0, hi1;
+            uint32_t const lo0 = philox::mulhilo(philox::M0, ctr[0], hi0);
+            uint32_t const lo1 = philox::mulhilo(philox::M1, ctr[2], hi1);
+            ctr = {hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0};
+            key[0] += philox::W0;
+            key[1] += philox::W1;
+        }
+        block_ = ctr;
+
+        // Increment the 128-bits counter
+        for (uint32_t & word : counter_)
+        {
+            if (++word != 0U)
+            {
+                break;
+            }
+        }
+    }
+
+    PhiloxGenerator::result_type PhiloxGenerator::operator()(void)
+    {
+        if (blockIdx_ >= 4U)
+        {
+            generateBlock();
+            blockIdx_ = 0U;
+        }
+        return block_[blockIdx_++];
+    }
+
+    void PhiloxGenerator::discard(uint64_t n)
+    {
+        // Consume the current block first, then skip whole blocks by moving the counter
+        while (n > 0U && blockIdx_ < 4U)
+        {
+            ++blockIdx_;
+            --n;
+        }
+        uint64_t const nBlocks = n / 4U;
+        uint64_t const counterLow = (static_cast<uint64_t>(counter_[1]) << 32) | counter_[0];
+        uint64_t const counterLowNew = counterLow + nBlocks;
+        counter_[0] = static_cast<uint32_t>(counterLowNew);
+        counter_[1] = static_cast<uint32_t>(counterLowNew >> 32);
+        if (counterLowNew < counterLow && ++counter_[2] == 0U)
+        {
+            ++counter_[3];
+        }
+        for (n %= 4U; n > 0U; --n)
+        {
+            (*this)();
+        }
+    }
+
+    // ***************** Random number generator utilities *****************
 
     // Based on Ziggurat generator by Marsaglia and Tsang (JSS, 2000):
     // https://people.sc.fsu.edu/~jburkardt/cpp_src/ziggurat/ziggurat.html
 
-    std::mt19937 generator_;
-    std::uniform_real_distribution<float32_t> distUniform_(0.0, 1.0);
+    PhiloxGenerator generator_;
     bool_t isInitialized_ = false;
     uint32_t seed_ = 0U;
 
-    uint32_t kn[128];
-    float32_t fn[128];
-    float32_t wn[128];
-
-    void r4_nor_setup(void)
+    struct zigguratTables_t
     {
-        float64_t const m1 = 2147483648.0;
-        float64_t const vn = 9.91256303526217e-03;
-        float64_t dn = 3.442619855899;
-        float64_t tn = dn;
+        zigguratTables_t(void)
+        {
+            float64_t const m1 = 2147483648.0;
+            float64_t const vn = 9.91256303526217e-03;
+            float64_t dn = 3.442619855899;
+            float64_t tn = dn;
 
-        float64_t q = vn / exp(-0.5 * dn * dn);
+            float64_t q = vn / exp(-0.5 * dn * dn);
 
-        kn[0] = static_cast<uint32_t>((dn / q) * m1);
-        kn[1] = 0;
+            kn[0] = static_cast<uint32_t>((dn / q) * m1);
+            kn[1] = 0;
 
-        wn[0] = static_cast<float32_t>(q / m1);
-        wn[127] = static_cast<float32_t>(dn / m1);
+            wn[0] = static_cast<float32_t>(q / m1);
+            wn[127] = static_cast<float32_t>(dn / m1);
 
-        fn[0] = 1.0f;
-        fn[127] = static_cast<float32_t>(exp(-0.5 * dn * dn));
+            fn[0] = 1.0f;
+            fn[127] = static_cast<float32_t>(exp(-0.5 * dn * dn));
 
-        for (uint8_t i=126; 1 <= i; i--)
-        {
-            dn = sqrt(-2.0 * log(vn / dn + exp(-0.5 * dn * dn)));
-            kn[i+1] = static_cast<uint32_t>((dn / tn) * m1);
-            tn = dn;
-            fn[i] = static_cast<float32_t>(exp(-0.5 * dn * dn));
-            wn[i] = static_cast<float32_t>(dn / m1);
+            for (uint8_t i=126; 1 <= i; i--)
+            {
+                dn = sqrt(-2.0 * log(vn / dn + exp(-0.5 * dn * dn)));
+                kn[i+1] = static_cast<uint32_t>((dn / tn) * m1);
+                tn = dn;
+                fn[i] = static_cast<float32_t>(exp(-0.5 * dn * dn));
+                wn[i] = static_cast<float32_t>(dn / m1);
+            }
         }
+
+        uint32_t kn[128];
+        float32_t fn[128];
+        float32_t wn[128];
+    };
+
+    zigguratTables_t const & getZigguratTables(void)
+    {
+        // The tables are constant, so they are computed once and shared by every generator
+        static zigguratTables_t const tables;
+        return tables;
     }
 
-    float32_t r4_uni(void)
+    float32_t r4_uni(PhiloxGenerator & generator)
     {
-        return distUniform_(generator_);
+        // Uniform in (0, 1) using the 24 most significant bits, which is the precision of float32_t
+        return (static_cast<float32_t>(generator() >> 8) + 0.5f) * 5.9604644775390625e-8f;
     }
 
-    float32_t r4_nor(void)
+    float32_t r4_nor(PhiloxGenerator & generator)
     {
+        zigguratTables_t const & tables = getZigguratTables();
+        uint32_t const * const kn = tables.kn;
+        float32_t const * const fn = tables.fn;
+        float32_t const * const wn = tables.wn;
+
         float32_t const r = 3.442620f;
         int32_t hz;
         uint32_t iz;
         float32_t x;
         float32_t y;
 
-        hz = static_cast<int32_t>(generator_());
+        hz = static_cast<int32_t>(generator());
         iz = (static_cast<uint32_t>(hz) & 127U);
 
         if (fabs(hz) < kn[iz])
@@ -78,8 +200,8 @@ namespace jiminy
                 {
                     while (true)
                     {
-                        x = - 0.2904764f * log(r4_uni());
-                        y = - log(r4_uni());
+                        x = - 0.2904764f * log(r4_uni(generator));
+                        y = - log(r4_uni(generator));
                         if (x * x <= y + y)
                         {
                             break;
@@ -98,12 +220,12 @@ namespace jiminy
 
                 x = static_cast<float32_t>(hz) * wn[iz];
 
-                if (fn[iz] + r4_uni() * (fn[iz-1] - fn[iz]) < exp (-0.5f * x * x))
+                if (fn[iz] + r4_uni(generator) * (fn[iz-1] - fn[iz]) < exp (-0.5f * x * x))
                 {
                     return x;
                 }
 
-                hz = static_cast<int32_t>(generator_());
+                hz = static_cast<int32_t>(generator());
                 iz = (hz & 127);
 
                 if (fabs(hz) < kn[iz])
@@ -119,7 +241,6 @@ namespace jiminy
         uint32_t newSeed = seed.value_or(seed_);
         srand(newSeed);  // Eigen relies on srand for generating random numbers
         generator_.seed(newSeed);
-        r4_nor_setup();
         seed_ = newSeed;
         isInitialized_ = true;
     }
@@ -142,7 +263,14 @@ namespace jiminy
     {
         assert(isInitialized_ && "Random number genetors not initialized. "
                                  "Please call `resetRandomGenerators` at least once.");
-        return lo + r4_uni() * (hi - lo);
+        return randUniform(generator_, lo, hi);
+    }
+
+    float64_t randUniform(PhiloxGenerator       & generator,
+                          float64_t       const & lo,
+                          float64_t       const & hi)
+    {
+        return lo + r4_uni(generator) * (hi - lo);
     }
 
     float64_t randNormal(float64_t const & mean,
@@ -150,19 +278,34 @@ namespace jiminy
     {
         assert(isInitialized_ && "Random number genetors not initialized. "
                                  "Please call `resetRandomGenerators` at least once.");
-        return mean + r4_nor() * std;
+        return randNormal(generator_, mean, std);
+    }
+
+    float64_t randNormal(PhiloxGenerator       & generator,
+                         float64_t       const & mean,
+                         float64_t       const & std)
+    {
+        return mean + r4_nor(generator) * std;
     }
 
     vectorN_t randVectorNormal(uint32_t  const & size,
                                float64_t const & mean,
                                float64_t const & std)
+    {
+        return randVectorNormal(generator_, size, mean, std);
+    }
+
+    vectorN_t randVectorNormal(PhiloxGenerator       & generator,
+                               uint32_t        const & size,
+                               float64_t       const & mean,
+                               float64_t       const & std)
     {
         if (std > 0.0)
         {
             return vectorN_t::NullaryExpr(size,
-            [&mean, &std] (vectorN_t::Index const &) -> float64_t
+            [&generator, &mean, &std] (vectorN_t::Index const &) -> float64_t
             {
-                return randNormal(mean, std);
+                return randNormal(generator, mean, std);
             });
         }
         else
@@ -174,31 +317,133 @@ namespace jiminy
     vectorN_t randVectorNormal(uint32_t  const & size,
                                float64_t const & std)
     {
-        return randVectorNormal(size, 0.0, std);
+        return randVectorNormal(generator_, size, 0.0, std);
+    }
+
+    vectorN_t randVectorNormal(PhiloxGenerator       & generator,
+                               uint32_t        const & size,
+                               float64_t       const & std)
+    {
+        return randVectorNormal(generator, size, 0.0, std);
     }
 
     vectorN_t randVectorNormal(vectorN_t const & mean,
                                vectorN_t const & std)
+    {
+        return randVectorNormal(generator_, mean, std);
+    }
+
+    vectorN_t randVectorNormal(PhiloxGenerator       & generator,
+                               vectorN_t       const & mean,
+                               vectorN_t       const & std)
     {
         return vectorN_t::NullaryExpr(std.size(),
-        [&mean, &std] (vectorN_t::Index const & i) -> float64_t
+        [&generator, &mean, &std] (vectorN_t::Index const & i) -> float64_t
         {
-            return randNormal(mean[i], std[i]);
+            return randNormal(generator, mean[i], std[i]);
         });
     }
 
     vectorN_t randVectorNormal(vectorN_t const & std)
+    {
+        return randVectorNormal(generator_, std);
+    }
+
+    vectorN_t randVectorNormal(PhiloxGenerator       & generator,
+                               vectorN_t       const & std)
     {
         return vectorN_t::NullaryExpr(std.size(),
-        [&std] (vectorN_t::Index const & i) -> float64_t
+        [&generator, &std] (vectorN_t::Index const & i) -> float64_t
         {
-            return randNormal(0, std[i]);
+            return randNormal(generator, 0.0, std[i]);
         });
     }
 
     void shuffleIndices(std::vector<uint32_t> & vector)
     {
-        std::shuffle(vector.begin(), vector.end(), generator_);
+        shuffleIndices(generator_, vector);
+    }
+
+    void shuffleIndices(PhiloxGenerator       & generator,
+                        std::vector<uint32_t> & vector)
+    {
+        std::shuffle(vector.begin(), vector.end(), generator);
+    }
+
+    namespace
+    {
+        Eigen::Index const NORMAL_BATCH_HALF_SIZE = 8;  ///< Number of pairs of normal samples generated at once, ie one AVX register of float32_t
+
+        using uniformBatch_t = Eigen::Array<float32_t, NORMAL_BATCH_HALF_SIZE, 1>;
+        using normalBatch_t = Eigen::Array<float32_t, 2, NORMAL_BATCH_HALF_SIZE>;
+
+        /// \brief Generate a batch of normal samples, of which only the first `size` are valid.
+        ///
+        /// \details The samples are stored contiguously in column-major order. Only the uniform
+        ///          samples actually required are drawn, so that the random stream does not depend
+        ///          on the size of the batch.
+        void randNormalBatch(PhiloxGenerator       & generator,
+                             Eigen::Index    const & size,
+                             normalBatch_t         & normals)
+        {
+            // Sample uniform pairs, the unused ones being set to any valid value
+            uniformBatch_t u1 = uniformBatch_t::Constant(0.5f);
+            uniformBatch_t u2 = uniformBatch_t::Constant(0.5f);
+            Eigen::Index const numPairs = (size + 1) / 2;
+            for (Eigen::Index i = 0; i < numPairs; ++i)
+            {
+                u1[i] = r4_uni(generator);
+                u2[i] = r4_uni(generator);
+            }
+
+            // Box-Muller transform. It is well-defined since uniform samples are never zero.
+            uniformBatch_t const radius = (-2.0f * u1.log()).sqrt();
+            uniformBatch_t const theta = static_cast<float32_t>(2.0 * M_PI) * u2;
+            normals.row(0) = (radius * theta.cos()).transpose();
+            normals.row(1) = (radius * theta.sin()).transpose();
+        }
+    }
+
+    void fillRandomUniform(PhiloxGenerator             & generator,
+                           Eigen::Ref<vectorN_t>         values,
+                           float64_t             const & lo,
+                           float64_t             const & hi)
+    {
+        for (Eigen::Index i = 0; i < values.size(); ++i)
+        {
+            values[i] = lo + r4_uni(generator) * (hi - lo);
+        }
+    }
+
+    void fillRandomNormal(PhiloxGenerator             & generator,
+                          Eigen::Ref<vectorN_t>         values,
+                          float64_t             const & mean,
+                          float64_t             const & std)
+    {
+        normalBatch_t normals;
+        for (Eigen::Index i = 0; i < values.size(); i += normals.size())
+        {
+            Eigen::Index const n = std::min(normals.size(), values.size() - i);
+            randNormalBatch(generator, n, normals);
+            values.segment(i, n).array() = mean + std * Eigen::Map<Eigen::ArrayXf const>(
+                normals.data(), n).cast<float64_t>();
+        }
+    }
+
+    void fillRandomNormal(PhiloxGenerator             & generator,
+                          Eigen::Ref<vectorN_t>         values,
+                          vectorN_t             const & std)
+    {
+        assert(values.size() == std.size() && "The standard deviation must have the same size as the output.");
+
+        normalBatch_t normals;
+        for (Eigen::Index i = 0; i < values.size(); i += normals.size())
+        {
+            Eigen::Index const n = std::min(normals.size(), values.size() - i);
+            randNormalBatch(generator, n, normals);
+            values.segment(i, n).array() = std.segment(i, n).array() * Eigen::Map<Eigen::ArrayXf const>(
+                normals.data(), n).cast<float64_t>();
+        }
     }
 
     //-----------------------------------------------------------------------------
@@ -345,6 +590,11 @@ namespace jiminy
     }
 
     void PeriodicGaussianProcess::reset(void)
+    {
+        reset(generator_);
+    }
+
+    void PeriodicGaussianProcess::reset(PhiloxGenerator & generator)
     {
         // Initialize the process if not already done
         if (!isInitialized_)
@@ -354,7 +604,7 @@ namespace jiminy
 
         // Sample normal vector
         vectorN_t const normalVec = vectorN_t::NullaryExpr(numTimes_,
-            [](float64_t const &) { return randNormal(); });
+            [&generator](float64_t const &) { return randNormal(generator); });
 
         // Compute discrete periodic gaussian process values
         values_.noalias() = covSqrtRoot_.triangularView<Eigen::Lower>() * normalVec;
@@ -447,6 +697,11 @@ namespace jiminy
     }
 
     void PeriodicFourierProcess::reset(void)
+    {
+        reset(generator_);
+    }
+
+    void PeriodicFourierProcess::reset(PhiloxGenerator & generator)
     {
         // Initialize the process if not already done
         if (!isInitialized_)
@@ -456,9 +711,9 @@ namespace jiminy
 
         // Sample normal vectors
         vectorN_t normalVec1 = vectorN_t::NullaryExpr(numHarmonics_,
-            [](float64_t const &) { return randNormal(); });
+            [&generator](float64_t const &) { return randNormal(generator); });
         vectorN_t normalVec2 = vectorN_t::NullaryExpr(numHarmonics_,
-            [](float64_t const &) { return randNormal(); });
+            [&generator](float64_t const &) { return randNormal(generator); });
 
         // Compute discrete periodic gaussian process values
         values_ = M_SQRT2 / std::sqrt(2 * numHarmonics_ + 1) * (
@@ -537,10 +792,10 @@ namespace jiminy
         // Empty on purpose
     }
 
-    void AbstractPerlinNoiseOctave::reset(void)
+    void AbstractPerlinNoiseOctave::reset(PhiloxGenerator & generator)
     {
         // Sample random phase shift
-        shift_ = randUniform();
+        shift_ = randUniform(generator);
     }
 
     float64_t AbstractPerlinNoiseOctave::operator()(float64_t const & t) const
@@ -597,13 +852,13 @@ namespace jiminy
         // Empty on purpose
     }
 
-    void RandomPerlinNoiseOctave::reset(void)
+    void RandomPerlinNoiseOctave::reset(PhiloxGenerator & generator)
     {
         // Call base implementation
-        AbstractPerlinNoiseOctave::reset();
+        AbstractPerlinNoiseOctave::reset(generator);
 
         // Sample new random seed for MurmurHash
-        seed_ = static_cast<uint32_t>(generator_());
+        seed_ = generator();
     }
 
     float64_t RandomPerlinNoiseOctave::grad(int32_t knot,
@@ -634,16 +889,16 @@ namespace jiminy
         assert (std::abs(period_ - period) < 1e-6);
     }
 
-    void PeriodicPerlinNoiseOctave::reset(void)
+    void PeriodicPerlinNoiseOctave::reset(PhiloxGenerator & generator)
     {
         // Call base implementation
-        AbstractPerlinNoiseOctave::reset();
+        AbstractPerlinNoiseOctave::reset(generator);
 
         // Initialize the permutation vector with values from 0 to 255
         std::iota(perm_.begin(), perm_.end(), 0);
 
         // Shuffle the permutation vector
-        std::shuffle(perm_.begin(), perm_.end(), generator_);
+        std::shuffle(perm_.begin(), perm_.end(), generator);
     }
 
     float64_t PeriodicPerlinNoiseOctave::grad(int32_t knot,
@@ -676,6 +931,11 @@ namespace jiminy
     }
 
     void AbstractPerlinProcess::reset(void)
+    {
+        reset(generator_);
+    }
+
+    void AbstractPerlinProcess::reset(PhiloxGenerator & generator)
     {
         // Initialize the process if not already done
         if (!isInitialized_)
@@ -686,7 +946,7 @@ namespace jiminy
         // Reset every octave successively
         for (auto & octave: octaves_)
         {
-            octave->reset();
+            octave->reset(generator);
         }
 
         // Compute scaling factor to get values in range [-1.0, 1.0]
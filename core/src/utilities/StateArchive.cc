@@ -0,0 +1,129 @@
+#include <cstring>
+
+#include "jiminy/core/utilities/StateArchive.h"
+
+
+namespace jiminy
+{
+    StateArchive::StateArchive(std::vector<uint8_t> & buffer) :
+    bufferOut_(&buffer),
+    bufferIn_(nullptr),
+    bufferInSize_(0U),
+    mode_(archiveMode_t::SAVE),
+    pos_(0U),
+    isValid_(true)
+    {
+        bufferOut_->clear();
+    }
+
+    StateArchive::StateArchive(std::vector<uint8_t> const & buffer,
+                               archiveMode_t        const & mode) :
+    bufferOut_(nullptr),
+    bufferIn_(buffer.data()),
+    bufferInSize_(buffer.size()),
+    mode_(mode),
+    pos_(0U),
+    isValid_(mode != archiveMode_t::SAVE)
+    {
+        // Empty on purpose
+    }
+
+    void StateArchive::processBytes(void              * data,
+                                    std::size_t const & size)
+    {
+        if (!isValid_)
+        {
+            return;
+        }
+
+        if (mode_ == archiveMode_t::SAVE)
+        {
+            uint8_t const * bytes = static_cast<uint8_t const *>(data);
+            bufferOut_->insert(bufferOut_->end(), bytes, bytes + size);
+        }
+        else
+        {
+            if (pos_ + size > bufferInSize_)
+            {
+                isValid_ = false;
+                return;
+            }
+            if (mode_ == archiveMode_t::RESTORE)
+            {
+                std::memcpy(data, bufferIn_ + pos_, size);
+            }
+        }
+        pos_ += size;
+    }
+
+    void StateArchive::process(float64_t         * data,
+                               std::size_t const & size)
+    {
+        processBytes(data, sizeof(float64_t) * size);
+    }
+
+    void StateArchive::process(pinocchio::Force & value)
+    {
+        processBytes(value.toVector().data(), sizeof(float64_t) * 6U);
+    }
+
+    void StateArchive::process(pinocchio::Motion & value)
+    {
+        processBytes(value.toVector().data(), sizeof(float64_t) * 6U);
+    }
+
+    void StateArchive::process(std::vector<bool_t> & values)
+    {
+        checkSize(values.size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            bool_t value = values[i];
+            processBytes(&value, sizeof(bool_t));
+            values[i] = value;
+        }
+    }
+
+    void StateArchive::processSize(std::size_t & size)
+    {
+        if (mode_ == archiveMode_t::CHECK)
+        {
+            // Read the size without writing anything else
+            mode_ = archiveMode_t::RESTORE;
+            processBytes(&size, sizeof(std::size_t));
+            mode_ = archiveMode_t::CHECK;
+        }
+        else
+        {
+            processBytes(&size, sizeof(std::size_t));
+        }
+    }
+
+    void StateArchive::checkSize(std::size_t const & size)
+    {
+        std::size_t sizeSaved = size;
+        processSize(sizeSaved);
+        if (sizeSaved != size)
+        {
+            isValid_ = false;
+        }
+    }
+
+    archiveMode_t const & StateArchive::getMode(void) const
+    {
+        return mode_;
+    }
+
+    bool_t const & StateArchive::getIsValid(void) const
+    {
+        return isValid_;
+    }
+
+    bool_t StateArchive::getIsComplete(void) const
+    {
+        if (mode_ == archiveMode_t::SAVE)
+        {
+            return isValid_;
+        }
+        return isValid_ && pos_ == bufferInSize_;
+    }
+}
@@ -0,0 +1,214 @@
+#include "jiminy/core/utilities/ThreadPool.h"
+
+
+namespace jiminy
+{
+    ThreadPool::ThreadPool(uint32_t const & threadsNum) :
+    workers_(),
+    queues_(),
+    jobMutex_(),
+    mutex_(),
+    cvWork_(),
+    cvDone_(),
+    job_(nullptr),
+    jobId_(0U),
+    tasksRemaining_(0U),
+    exception_(),
+    isStopping_(false)
+    {
+        // Determine the total number of threads, including the calling thread
+        std::size_t threadsNumEff = threadsNum;
+        if (threadsNumEff == 0U)
+        {
+            threadsNumEff = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+
+        // Allocate one task queue per thread
+        queues_.reserve(threadsNumEff);
+        for (std::size_t i = 0; i < threadsNumEff; ++i)
+        {
+            queues_.emplace_back(std::make_unique<taskQueue_t>());
+        }
+
+        // Spawn the workers. The last queue is reserved for the calling thread.
+        workers_.reserve(threadsNumEff - 1);
+        for (std::size_t i = 0; i < threadsNumEff - 1; ++i)
+        {
+            workers_.emplace_back(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    ThreadPool::~ThreadPool(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            isStopping_ = true;
+        }
+        cvWork_.notify_all();
+        for (std::thread & worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    uint32_t ThreadPool::getThreadsNum(void) const
+    {
+        return static_cast<uint32_t>(queues_.size());
+    }
+
+    bool_t ThreadPool::tryRunTask(std::size_t const & workerIdx)
+    {
+        /* Pop a task from the front of the own queue first, then try to steal one
+           from the back of the other queues, starting from the closest neighbour. */
+        std::size_t const queuesNum = queues_.size();
+        bool_t isTaskFound = false;
+        std::size_t taskIdx = 0U;
+        for (std::size_t i = 0; i < queuesNum; ++i)
+        {
+            taskQueue_t & queue = *queues_[(workerIdx + i) % queuesNum];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty())
+            {
+                if (i == 0)
+                {
+                    taskIdx = queue.tasks.front();
+                    queue.tasks.pop_front();
+                }
+                else
+                {
+                    taskIdx = queue.tasks.back();
+                    queue.tasks.pop_back();
+                }
+                isTaskFound = true;
+                break;
+            }
+        }
+        if (!isTaskFound)
+        {
+            return false;
+        }
+
+        // Run the task, catching any exception to rethrow it in the calling thread later on
+        try
+        {
+            (*job_)(taskIdx);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!exception_)
+            {
+                exception_ = std::current_exception();
+            }
+        }
+
+        // Notify the calling thread if it was the last pending task
+        if (--tasksRemaining_ == 0U)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cvDone_.notify_all();
+        }
+
+        return true;
+    }
+
+    void ThreadPool::workerLoop(std::size_t const & workerIdx)
+    {
+        uint64_t jobIdPrev = 0U;
+        while (true)
+        {
+            // Wait for a new job to be submitted
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cvWork_.wait(lock, [this, &jobIdPrev]()
+                                   {
+                                       return isStopping_ || jobId_ != jobIdPrev;
+                                   });
+                if (isStopping_)
+                {
+                    return;
+                }
+                jobIdPrev = jobId_;
+            }
+
+            // Process tasks until there is nothing left to steal
+            while (tryRunTask(workerIdx))
+            {
+                // Empty on purpose
+            }
+        }
+    }
+
+    void ThreadPool::parallelFor(std::size_t const & size,
+                                 std::function<void(std::size_t const &)> const & fct)
+    {
+        // Early return if there is nothing to do
+        if (size == 0U)
+        {
+            return;
+        }
+
+        // Run the tasks sequentially if the pool has no worker, to avoid any overhead
+        if (workers_.empty())
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                fct(i);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> jobLock(jobMutex_);
+
+        // Register the job before any task becomes visible to the workers
+        job_ = &fct;
+        exception_ = nullptr;
+        tasksRemaining_ = size;
+
+        // Split the range of tasks evenly in contiguous blocks, one per queue
+        std::size_t const queuesNum = queues_.size();
+        for (std::size_t i = 0; i < queuesNum; ++i)
+        {
+            std::size_t const startIdx = (i * size) / queuesNum;
+            std::size_t const endIdx = ((i + 1) * size) / queuesNum;
+            taskQueue_t & queue = *queues_[i];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            for (std::size_t j = startIdx; j < endIdx; ++j)
+            {
+                queue.tasks.push_back(j);
+            }
+        }
+
+        // Wake up the workers
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++jobId_;
+        }
+        cvWork_.notify_all();
+
+        // Take part in the computation
+        while (tryRunTask(queuesNum - 1))
+        {
+            // Empty on purpose
+        }
+
+        // Wait for the tasks still running on the workers to complete
+        std::exception_ptr exception;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cvDone_.wait(lock, [this]()
+                               {
+                                   return tasksRemaining_ == 0U;
+                               });
+            exception = exception_;
+            exception_ = nullptr;
+        }
+        job_ = nullptr;
+
+        // Propagate the first exception raised by the tasks, if any
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+}
@@ -0,0 +1,184 @@
+// Test the collisions between bodies.
+// The tests in this file verify that the sweep-and-prune broadphase keeps exactly the pairs
+// of geometries whose bounding boxes overlap, and that two systems in contact are subject to
+// equal and opposite forces.
+// The test system is a set of ants, whose collision geometries are spheres.
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/algorithm/kinematics.hpp"
+#include "pinocchio/algorithm/geometry.hpp"
+
+#include "jiminy/core/engine/CollisionWorld.h"
+#include "jiminy/core/engine/EngineMultiRobot.h"
+#include "jiminy/core/robot/Robot.h"
+#include "jiminy/core/Types.h"
+
+
+using namespace jiminy;
+
+
+// Ant having the given bodies for collision bodies
+std::shared_ptr<Robot> makeAnt(std::vector<std::string> const & collisionBodiesNames)
+{
+    std::string const urdfPath = std::string(ROBOTS_DATA_DIR) + "toys_models/ant/ant.urdf";
+    auto robot = std::make_shared<Robot>();
+    EXPECT_EQ(robot->initialize(urdfPath, true), hresult_t::SUCCESS);
+    EXPECT_EQ(robot->addCollisionBodies(collisionBodiesNames), hresult_t::SUCCESS);
+    return robot;
+}
+
+
+TEST(CollisionWorldTest, SweepAndPruneOverlappingPairs)
+{
+    // Several ants close to each other, so that many bounding boxes overlap but not all of them
+    std::vector<std::shared_ptr<Robot> > robots;
+    std::vector<Robot const *> robotsPtr;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        robots.push_back(makeAnt({"torso", "foot_1", "foot_2", "foot_3", "foot_4"}));
+        robotsPtr.push_back(robots.back().get());
+    }
+
+    std::size_t candidatePairsNum = 0U;
+    std::size_t allPairsNum = 0U;
+    for (auto const & [enableSelfCollisions, enableSystemsCollisions] :
+         std::vector<std::pair<bool_t, bool_t> >{{true, true}, {false, true}, {true, false}})
+    {
+        CollisionWorld collisionWorld;
+        ASSERT_EQ(collisionWorld.initialize(robotsPtr, enableSelfCollisions, enableSystemsCollisions),
+                  hresult_t::SUCCESS);
+        ASSERT_FALSE(collisionWorld.getIsEmpty());
+
+        // Successive random configurations, which also move the geometries along the sorting axis
+        for (uint32_t k = 0; k < 20; ++k)
+        {
+            for (std::shared_ptr<Robot> const & robot : robots)
+            {
+                vectorN_t q = pinocchio::neutral(robot->pncModel_);
+                q.head<3>() = vector3_t::Random() * 0.5;
+                q.segment<4>(3) = Eigen::Quaterniond::UnitRandom().coeffs();
+                q.tail(robot->nq() - 7) = vectorN_t::Random(robot->nq() - 7);
+                pinocchio::forwardKinematics(robot->pncModel_, robot->pncData_, q);
+                pinocchio::updateGeometryPlacements(robot->pncModel_, robot->pncData_,
+                                                    robot->collisionModel_, robot->collisionData_);
+            }
+            collisionWorld.computeContacts();
+
+            // Bounding boxes of the geometries, registered in the same order as the collision world
+            std::vector<std::size_t> systemsIdx;
+            std::vector<jointIndex_t> jointsIdx, parentJointsIdx;
+            std::vector<vector3_t> boxesMin, boxesMax;
+            for (std::size_t i = 0; i < robots.size(); ++i)
+            {
+                Robot const & robot = *robots[i];
+                for (std::vector<pairIndex_t> const & collisionPairsIdx : robot.getCollisionPairsIdx())
+                {
+                    for (pairIndex_t const & collisionPairIdx : collisionPairsIdx)
+                    {
+                        geomIndex_t const & geomIdx = robot.collisionModel_.collisionPairs[collisionPairIdx].first;
+                        pinocchio::GeometryObject const & geom = robot.collisionModel_.geometryObjects[geomIdx];
+                        vector3_t const center = robot.collisionData_.oMg[geomIdx].act(geom.geometry->aabb_center);
+                        float64_t const radius = geom.geometry->aabb_radius;
+                        systemsIdx.push_back(i);
+                        jointsIdx.push_back(geom.parentJoint);
+                        parentJointsIdx.push_back(robot.pncModel_.parents[geom.parentJoint]);
+                        boxesMin.push_back(center.array() - radius);
+                        boxesMax.push_back(center.array() + radius);
+                    }
+                }
+            }
+
+            // Check every pair by brute force
+            std::vector<std::pair<std::size_t, std::size_t> > pairsRef;
+            for (std::size_t i = 0; i < boxesMin.size(); ++i)
+            {
+                for (std::size_t j = i + 1; j < boxesMin.size(); ++j)
+                {
+                    bool_t isPairEnabled;
+                    if (systemsIdx[i] != systemsIdx[j])
+                    {
+                        isPairEnabled = enableSystemsCollisions;
+                    }
+                    else
+                    {
+                        isPairEnabled = enableSelfCollisions && jointsIdx[i] != jointsIdx[j]
+                            && parentJointsIdx[i] != jointsIdx[j] && parentJointsIdx[j] != jointsIdx[i];
+                    }
+                    bool_t const isOverlapping = (boxesMin[i].array() <= boxesMax[j].array()).all()
+                                              && (boxesMin[j].array() <= boxesMax[i].array()).all();
+                    if (isPairEnabled && isOverlapping)
+                    {
+                        pairsRef.emplace_back(i, j);
+                    }
+                    ++allPairsNum;
+                }
+            }
+
+            // The candidate pairs must be exactly the overlapping ones, regardless of their order
+            std::vector<std::pair<std::size_t, std::size_t> > pairs;
+            for (auto const & [geomIdx1, geomIdx2] : collisionWorld.getCandidatePairs())
+            {
+                pairs.emplace_back(std::min(geomIdx1, geomIdx2), std::max(geomIdx1, geomIdx2));
+            }
+            std::sort(pairs.begin(), pairs.end());
+            EXPECT_EQ(pairs, pairsRef);
+            candidatePairsNum += pairsRef.size();
+        }
+    }
+
+    // Make sure that the configurations were neither trivially separated nor overlapping
+    EXPECT_GT(candidatePairsNum, 0U);
+    EXPECT_LT(candidatePairsNum, allPairsNum);
+}
+
+TEST(CollisionWorldTest, EqualAndOppositeForces)
+{
+    // Two ants whose torso are overlapping, high above the ground
+    auto engine = std::make_shared<EngineMultiRobot>();
+    std::map<std::string, vectorN_t> qInit, vInit;
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        auto robot = makeAnt({"torso"});
+        std::string const systemName = "ant" + std::to_string(i);
+        ASSERT_EQ(engine->addSystem(systemName, robot,
+            [](float64_t const & /* t */, vectorN_t const & /* q */, vectorN_t const & /* v */)
+            {
+                return true;
+            }), hresult_t::SUCCESS);
+        qInit[systemName] = pinocchio::neutral(robot->pncModel_);
+        qInit[systemName][0] = 0.45 * i;
+        qInit[systemName][2] = 2.0;
+        vInit[systemName] = vectorN_t::Zero(robot->nv());
+    }
+    configHolder_t simuOptions = engine->getDefaultEngineOptions();
+    configHolder_t & contactsOptions = boost::get<configHolder_t>(simuOptions.at("contacts"));
+    boost::get<std::string>(contactsOptions.at("model")) = "spring_damper";
+    boost::get<bool_t>(contactsOptions.at("enableSystemsCollisions")) = true;
+    ASSERT_EQ(engine->setOptions(simuOptions), hresult_t::SUCCESS);
+    ASSERT_EQ(engine->start(qInit, vInit), hresult_t::SUCCESS);
+
+    // Total external force applied on each system, at the origin of the world frame
+    std::vector<pinocchio::Force> forcesTotal;
+    for (std::string const & systemName : engine->getSystemsNames())
+    {
+        systemHolder_t * system;
+        systemState_t const * systemState;
+        ASSERT_EQ(engine->getSystem(systemName, system), hresult_t::SUCCESS);
+        ASSERT_EQ(engine->getSystemState(systemName, systemState), hresult_t::SUCCESS);
+        pinocchio::Force forceTotal = pinocchio::Force::Zero();
+        for (std::size_t i = 1; i < systemState->fExternal.size(); ++i)
+        {
+            forceTotal += system->robot->pncData_.oMi[i].act(systemState->fExternal[i]);
+        }
+        forcesTotal.push_back(forceTotal);
+    }
+
+    // The first ant is pushed backward, and the second one is pushed forward as much
+    EXPECT_LT(forcesTotal[0].linear()[0], 0.0);
+    EXPECT_GT(forcesTotal[1].linear()[0], 0.0);
+    EXPECT_TRUE((forcesTotal[0] + forcesTotal[1]).toVector().isZero(1e-9 * forcesTotal[0].linear().norm()));
+    engine->stop();
+}
@@ -1,15 +1,28 @@
 // Test the sanity of the simulation engine.
 // The tests in this file verify that the behavior of a simulated system matches
-// real-world physics, and that no memory is allocated by Eigen during a simulation.
-// The test system is a double inverted pendulum.
+// real-world physics, that no memory is allocated by Eigen during a simulation, even when
+// linearizing spring-damper contact forces, that evaluating the dynamics of several systems
+// in parallel does not alter the result, that independent systems can be integrated with
+// their own time step, that a simulation can be branched from a saved state, even in
+// contact, that recycling the telemetry between simulations does not alter the log, that
+// the log can be exported, and that streaming it to a file during the simulation does not
+// alter it either.
+// The test system is a double inverted pendulum, unless contacts are involved.
+#include <algorithm>
+#include <filesystem>
+
 #include <gtest/gtest.h>
 
 #define EIGEN_RUNTIME_NO_MALLOC
 
+#include "pinocchio/algorithm/joint-configuration.hpp"
+
 #include "jiminy/core/engine/Engine.h"
 #include "jiminy/core/robot/BasicMotors.h"
+#include "jiminy/core/robot/BasicSensors.h"
 #include "jiminy/core/control/ControllerFunctor.h"
 #include "jiminy/core/utilities/Helpers.h"
+#include "jiminy/core/Constants.h"
 #include "jiminy/core/Types.h"
 
 
@@ -150,3 +163,595 @@ TEST(EngineSanity, EnergyConservation)
 
     // Don't try simulation with Euler integrator, this scheme is not precise enough to keep energy constant.
 }
+
+
+TEST(EngineSanity, SpringDamperContactNoAllocation)
+{
+    // Verify that no memory is allocated when linearizing the spring-damper contact forces
+
+    // Passive quadruped landing on flat ground with its four feet, modelled as springs
+    std::string const robotDirPath = std::string(ROBOTS_DATA_DIR) + "quadrupedal_robots/anymal";
+    auto robot = std::make_shared<Robot>();
+    ASSERT_EQ(robot->initialize(robotDirPath + "/anymal.urdf", true, {robotDirPath}), hresult_t::SUCCESS);
+    std::vector<std::string> const contactFramesNames{"LF_FOOT", "RF_FOOT", "LH_FOOT", "RH_FOOT"};
+    ASSERT_EQ(robot->addContactPoints(contactFramesNames), hresult_t::SUCCESS);
+    auto engine = std::make_shared<Engine>();
+    engine->initialize(robot, callback);
+
+    // Integrate the stiff contact forces implicitly
+    configHolder_t simuOptions = engine->getDefaultEngineOptions();
+    boost::get<std::string>(boost::get<configHolder_t>(simuOptions.at("contacts")).at("model")) = "spring_damper";
+    boost::get<std::string>(boost::get<configHolder_t>(simuOptions.at("stepper")).at("odeSolver")) = "euler_linear_implicit";
+    boost::get<float64_t>(boost::get<configHolder_t>(simuOptions.at("stepper")).at("sensorsUpdatePeriod")) = 1.0e-3;
+    boost::get<float64_t>(boost::get<configHolder_t>(simuOptions.at("stepper")).at("controllerUpdatePeriod")) = 1.0e-3;
+    engine->setOptions(simuOptions);
+
+    // Drop it slightly above the ground, then check that the landing does not allocate memory
+    vectorN_t q0 = pinocchio::neutral(robot->pncModel_);
+    q0[2] = 0.6;
+    vectorN_t v0 = vectorN_t::Zero(robot->nv());
+    engine->reset();
+    ASSERT_EQ(engine->start(q0, v0), hresult_t::SUCCESS);
+    Eigen::internal::set_is_malloc_allowed(false);
+    hresult_t const returnCode = engine->step(1.0);
+    Eigen::internal::set_is_malloc_allowed(true);
+    ASSERT_EQ(returnCode, hresult_t::SUCCESS);
+
+    // Make sure that the contact forces have actually been linearized
+    bool_t isInContact = false;
+    for (pinocchio::Force const & contactForce : robot->contactForces_)
+    {
+        isInContact = isInContact || contactForce.linear().norm() > 0.0;
+    }
+    EXPECT_TRUE(isInContact);
+    engine->stop();
+}
+
+
+TEST(EngineSanity, ParallelSystemsDynamics)
+{
+    // Verify that evaluating the dynamics of the systems in parallel gives the exact same result
+
+    /* Several double pendulums, which are independent but integrated together. Their encoders
+       are noisy, so that their measurements are updated concurrently from their own generator. */
+    std::string const dataDirPath(UNIT_TEST_DATA_DIR);
+    auto const urdfPath = dataDirPath + "/double_pendulum_rigid.urdf";
+    std::vector<std::string> motorJointNames{"PendulumJoint", "SecondPendulumJoint"};
+
+    auto engine = std::make_shared<EngineMultiRobot>();
+    std::map<std::string, vectorN_t> qInit, vInit;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        auto robot = std::make_shared<Robot>();
+        robot->initialize(urdfPath, false);
+        for (std::string const & jointName : motorJointNames)
+        {
+            auto motor = std::make_shared<SimpleMotor>(jointName);
+            robot->attachMotor(motor);
+            motor->initialize(jointName);
+
+            auto sensor = std::make_shared<EncoderSensor>(jointName);
+            robot->attachSensor(sensor);
+            sensor->initialize(jointName);
+            configHolder_t sensorOptions = sensor->getOptions();
+            boost::get<vectorN_t>(sensorOptions.at("noiseStd")) = vectorN_t::Constant(1, 0.1);
+            sensor->setOptions(sensorOptions);
+        }
+
+        auto controller = std::make_shared<
+            ControllerFunctor<decltype(controllerZeroTorque),
+                              decltype(internalDynamics)>
+        >(controllerZeroTorque, internalDynamics);
+        controller->initialize(robot);
+
+        std::string const systemName = "robot" + std::to_string(i);
+        ASSERT_EQ(engine->addSystem(systemName, robot, controller, callback), hresult_t::SUCCESS);
+        qInit[systemName] = vectorN_t::Zero(2);
+        qInit[systemName][0] = 0.5 * (i + 1);
+        vInit[systemName] = vectorN_t::Zero(2);
+    }
+
+    // Run the same simulation serially, then in parallel, with a given or automatic number of threads
+    std::vector<logData_t> logsData;
+    for (uint32_t const & threadsNum : {1U, 0U, 2U})
+    {
+        configHolder_t simuOptions = engine->getDefaultEngineOptions();
+        boost::get<uint32_t>(boost::get<configHolder_t>(simuOptions.at("stepper")).at("threadsNum")) = threadsNum;
+        engine->setOptions(simuOptions);
+        ASSERT_EQ(engine->simulate(2.0, qInit, vInit), hresult_t::SUCCESS);
+        std::shared_ptr<logData_t const> logData;
+        engine->getLog(logData);
+        logsData.push_back(*logData);
+    }
+
+    // The logs must be bit-identical
+    logData_t const & logDataRef = logsData[0];
+    for (std::size_t i = 1; i < logsData.size(); ++i)
+    {
+        logData_t const & logData = logsData[i];
+        EXPECT_EQ(logData.fieldnames, logDataRef.fieldnames);
+        ASSERT_EQ(logData.timestamps.size(), logDataRef.timestamps.size());
+        EXPECT_EQ(logData.timestamps, logDataRef.timestamps);
+        ASSERT_EQ(logData.intData.rows(), logDataRef.intData.rows());
+        ASSERT_EQ(logData.intData.cols(), logDataRef.intData.cols());
+        EXPECT_EQ(logData.intData, logDataRef.intData);
+        ASSERT_EQ(logData.floatData.rows(), logDataRef.floatData.rows());
+        ASSERT_EQ(logData.floatData.cols(), logDataRef.floatData.cols());
+        EXPECT_EQ(logData.floatData, logDataRef.floatData);
+    }
+}
+
+TEST(EngineSanity, MultiRateIntegration)
+{
+    // Verify that independent systems integrated with their own time step match the single-rate integration
+
+    // Two double pendulums, which are independent, with springs of very different stiffness in the joints
+    std::string const dataDirPath(UNIT_TEST_DATA_DIR);
+    auto const urdfPath = dataDirPath + "/double_pendulum_rigid.urdf";
+    std::vector<std::string> motorJointNames{"PendulumJoint", "SecondPendulumJoint"};
+    std::vector<float64_t> const stiffnesses{1.0e4, 1.0};
+
+    auto makeEngine = [&](std::vector<std::size_t> const & systemsIdx)
+        {
+            auto engine = std::make_shared<EngineMultiRobot>();
+            for (std::size_t const & i : systemsIdx)
+            {
+                auto robot = std::make_shared<Robot>();
+                robot->initialize(urdfPath, false);
+                for (std::string const & jointName : motorJointNames)
+                {
+                    auto motor = std::make_shared<SimpleMotor>(jointName);
+                    robot->attachMotor(motor);
+                    motor->initialize(jointName);
+                }
+
+                auto springDynamics = [stiffness = stiffnesses[i]](float64_t        const & /* t */,
+                                                                   vectorN_t        const & q,
+                                                                   vectorN_t        const & /* v */,
+                                                                   sensorsDataMap_t const & /* sensorData */,
+                                                                   vectorN_t              & uCustom)
+                    {
+                        uCustom = - stiffness * q;
+                    };
+                auto controller = std::make_shared<
+                    ControllerFunctor<decltype(controllerZeroTorque),
+                                      decltype(springDynamics)>
+                >(controllerZeroTorque, springDynamics);
+                controller->initialize(robot);
+                engine->addSystem("robot" + std::to_string(i), robot, controller, callback);
+            }
+            return engine;
+        };
+
+    // Integrate up to a sequence of breakpoints, collecting the state of every system at each of them
+    float64_t const dtBreak = 1.0e-2;
+    uint32_t const breakpointsNum = 50U;
+    auto runSimulation = [&](std::shared_ptr<EngineMultiRobot> & engine,
+                             bool_t const & multiRate,
+                             uint32_t const & threadsNum,
+                             std::vector<vectorN_t> & states,
+                             std::shared_ptr<logData_t const> & logData)
+        {
+            configHolder_t simuOptions = engine->getDefaultEngineOptions();
+            configHolder_t & stepperOptions = boost::get<configHolder_t>(simuOptions.at("stepper"));
+            boost::get<float64_t>(stepperOptions.at("tolAbs")) = TOLERANCE * 1.0e-1;
+            boost::get<float64_t>(stepperOptions.at("tolRel")) = TOLERANCE * 1.0e-1;
+            boost::get<float64_t>(stepperOptions.at("sensorsUpdatePeriod")) = dtBreak;
+            boost::get<float64_t>(stepperOptions.at("controllerUpdatePeriod")) = dtBreak;
+            boost::get<bool_t>(stepperOptions.at("logInternalStepperSteps")) = true;
+            boost::get<bool_t>(stepperOptions.at("multiRate")) = multiRate;
+            boost::get<uint32_t>(stepperOptions.at("threadsNum")) = threadsNum;
+            ASSERT_EQ(engine->setOptions(simuOptions), hresult_t::SUCCESS);
+
+            std::map<std::string, vectorN_t> qInit, vInit;
+            for (std::string const & systemName : engine->getSystemsNames())
+            {
+                qInit[systemName] = vectorN_t::Zero(2);
+                qInit[systemName][0] = 0.1;
+                vInit[systemName] = vectorN_t::Zero(2);
+            }
+            engine->reset();
+            ASSERT_EQ(engine->start(qInit, vInit), hresult_t::SUCCESS);
+            states.clear();
+            for (uint32_t k = 0; k < breakpointsNum; ++k)
+            {
+                ASSERT_EQ(engine->step(dtBreak), hresult_t::SUCCESS);
+                for (std::string const & systemName : engine->getSystemsNames())
+                {
+                    systemState_t const * systemState;
+                    engine->getSystemState(systemName, systemState);
+                    states.push_back(systemState->q);
+                    states.push_back(systemState->v);
+                }
+            }
+            engine->stop();
+            engine->getLog(logData);
+        };
+
+    // Reference: both systems integrated at once, then the stiff one alone
+    std::shared_ptr<logData_t const> logData;
+    std::vector<vectorN_t> statesRef, statesStiff, statesMultiRate, statesMultiRateParallel;
+    auto engine = makeEngine({0U, 1U});
+    runSimulation(engine, false, 1U, statesRef, logData);
+    auto engineStiff = makeEngine({0U});
+    runSimulation(engineStiff, false, 1U, statesStiff, logData);
+    uint32_t const iterStiff = engineStiff->getStepperState().iter;
+
+    // The states at the breakpoints must match the single-rate integration, up to the integration tolerance
+    runSimulation(engine, true, 1U, statesMultiRate, logData);
+    uint32_t const iterMultiRate = engine->getStepperState().iter;
+    ASSERT_EQ(statesMultiRate.size(), statesRef.size());
+    for (std::size_t i = 0; i < statesRef.size(); ++i)
+    {
+        EXPECT_LT((statesMultiRate[i] - statesRef[i]).lpNorm<Eigen::Infinity>(), 1.0e-5);
+    }
+
+    /* Each group must keep its own time step: the soft system only requires a few steps on
+       top of the ones of the stiff system, instead of being integrated at the same rate. */
+    EXPECT_GT(iterMultiRate, iterStiff);
+    EXPECT_LT(iterMultiRate - iterStiff, iterStiff / 4U);
+
+    // Only the breakpoints are logged, even if the internal steps are requested
+    vectorN_t const times = getLogVariable(*logData, "Global.Time");
+    ASSERT_EQ(times.size(), static_cast<Eigen::Index>(breakpointsNum + 1U));
+    EXPECT_DOUBLE_EQ(times[times.size() - 1], dtBreak * breakpointsNum);
+
+    // Integrating the groups concurrently must give the exact same result
+    runSimulation(engine, true, 2U, statesMultiRateParallel, logData);
+    EXPECT_EQ(engine->getStepperState().iter, iterMultiRate);
+    EXPECT_EQ(statesMultiRateParallel, statesMultiRate);
+}
+
+TEST(EngineSanity, SaveRestoreState)
+{
+    // Verify that a simulation branched from a saved state is exactly the same as the original one
+
+    // Double pendulum model, with noisy and delayed encoders so that the sensors have a state
+    std::string const dataDirPath(UNIT_TEST_DATA_DIR);
+    auto const urdfPath = dataDirPath + "/double_pendulum_rigid.urdf";
+    std::vector<std::string> motorJointNames{"PendulumJoint", "SecondPendulumJoint"};
+
+    auto robot = std::make_shared<Robot>();
+    robot->initialize(urdfPath, false);
+    for (std::string const & jointName : motorJointNames)
+    {
+        auto motor = std::make_shared<SimpleMotor>(jointName);
+        robot->attachMotor(motor);
+        motor->initialize(jointName);
+
+        auto sensor = std::make_shared<EncoderSensor>(jointName);
+        robot->attachSensor(sensor);
+        sensor->initialize(jointName);
+        configHolder_t sensorOptions = sensor->getOptions();
+        boost::get<vectorN_t>(sensorOptions.at("noiseStd")) = vectorN_t::Constant(1, 0.1);
+        boost::get<float64_t>(sensorOptions.at("delay")) = 5.0e-3;
+        sensor->setOptions(sensorOptions);
+    }
+
+    auto controller = std::make_shared<
+        ControllerFunctor<decltype(controllerZeroTorque),
+                          decltype(internalDynamics)>
+    >(controllerZeroTorque, internalDynamics);
+    controller->initialize(robot);
+
+    auto engine = std::make_shared<Engine>();
+    engine->initialize(robot, controller, callback);
+    configHolder_t simuOptions = engine->getDefaultEngineOptions();
+    boost::get<float64_t>(boost::get<configHolder_t>(simuOptions.at("stepper")).at("sensorsUpdatePeriod")) = 1.0e-3;
+    boost::get<float64_t>(boost::get<configHolder_t>(simuOptions.at("stepper")).at("controllerUpdatePeriod")) = 1.0e-3;
+    engine->setOptions(simuOptions);
+
+    // Save the state in the middle of a simulation
+    vectorN_t q0 = vectorN_t::Zero(2);
+    q0(0) = 1.0;
+    vectorN_t v0 = vectorN_t::Zero(2);
+    engine->reset();
+    ASSERT_EQ(engine->start(q0, v0), hresult_t::SUCCESS);
+    ASSERT_EQ(engine->step(0.5), hresult_t::SUCCESS);
+    std::vector<uint8_t> state;
+    ASSERT_EQ(engine->saveState(state), hresult_t::SUCCESS);
+
+    // Keep going, then branch from the saved state several times
+    auto getSnapshot = [&engine, &robot]()
+        {
+            systemState_t const * systemState;
+            engine->getSystemState(systemState);
+            return std::make_tuple(engine->getStepperState().t,
+                                   systemState->q,
+                                   systemState->v,
+                                   matrixN_t(robot->getSensorsData().at(EncoderSensor::type_).getAll()));
+        };
+    ASSERT_EQ(engine->step(0.5), hresult_t::SUCCESS);
+    auto const snapshotRef = getSnapshot();
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(engine->restoreState(state), hresult_t::SUCCESS);
+        ASSERT_DOUBLE_EQ(engine->getStepperState().t, 0.5);
+        ASSERT_EQ(engine->step(0.5), hresult_t::SUCCESS);
+        auto const snapshot = getSnapshot();
+        EXPECT_EQ(std::get<0>(snapshot), std::get<0>(snapshotRef));
+        EXPECT_EQ(std::get<1>(snapshot), std::get<1>(snapshotRef));
+        EXPECT_EQ(std::get<2>(snapshot), std::get<2>(snapshotRef));
+        EXPECT_EQ(std::get<3>(snapshot), std::get<3>(snapshotRef));
+    }
+
+    // A truncated state is rejected, without altering the simulation
+    std::vector<uint8_t> const stateTruncated(state.begin(), state.end() - 1);
+    EXPECT_EQ(engine->restoreState(stateTruncated), hresult_t::ERROR_BAD_INPUT);
+    EXPECT_EQ(getSnapshot(), snapshotRef);
+    engine->stop();
+
+    // It is only possible to save or restore the state of a running simulation
+    EXPECT_NE(engine->saveState(state), hresult_t::SUCCESS);
+    EXPECT_NE(engine->restoreState(state), hresult_t::SUCCESS);
+}
+
+
+TEST(EngineSanity, SaveRestoreStateWithContacts)
+{
+    // Verify that branching a simulation is deterministic for every constraint solver in contact
+
+    // Passive quadruped landing on flat ground with its four feet, modelled as constraints
+    std::string const robotDirPath = std::string(ROBOTS_DATA_DIR) + "quadrupedal_robots/anymal";
+    auto robot = std::make_shared<Robot>();
+    ASSERT_EQ(robot->initialize(robotDirPath + "/anymal.urdf", true, {robotDirPath}), hresult_t::SUCCESS);
+    std::vector<std::string> const contactFramesNames{"LF_FOOT", "RF_FOOT", "LH_FOOT", "RH_FOOT"};
+    ASSERT_EQ(robot->addContactPoints(contactFramesNames), hresult_t::SUCCESS);
+    auto engine = std::make_shared<Engine>();
+    engine->initialize(robot, callback);
+
+    // Drop it with some velocity, so that the feet do not all touch the ground at once
+    vectorN_t q0 = pinocchio::neutral(robot->pncModel_);
+    q0[2] = 0.6;
+    vectorN_t v0 = vectorN_t::Zero(robot->nv());
+    v0[0] = 0.5;
+    v0[3] = 1.0;
+
+    for (std::string const & solver : {"PGS", "BlockPGS", "ADMM"})
+    {
+        configHolder_t simuOptions = engine->getDefaultEngineOptions();
+        boost::get<configHolder_t>(simuOptions.at("constraints")).at("solver") = solver;
+        boost::get<std::string>(boost::get<configHolder_t>(simuOptions.at("contacts")).at("model")) = "constraint";
+        engine->setOptions(simuOptions);
+
+        // Save the state once the robot is in contact with the ground
+        engine->reset();
+        ASSERT_EQ(engine->start(q0, v0), hresult_t::SUCCESS);
+        ASSERT_EQ(engine->step(0.5), hresult_t::SUCCESS);
+        std::vector<uint8_t> state;
+        ASSERT_EQ(engine->saveState(state), hresult_t::SUCCESS);
+
+        // Keep going, then branch from the saved state several times
+        auto getSnapshot = [&engine, &robot]()
+            {
+                systemState_t const * systemState;
+                engine->getSystemState(systemState);
+                return std::make_tuple(engine->getStepperState().t,
+                                       systemState->q,
+                                       systemState->v,
+                                       robot->contactForces_);
+            };
+        ASSERT_EQ(engine->step(0.5), hresult_t::SUCCESS);
+        auto const snapshotRef = getSnapshot();
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            ASSERT_EQ(engine->restoreState(state), hresult_t::SUCCESS);
+            ASSERT_EQ(engine->step(0.5), hresult_t::SUCCESS);
+            auto const snapshot = getSnapshot();
+            EXPECT_EQ(std::get<0>(snapshot), std::get<0>(snapshotRef)) << solver;
+            EXPECT_EQ(std::get<1>(snapshot), std::get<1>(snapshotRef)) << solver;
+            EXPECT_EQ(std::get<2>(snapshot), std::get<2>(snapshotRef)) << solver;
+            for (std::size_t j = 0; j < std::get<3>(snapshotRef).size(); ++j)
+            {
+                EXPECT_EQ(std::get<3>(snapshot)[j].toVector(), std::get<3>(snapshotRef)[j].toVector()) << solver;
+            }
+        }
+        engine->stop();
+    }
+}
+
+TEST(EngineSanity, TelemetryRecycling)
+{
+    // Verify that recycling the telemetry of the previous simulation does not alter the log
+
+    // Double pendulum model, with noiseless encoders so that successive episodes are identical
+    std::string const dataDirPath(UNIT_TEST_DATA_DIR);
+    auto const urdfPath = dataDirPath + "/double_pendulum_rigid.urdf";
+    std::vector<std::string> motorJointNames{"PendulumJoint", "SecondPendulumJoint"};
+
+    auto robot = std::make_shared<Robot>();
+    robot->initialize(urdfPath, false);
+    for (std::string const & jointName : motorJointNames)
+    {
+        auto motor = std::make_shared<SimpleMotor>(jointName);
+        robot->attachMotor(motor);
+        motor->initialize(jointName);
+
+        auto sensor = std::make_shared<EncoderSensor>(jointName);
+        robot->attachSensor(sensor);
+        sensor->initialize(jointName);
+    }
+
+    auto controller = std::make_shared<
+        ControllerFunctor<decltype(controllerZeroTorque),
+                          decltype(internalDynamics)>
+    >(controllerZeroTorque, internalDynamics);
+    controller->initialize(robot);
+
+    auto engine = std::make_shared<Engine>();
+    engine->initialize(robot, controller, callback);
+    configHolder_t simuOptions = engine->getDefaultEngineOptions();
+    boost::get<float64_t>(boost::get<configHolder_t>(simuOptions.at("stepper")).at("sensorsUpdatePeriod")) = 1.0e-3;
+    boost::get<float64_t>(boost::get<configHolder_t>(simuOptions.at("stepper")).at("controllerUpdatePeriod")) = 1.0e-3;
+    engine->setOptions(simuOptions);
+
+    vectorN_t q0 = vectorN_t::Zero(2);
+    q0(0) = 1.0;
+    vectorN_t v0 = vectorN_t::Zero(2);
+    auto runEpisode = [&engine, &q0, &v0]()
+        {
+            EXPECT_EQ(engine->simulate(0.5, q0, v0), hresult_t::SUCCESS);
+            std::shared_ptr<logData_t const> logData;
+            engine->getLog(logData);
+            return *logData;
+        };
+
+    // Two identical episodes, the second one recycling the telemetry of the first one
+    logData_t const logDataRef = runEpisode();
+    logData_t const logData = runEpisode();
+    EXPECT_EQ(logData.version, logDataRef.version);
+    EXPECT_EQ(logData.timeUnit, logDataRef.timeUnit);
+    EXPECT_EQ(logData.constants, logDataRef.constants);
+    EXPECT_EQ(logData.fieldnames, logDataRef.fieldnames);
+    ASSERT_EQ(logData.timestamps.size(), logDataRef.timestamps.size());
+    EXPECT_EQ(logData.timestamps, logDataRef.timestamps);
+    ASSERT_EQ(logData.intData.rows(), logDataRef.intData.rows());
+    ASSERT_EQ(logData.intData.cols(), logDataRef.intData.cols());
+    EXPECT_EQ(logData.intData, logDataRef.intData);
+    ASSERT_EQ(logData.floatData.rows(), logDataRef.floatData.rows());
+    ASSERT_EQ(logData.floatData.cols(), logDataRef.floatData.cols());
+    EXPECT_EQ(logData.floatData, logDataRef.floatData);
+
+    // Changing the logged variables rebuilds the header
+    std::string const energyFieldname = "HighLevelController.energy";
+    ASSERT_NE(std::find(logDataRef.fieldnames.begin(), logDataRef.fieldnames.end(), energyFieldname),
+              logDataRef.fieldnames.end());
+    boost::get<bool_t>(boost::get<configHolder_t>(simuOptions.at("telemetry")).at("enableEnergy")) = false;
+    engine->setOptions(simuOptions);
+    logData_t const logDataChanged = runEpisode();
+    EXPECT_EQ(logDataChanged.fieldnames.size(), logDataRef.fieldnames.size() - 1U);
+    EXPECT_EQ(std::find(logDataChanged.fieldnames.begin(), logDataChanged.fieldnames.end(), energyFieldname),
+              logDataChanged.fieldnames.end());
+    EXPECT_NE(logDataChanged.constants, logDataRef.constants);
+    EXPECT_EQ(logDataChanged.timestamps, logDataRef.timestamps);
+}
+
+TEST(EngineSanity, WriteLogHdf5)
+{
+    // Verify that the log is exported exactly, whatever the compression and the size of the chunks
+
+    // Double pendulum model
+    std::string const dataDirPath(UNIT_TEST_DATA_DIR);
+    auto const urdfPath = dataDirPath + "/double_pendulum_rigid.urdf";
+    auto robot = std::make_shared<Robot>();
+    robot->initialize(urdfPath, false);
+    auto motor = std::make_shared<SimpleMotor>("PendulumJoint");
+    robot->attachMotor(motor);
+    motor->initialize("PendulumJoint");
+
+    auto controller = std::make_shared<
+        ControllerFunctor<decltype(controllerZeroTorque),
+                          decltype(internalDynamics)>
+    >(controllerZeroTorque, internalDynamics);
+    controller->initialize(robot);
+
+    auto engine = std::make_shared<Engine>();
+    engine->initialize(robot, controller, callback);
+
+    // Run a simulation
+    vectorN_t q0 = vectorN_t::Zero(2);
+    q0(0) = 1.0;
+    vectorN_t v0 = vectorN_t::Zero(2);
+    ASSERT_EQ(engine->simulate(1.0, q0, v0), hresult_t::SUCCESS);
+    std::shared_ptr<logData_t const> logData;
+    ASSERT_EQ(engine->getLog(logData), hresult_t::SUCCESS);
+
+    // The last chunk is partial, since the number of samples is not a multiple of the chunk size
+    std::string const logPath = (std::filesystem::temp_directory_path() / "log_sanity.hdf5").string();
+    for (std::string const & compression : {"gzip", "none"})
+    {
+        for (uint32_t const chunkSize : {7U, 65536U})
+        {
+            configHolder_t engineOptions = engine->getOptions();
+            configHolder_t & telemetryOptions = boost::get<configHolder_t>(engineOptions.at("telemetry"));
+            boost::get<std::string>(telemetryOptions.at("compression")) = compression;
+            boost::get<uint32_t>(telemetryOptions.at("chunkSize")) = chunkSize;
+            ASSERT_EQ(engine->setOptions(engineOptions), hresult_t::SUCCESS);
+
+            ASSERT_EQ(engine->writeLog(logPath, "hdf5"), hresult_t::SUCCESS);
+            logData_t logDataRead;
+            ASSERT_EQ(EngineMultiRobot::readLog(logPath, "hdf5", logDataRead), hresult_t::SUCCESS);
+            EXPECT_EQ(logDataRead.fieldnames, logData->fieldnames);
+            EXPECT_EQ(logDataRead.timestamps, logData->timestamps);
+            EXPECT_EQ(logDataRead.intData, logData->intData);
+            EXPECT_EQ(logDataRead.floatData, logData->floatData);
+        }
+    }
+    std::filesystem::remove(logPath);
+
+    // Unsupported compressions are rejected
+    configHolder_t engineOptions = engine->getOptions();
+    configHolder_t & telemetryOptions = boost::get<configHolder_t>(engineOptions.at("telemetry"));
+    boost::get<std::string>(telemetryOptions.at("compression")) = "lz4";
+    EXPECT_EQ(engine->setOptions(engineOptions), hresult_t::ERROR_BAD_INPUT);
+}
+
+TEST(EngineSanity, StreamingLog)
+{
+    // Verify that streaming the log to a file during the simulation does not alter it
+
+    // Double pendulum model
+    std::string const dataDirPath(UNIT_TEST_DATA_DIR);
+    auto const urdfPath = dataDirPath + "/double_pendulum_rigid.urdf";
+    auto robot = std::make_shared<Robot>();
+    robot->initialize(urdfPath, false);
+    auto motor = std::make_shared<SimpleMotor>("PendulumJoint");
+    robot->attachMotor(motor);
+    motor->initialize("PendulumJoint");
+
+    auto controller = std::make_shared<
+        ControllerFunctor<decltype(controllerZeroTorque),
+                          decltype(internalDynamics)>
+    >(controllerZeroTorque, internalDynamics);
+    controller->initialize(robot);
+
+    auto engine = std::make_shared<Engine>();
+    engine->initialize(robot, controller, callback);
+
+    // Log a fixed number of breakpoints, so that the log spans several chunks
+    configHolder_t engineOptions = engine->getOptions();
+    configHolder_t & stepperOptions = boost::get<configHolder_t>(engineOptions.at("stepper"));
+    boost::get<float64_t>(stepperOptions.at("sensorsUpdatePeriod")) = 1.0e-3;
+    boost::get<float64_t>(stepperOptions.at("controllerUpdatePeriod")) = 1.0e-3;
+    ASSERT_EQ(engine->setOptions(engineOptions), hresult_t::SUCCESS);
+
+    // Run a simulation keeping the log in memory
+    vectorN_t q0 = vectorN_t::Zero(2);
+    q0(0) = 1.0;
+    vectorN_t v0 = vectorN_t::Zero(2);
+    ASSERT_EQ(engine->simulate(10.0, q0, v0), hresult_t::SUCCESS);
+    std::shared_ptr<logData_t const> logDataPtr;
+    ASSERT_EQ(engine->getLog(logDataPtr), hresult_t::SUCCESS);
+    logData_t const logDataRef = *logDataPtr;
+
+    /* Make sure that more chunks than in flight are required, and that the last one is
+       partially filled. The lines of data are made of the time, the integers and the floats. */
+    int64_t const lineSize = sizeof(int64_t) * (1 + logDataRef.intData.rows() + logDataRef.floatData.rows());
+    Eigen::Index const chunkLinesMax = std::max(TELEMETRY_MIN_BUFFER_SIZE / lineSize, int64_t(1));
+    ASSERT_GT(logDataRef.timestamps.size(), 2 * chunkLinesMax);
+    ASSERT_NE(logDataRef.timestamps.size() % chunkLinesMax, 0);
+
+    // Run the same simulation streaming the log to a file, with as few chunks as possible
+    std::string const streamingPath = (std::filesystem::temp_directory_path() / "log_streaming.data").string();
+    std::string const logPath = (std::filesystem::temp_directory_path() / "log_streaming_copy.data").string();
+    configHolder_t & telemetryOptions = boost::get<configHolder_t>(engineOptions.at("telemetry"));
+    boost::get<std::string>(telemetryOptions.at("streamingPath")) = streamingPath;
+    boost::get<uint32_t>(telemetryOptions.at("maxInFlightChunks")) = 2U;
+    ASSERT_EQ(engine->setOptions(engineOptions), hresult_t::SUCCESS);
+    ASSERT_EQ(engine->simulate(10.0, q0, v0), hresult_t::SUCCESS);
+
+    // The log read back from the streamed file, or from a copy of it, must be identical
+    logData_t logDataCopy;
+    ASSERT_EQ(engine->getLog(logDataPtr), hresult_t::SUCCESS);
+    ASSERT_EQ(engine->writeLog(logPath, "binary"), hresult_t::SUCCESS);
+    ASSERT_EQ(EngineMultiRobot::readLog(logPath, "binary", logDataCopy), hresult_t::SUCCESS);
+    for (logData_t const * logData : {logDataPtr.get(), &logDataCopy})
+    {
+        EXPECT_EQ(logData->fieldnames, logDataRef.fieldnames);
+        EXPECT_EQ(logData->timestamps, logDataRef.timestamps);
+        EXPECT_EQ(logData->intData, logDataRef.intData);
+        EXPECT_EQ(logData->floatData, logDataRef.floatData);
+    }
+    std::filesystem::remove(streamingPath);
+    std::filesystem::remove(logPath);
+}
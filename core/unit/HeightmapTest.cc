@@ -0,0 +1,169 @@
+// Test the heightmaps sampled on a regular grid.
+// The tests in this file verify that the interpolation of the height reproduces exactly the
+// functions it is supposed to, that the normal is consistent with the interpolated height,
+// and that the height of the border is extended outside the grid.
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "jiminy/core/utilities/GridHeightmap.h"
+#include "jiminy/core/Types.h"
+
+
+using namespace jiminy;
+
+float64_t const TOLERANCE = 1e-9;
+
+
+// Heights of a given function on a grid of 21 x 31 points
+template<typename F>
+GridHeightmap makeGridHeightmap(F const & fct,
+                                heightmapInterpolation_t const & interpolation)
+{
+    vector2_t const origin(-1.0, -2.0);
+    float64_t const resolution = 0.1;
+    matrixN_t heights(21, 31);
+    for (Eigen::Index i = 0; i < heights.rows(); ++i)
+    {
+        for (Eigen::Index j = 0; j < heights.cols(); ++j)
+        {
+            heights(i, j) = fct(origin[0] + i * resolution, origin[1] + j * resolution);
+        }
+    }
+    return {heights, origin, resolution, interpolation};
+}
+
+// Normal of the ground given the gradient of its height
+vector3_t normalFromGradient(float64_t const & dzdx,
+                             float64_t const & dzdy)
+{
+    return vector3_t(- dzdx, - dzdy, 1.0).normalized();
+}
+
+
+TEST(HeightmapTest, BilinearInterpolation)
+{
+    // The bilinear interpolation is exact for bilinear functions, as well as its gradient
+    auto const fct = [](float64_t const & x, float64_t const & y) { return 0.3 + 0.5 * x - 0.2 * y + 0.7 * x * y; };
+    GridHeightmap const heightmap = makeGridHeightmap(fct, heightmapInterpolation_t::BILINEAR);
+    for (uint32_t k = 0; k < 100; ++k)
+    {
+        // Random position inside the grid, but not on its border
+        vector3_t pos = vector3_t::Random();
+        pos[0] *= 0.95;
+        pos[1] = - 0.5 + 1.45 * pos[1];
+        auto const [height, normal] = heightmap(pos);
+        EXPECT_NEAR(height, fct(pos[0], pos[1]), TOLERANCE);
+        EXPECT_TRUE(normal.isApprox(normalFromGradient(0.5 + 0.7 * pos[1], - 0.2 + 0.7 * pos[0]), TOLERANCE));
+    }
+}
+
+TEST(HeightmapTest, BicubicInterpolation)
+{
+    // The bicubic interpolation is exact for quadratic functions, as well as its gradient
+    auto const fct = [](float64_t const & x, float64_t const & y)
+        {
+            return 0.3 + 0.5 * x - 0.2 * y + 0.7 * x * y - 0.4 * x * x + 0.6 * y * y;
+        };
+    GridHeightmap const heightmap = makeGridHeightmap(fct, heightmapInterpolation_t::BICUBIC);
+    for (uint32_t k = 0; k < 100; ++k)
+    {
+        // Random position far enough from the border for the neighbouring samples to be inside the grid
+        vector3_t pos = vector3_t::Random();
+        pos[0] *= 0.85;
+        pos[1] = - 0.5 + 1.35 * pos[1];
+        auto const [height, normal] = heightmap(pos);
+        EXPECT_NEAR(height, fct(pos[0], pos[1]), TOLERANCE);
+        EXPECT_TRUE(normal.isApprox(normalFromGradient(
+            0.5 + 0.7 * pos[1] - 0.8 * pos[0], - 0.2 + 0.7 * pos[0] + 1.2 * pos[1]), TOLERANCE));
+    }
+}
+
+TEST(HeightmapTest, NormalConsistency)
+{
+    /* Whatever the function, the interpolated height goes through the samples, and the normal is
+       the one of the interpolated height, which is checked by finite differences. */
+    auto const fct = [](float64_t const & x, float64_t const & y) { return std::sin(3.0 * x) * std::cos(2.0 * y); };
+    for (heightmapInterpolation_t const & interpolation :
+         {heightmapInterpolation_t::BILINEAR, heightmapInterpolation_t::BICUBIC})
+    {
+        GridHeightmap const heightmap = makeGridHeightmap(fct, interpolation);
+
+        // Samples of the grid
+        for (Eigen::Index i = 0; i < 21; i += 4)
+        {
+            for (Eigen::Index j = 0; j < 31; j += 5)
+            {
+                vector3_t const pos(-1.0 + i * 0.1, -2.0 + j * 0.1, 0.0);
+                EXPECT_NEAR(heightmap(pos).first, heightmap.getHeights()(i, j), TOLERANCE);
+            }
+        }
+
+        // Random positions inside the grid, away from the edges of the cells
+        float64_t const eps = 1e-6;
+        for (uint32_t k = 0; k < 100; ++k)
+        {
+            vector3_t pos = vector3_t::Random();
+            pos[0] = 0.1 * (std::floor(9.0 * pos[0]) + 0.5 + 0.4 * pos[2]);
+            pos[1] = 0.1 * (std::floor(14.0 * pos[1]) - 4.5 + 0.4 * pos[2]);
+            float64_t const dzdx = (heightmap(pos + eps * vector3_t::UnitX()).first
+                                  - heightmap(pos - eps * vector3_t::UnitX()).first) / (2.0 * eps);
+            float64_t const dzdy = (heightmap(pos + eps * vector3_t::UnitY()).first
+                                  - heightmap(pos - eps * vector3_t::UnitY()).first) / (2.0 * eps);
+            EXPECT_TRUE(heightmap(pos).second.isApprox(normalFromGradient(dzdx, dzdy), 1e-6));
+        }
+
+        // Evaluating several positions at once gives the same result
+        matrix3N_t const positions = matrix3N_t::Random(3, 10);
+        vectorN_t heights(10);
+        matrix3N_t normals(3, 10);
+        heightmap(positions, heights, normals);
+        for (Eigen::Index i = 0; i < positions.cols(); ++i)
+        {
+            auto const [height, normal] = heightmap(positions.col(i));
+            EXPECT_EQ(heights[i], height);
+            EXPECT_EQ(normals.col(i), normal);
+        }
+    }
+}
+
+TEST(HeightmapTest, ClampingOutsideGrid)
+{
+    // Outside the grid, the height of the closest border is used, and the slope is zero across it
+    auto const fct = [](float64_t const & x, float64_t const & y) { return std::sin(3.0 * x) * std::cos(2.0 * y); };
+    for (heightmapInterpolation_t const & interpolation :
+         {heightmapInterpolation_t::BILINEAR, heightmapInterpolation_t::BICUBIC})
+    {
+        GridHeightmap const heightmap = makeGridHeightmap(fct, interpolation);
+
+        // Beyond a side, the height and the slope along it are the ones of the border
+        for (float64_t const & y : {-1.73, 0.21, 0.88})
+        {
+            auto const [heightBorder, normalBorder] = heightmap(vector3_t(1.0, y, 0.0));
+            auto const [height, normal] = heightmap(vector3_t(1.5, y, 0.0));
+            EXPECT_NEAR(height, heightBorder, TOLERANCE);
+            EXPECT_NEAR(normal[0], 0.0, TOLERANCE);
+            EXPECT_NEAR(normal[1] / normal[2], normalBorder[1] / normalBorder[2], TOLERANCE);
+
+            auto const [heightBorderMin, normalBorderMin] = heightmap(vector3_t(-1.0, y, 0.0));
+            auto const [heightMin, normalMin] = heightmap(vector3_t(-3.0, y, 0.0));
+            EXPECT_NEAR(heightMin, heightBorderMin, TOLERANCE);
+            EXPECT_NEAR(normalMin[0], 0.0, TOLERANCE);
+            EXPECT_NEAR(normalMin[1] / normalMin[2], normalBorderMin[1] / normalBorderMin[2], TOLERANCE);
+        }
+
+        // Beyond a corner, the ground is flat at the height of the corner
+        matrixN_t const & heights = heightmap.getHeights();
+        std::vector<std::pair<vector3_t, float64_t> > const corners{
+            {vector3_t(-2.0, -3.0, 0.0), heights(0, 0)},
+            {vector3_t(2.0, -3.0, 0.0), heights(20, 0)},
+            {vector3_t(-2.0, 2.0, 0.0), heights(0, 30)},
+            {vector3_t(2.0, 2.0, 0.0), heights(20, 30)}};
+        for (auto const & [pos, heightCorner] : corners)
+        {
+            auto const [height, normal] = heightmap(pos);
+            EXPECT_NEAR(height, heightCorner, TOLERANCE);
+            EXPECT_TRUE(normal.isApprox(vector3_t::UnitZ(), TOLERANCE));
+        }
+    }
+}
@@ -4,9 +4,11 @@
 #include "jiminy/core/utilities/Helpers.h"
 #include "jiminy/core/Types.h"
 
+#include "pinocchio/algorithm/center-of-mass.hpp"
 #include "pinocchio/algorithm/frames.hpp"
 #include "pinocchio/algorithm/geometry.hpp"
 #include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/parsers/urdf.hpp"
 
 using namespace jiminy;
 
@@ -85,6 +87,36 @@ TEST_P(ModelTestFixture, CreateFlexible)
     }
 }
 
+TEST(ModelTest, ResetWithoutChange)
+{
+    // Load a humanoid, without collision nor visual meshes since they are irrelevant here
+    std::string const urdfPath = std::string(ROBOTS_DATA_DIR) + "bipedal_robots/atlas/atlas_v4.urdf";
+    pinocchio::Model pncModel;
+    pinocchio::urdf::buildModel(urdfPath, pinocchio::JointModelFreeFlyer(), pncModel);
+    auto model = std::make_shared<Model>();
+    ASSERT_EQ(model->initialize(pncModel, pinocchio::GeometryModel(), pinocchio::GeometryModel()),
+              hresult_t::SUCCESS);
+
+    // Randomize the mass of the bodies, to make sure that the biases are drawn at every reset
+    configHolder_t options = model->getOptions();
+    boost::get<float64_t>(boost::get<configHolder_t>(options.at("dynamics")).at("massBodiesBiasStd")) = 0.1;
+    model->setOptions(options);
+
+    // Reset without any change of the model, which must neither re-allocate the data nor rebuild the model
+    pinocchio::SE3 const * const oMiPtr = model->pncData_.oMi.data();
+    float64_t const massPrev = model->pncModel_.inertias.back().mass();
+    model->reset();
+    EXPECT_EQ(model->pncData_.oMi.data(), oMiPtr);
+    EXPECT_NE(model->pncModel_.inertias.back().mass(), massPrev);
+    EXPECT_NEAR(model->pncData_.mass[0], pinocchio::computeTotalMass(model->pncModel_), 1e-9);
+
+    /* Reset after modifying the original model, which must trigger a full regeneration.
+       The gravity is only copied when the model is regenerated, unlike the inertias. */
+    model->pncModelOrig_.gravity.linear() *= 2.0;
+    model->reset();
+    EXPECT_TRUE(model->pncModel_.gravity.isApprox(model->pncModelOrig_.gravity));
+}
+
 INSTANTIATE_TEST_SUITE_P(ModelTests,
                          ModelTestFixture,
                          testing::Values(true, false));
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include "pinocchio/parsers/urdf.hpp"
+#include "pinocchio/algorithm/kinematics.hpp"
+#include "pinocchio/algorithm/crba.hpp"
+#include "pinocchio/algorithm/jacobian.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+
+#include "jiminy/core/robot/PinocchioOverloadAlgorithms.h"
+#include "jiminy/core/robot/DynamicsBackend.h"
+#include "jiminy/core/robot/Model.h"
+#include "jiminy/core/constraints/JointConstraint.h"
+#include "jiminy/core/Types.h"
+
+using namespace jiminy;
+
+
+class PinocchioOverloadTestFixture :
+    public testing::TestWithParam<std::string> {
+};
+
+
+TEST_P(PinocchioOverloadTestFixture, ComputeGeneralizedForces)
+{
+    // Load the model of the robot
+    std::string const urdfPath = std::string(ROBOTS_DATA_DIR) + GetParam();
+    pinocchio::Model model;
+    pinocchio::urdf::buildModel(urdfPath, pinocchio::JointModelFreeFlyer(), model);
+    pinocchio::Data data(model);
+
+    // Update the kinematics for a random configuration
+    vectorN_t q = pinocchio::randomConfiguration(
+        model, -vectorN_t::Ones(model.nq), vectorN_t::Ones(model.nq));
+    pinocchio::forwardKinematics(model, data, q);
+    pinocchio::computeJointJacobians(model, data);
+
+    // Generate random external forces applied on every joints
+    forceVector_t fext(static_cast<std::size_t>(model.njoints), pinocchio::Force::Zero());
+    for (int32_t i = 1; i < model.njoints; ++i)
+    {
+        fext[i] = pinocchio::Force::Random();
+    }
+
+    // Reference implementation, projecting the forces one joint at a time
+    auto projectJacobian = [&model, &data, &fext](vectorN_t & tau)
+    {
+        matrix6N_t jointJacobian = matrix6N_t::Zero(6, model.nv);
+        tau.setZero();
+        for (int32_t i = 1; i < model.njoints; ++i)
+        {
+            jointJacobian.setZero();
+            pinocchio::getJointJacobian(model, data, i, pinocchio::LOCAL, jointJacobian);
+            tau.noalias() += jointJacobian.transpose() * fext[i].toVector();
+        }
+    };
+    auto projectBackwardPass = [&model, &data, &fext](vectorN_t & tau)
+    {
+        tau.setZero();
+        pinocchio_overload::computeGeneralizedForces(model, data, fext, tau);
+    };
+
+    // Make sure that both implementations are consistent
+    vectorN_t tauRef(model.nv), tau(model.nv);
+    projectJacobian(tauRef);
+    projectBackwardPass(tau);
+    ASSERT_TRUE(tau.isApprox(tauRef, 1e-9));
+}
+
+INSTANTIATE_TEST_SUITE_P(PinocchioOverloadTests, PinocchioOverloadTestFixture,
+                         testing::Values("bipedal_robots/atlas/atlas_v4.urdf",
+                                         "bipedal_robots/cassie/cassie.urdf"));
+
+
+TEST(PinocchioOverloadTest, ComputeJMinvJtSparse)
+{
+    // Load a humanoid, without collision nor visual meshes since they are irrelevant here
+    std::string const urdfPath = std::string(ROBOTS_DATA_DIR) + "bipedal_robots/atlas/atlas_v4.urdf";
+    pinocchio::Model pncModel;
+    pinocchio::urdf::buildModel(urdfPath, pinocchio::JointModelFreeFlyer(), pncModel);
+    auto model = std::make_shared<Model>();
+    ASSERT_EQ(model->initialize(pncModel, pinocchio::GeometryModel(), pinocchio::GeometryModel()),
+              hresult_t::SUCCESS);
+
+    // Constrain joints deep in the kinematic tree, on different limbs
+    std::vector<std::shared_ptr<AbstractConstraintBase> > constraints;
+    for (std::string const & jointName : std::vector<std::string>{"l_leg_akx", "r_arm_wry"})
+    {
+        auto constraint = std::make_shared<JointConstraint>(jointName);
+        ASSERT_EQ(model->addConstraint(jointName + "_locked", constraint), hresult_t::SUCCESS);
+        constraints.push_back(constraint);
+    }
+    pinocchio::Model const & modelRef = model->pncModel_;
+    vectorN_t const q = pinocchio::randomConfiguration(
+        modelRef, -vectorN_t::Ones(modelRef.nq), vectorN_t::Ones(modelRef.nq));
+    ASSERT_EQ(model->resetConstraints(q, vectorN_t::Zero(modelRef.nv)), hresult_t::SUCCESS);
+
+    // Stack the jacobians of the constraints, along with their column support
+    Eigen::Index nRows = 0;
+    for (auto const & constraint : constraints)
+    {
+        nRows += constraint->getJacobian().rows();
+    }
+    matrixN_t J(nRows, modelRef.nv);
+    std::vector<std::vector<Eigen::Index> > colsIdx(constraints.size());
+    std::vector<pinocchio_overload::JacobianBlock> blocks;
+    Eigen::Index startRow = 0;
+    for (std::size_t i = 0; i < constraints.size(); ++i)
+    {
+        matrixN_t const & jacobian = constraints[i]->getJacobian();
+        J.middleRows(startRow, jacobian.rows()) = jacobian;
+        for (auto const & slice : constraints[i]->getJacobianSupport())
+        {
+            for (Eigen::Index k = slice.first; k < slice.first + slice.second; ++k)
+            {
+                colsIdx[i].push_back(k);
+            }
+        }
+        blocks.push_back({startRow, jacobian.rows(), &colsIdx[i]});
+        startRow += jacobian.rows();
+    }
+
+    // Make sure that the sparse computation is consistent with the dense one J * M^-1 * J.T
+    pinocchio::Data data(modelRef);
+    pinocchio::crba(modelRef, data, q);
+    data.M.triangularView<Eigen::StrictlyLower>() = data.M.transpose().triangularView<Eigen::StrictlyLower>();
+    matrixN_t const JMinvJtRef = J * data.M.ldlt().solve(J.transpose());
+    ASSERT_EQ(pinocchio_overload::computeJMinvJt(modelRef, data, J, blocks), hresult_t::SUCCESS);
+    matrixN_t const JMinvJt = data.JMinvJt.triangularView<Eigen::Lower>();
+    ASSERT_TRUE(JMinvJt.isApprox(matrixN_t(JMinvJtRef.triangularView<Eigen::Lower>()), 1e-9));
+}
+
+TEST(PinocchioOverloadTest, DynamicsBackend)
+{
+    // Load the model of the robot for which a backend has been generated
+    std::string const urdfPath = std::string(ROBOTS_DATA_DIR) + "bipedal_robots/atlas/atlas_v4.urdf";
+    pinocchio::Model model;
+    pinocchio::urdf::buildModel(urdfPath, pinocchio::JointModelFreeFlyer(), model);
+    model.rotorInertia = vectorN_t::Random(model.nv).cwiseAbs();
+    pinocchio::Data data(model), dataRef(model);
+
+    // The backend must be registered automatically, and only compatible with the same topology
+    std::shared_ptr<AbstractDynamicsBackend const> backend = findDynamicsBackend(model);
+    ASSERT_TRUE(backend);
+    EXPECT_EQ(backend->getName(), "atlas_v4");
+    pinocchio::Model modelFixed;
+    pinocchio::urdf::buildModel(urdfPath, modelFixed);
+    EXPECT_FALSE(backend->isCompatible(modelFixed));
+
+    // Generate a random state
+    vectorN_t const q = pinocchio::randomConfiguration(
+        model, -vectorN_t::Ones(model.nq), vectorN_t::Ones(model.nq));
+    vectorN_t const v = vectorN_t::Random(model.nv);
+    vectorN_t const a = vectorN_t::Random(model.nv);
+    vectorN_t const tau = vectorN_t::Random(model.nv);
+    forceVector_t fext(static_cast<std::size_t>(model.njoints), pinocchio::Force::Zero());
+    for (int32_t i = 1; i < model.njoints; ++i)
+    {
+        fext[i] = pinocchio::Force::Random();
+    }
+
+    // Make sure that the specialized algorithms are consistent with the generic ones
+    backend->forwardKinematics(model, data, q, v, a);
+    pinocchio::forwardKinematics(model, dataRef, q, v, a);
+    for (int32_t i = 1; i < model.njoints; ++i)
+    {
+        ASSERT_TRUE(data.oMi[i].isApprox(dataRef.oMi[i], 1e-12));
+        ASSERT_TRUE(data.v[i].isApprox(dataRef.v[i], 1e-12));
+        ASSERT_TRUE(data.a[i].isApprox(dataRef.a[i], 1e-12));
+    }
+    vectorN_t const ddq = backend->aba(model, data, q, v, tau, fext);
+    vectorN_t const ddqRef = pinocchio_overload::aba(model, dataRef, q, v, tau, fext);
+    ASSERT_TRUE(ddq.isApprox(ddqRef, 1e-9));
+    matrixN_t const M = backend->crba(model, data, q).triangularView<Eigen::Upper>();
+    matrixN_t const MRef = pinocchio_overload::crba(model, dataRef, q).triangularView<Eigen::Upper>();
+    ASSERT_TRUE(M.isApprox(MRef, 1e-12));
+}
@@ -0,0 +1,139 @@
+// Test the random number generators.
+// The tests in this file verify that the counter-based generator matches the known-answer
+// vectors of the reference implementation, that skipping samples is equivalent to drawing
+// them, and that the normal samples filling vectors of any size have the expected moments.
+#include <array>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include "jiminy/core/utilities/Random.h"
+#include "jiminy/core/Types.h"
+
+
+using namespace jiminy;
+
+
+TEST(RandomTest, PhiloxKnownAnswer)
+{
+    // Known-answer vectors of Philox4x32-10 from Random123: counter, key, and expected block
+    using philoxVector_t = std::tuple<std::array<uint32_t, 4>, std::array<uint32_t, 2>, std::array<uint32_t, 4> >;
+    std::vector<philoxVector_t> const vectors{
+        {{0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U}, {0x00000000U, 0x00000000U},
+         {0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU, 0x9b00dbd8U}},
+        {{0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU}, {0xffffffffU, 0xffffffffU},
+         {0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U, 0x6d5451fdU}},
+        {{0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U}, {0xa4093822U, 0x299f31d0U},
+         {0xd16cfe09U, 0x94fdccebU, 0x5001e420U, 0x24126ea1U}}};
+
+    for (auto const & [counter, key, block] : vectors)
+    {
+        // The key is made of the seed and the index of the stream
+        PhiloxGenerator generator(key[0], key[1]);
+        generator.setCounter(counter);
+        for (uint32_t const & value : block)
+        {
+            EXPECT_EQ(generator(), value);
+        }
+    }
+
+    // The counter starts from zero
+    PhiloxGenerator generator;
+    EXPECT_EQ(generator(), std::get<2>(vectors[0])[0]);
+}
+
+TEST(RandomTest, PhiloxDiscard)
+{
+    // Skipping samples must be equivalent to drawing them, wherever it starts within a block
+    for (uint64_t const & offset : {0U, 1U, 2U, 3U})
+    {
+        for (uint64_t const & n : {0U, 1U, 3U, 4U, 5U, 8U, 17U, 1000U, 4099U})
+        {
+            PhiloxGenerator generator(42U, 3U);
+            PhiloxGenerator generatorRef(42U, 3U);
+            for (uint64_t i = 0; i < offset; ++i)
+            {
+                generator();
+                generatorRef();
+            }
+            generator.discard(n);
+            for (uint64_t i = 0; i < n; ++i)
+            {
+                generatorRef();
+            }
+            for (uint32_t i = 0; i < 8U; ++i)
+            {
+                EXPECT_EQ(generator(), generatorRef()) << "offset: " << offset << ", n: " << n;
+            }
+        }
+    }
+
+    // The carry must be propagated to the most significant words of the counter
+    PhiloxGenerator generator(42U);
+    PhiloxGenerator generatorRef(42U);
+    generator.setCounter({0xfffffffeU, 0xffffffffU, 0xffffffffU, 0U});
+    generatorRef.setCounter({0xfffffffeU, 0xffffffffU, 0xffffffffU, 0U});
+    generator.discard(13U);
+    for (uint32_t i = 0; i < 13U; ++i)
+    {
+        generatorRef();
+    }
+    for (uint32_t i = 0; i < 8U; ++i)
+    {
+        EXPECT_EQ(generator(), generatorRef());
+    }
+
+    // The next block after the carry is the one of the expected counter
+    PhiloxGenerator generatorCarry(42U);
+    generatorCarry.setCounter({0x00000001U, 0x00000000U, 0x00000000U, 1U});
+    generatorRef.setCounter({0xfffffffeU, 0xffffffffU, 0xffffffffU, 0U});
+    generatorRef.discard(12U);
+    for (uint32_t i = 0; i < 4U; ++i)
+    {
+        EXPECT_EQ(generatorRef(), generatorCarry());
+    }
+}
+
+TEST(RandomTest, FillRandomNormalMoments)
+{
+    /* Every element must follow the expected distribution, including the last ones when the
+       size is odd or not a multiple of the number of samples generated at once. */
+    PhiloxGenerator generator(7U);
+    uint32_t const samplesNum = 20000U;
+    for (Eigen::Index const size : {1, 2, 7, 15, 16, 17, 31, 33, 101})
+    {
+        // Scalar mean and standard deviation
+        vectorN_t values(size);
+        vectorN_t sum = vectorN_t::Zero(size);
+        vectorN_t sumSquared = vectorN_t::Zero(size);
+        for (uint32_t k = 0; k < samplesNum; ++k)
+        {
+            values.setConstant(qNAN);
+            fillRandomNormal(generator, values, 1.0, 2.0);
+            ASSERT_TRUE(values.allFinite()) << "size: " << size;
+            sum += values;
+            sumSquared += values.cwiseAbs2();
+        }
+        vectorN_t mean = sum / static_cast<float64_t>(samplesNum);
+        vectorN_t stdDev = (sumSquared / static_cast<float64_t>(samplesNum) - mean.cwiseAbs2()).cwiseSqrt();
+        EXPECT_TRUE((mean.array() - 1.0).abs().maxCoeff() < 0.1) << "size: " << size;
+        EXPECT_TRUE((stdDev.array() - 2.0).abs().maxCoeff() < 0.1) << "size: " << size;
+
+        // Centered samples with element-wise standard deviation
+        vectorN_t const stdRef = vectorN_t::LinSpaced(size, 0.5, 3.0);
+        sum.setZero();
+        sumSquared.setZero();
+        for (uint32_t k = 0; k < samplesNum; ++k)
+        {
+            values.setConstant(qNAN);
+            fillRandomNormal(generator, values, stdRef);
+            ASSERT_TRUE(values.allFinite()) << "size: " << size;
+            sum += values;
+            sumSquared += values.cwiseAbs2();
+        }
+        mean = sum / static_cast<float64_t>(samplesNum);
+        stdDev = (sumSquared / static_cast<float64_t>(samplesNum) - mean.cwiseAbs2()).cwiseSqrt();
+        EXPECT_TRUE((mean.array() / stdRef.array()).abs().maxCoeff() < 0.05) << "size: " << size;
+        EXPECT_TRUE((stdDev.array() / stdRef.array() - 1.0).abs().maxCoeff() < 0.05) << "size: " << size;
+    }
+}
@@ -0,0 +1,187 @@
+// Test the delay of the sensors.
+// The tests in this file verify that the ring buffer storing the past data of the sensors
+// keeps them in chronological order when wrapping around or growing, and that the delayed
+// measurements are the same whether the sensors share the same delay or not.
+// The test system is a double inverted pendulum.
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "jiminy/core/robot/Robot.h"
+#include "jiminy/core/robot/BasicSensors.h"
+#include "jiminy/core/Constants.h"
+#include "jiminy/core/Types.h"
+
+
+using namespace jiminy;
+
+
+// Check that the ring buffer stores the timesteps from 'timeFirst', along with their data
+void checkRingBuffer(SensorSharedDataHolder_t       & holder,
+                     float64_t                const & timeFirst)
+{
+    for (std::size_t i = 0; i < holder.size_; ++i)
+    {
+        float64_t const t = timeFirst + static_cast<float64_t>(i);
+        EXPECT_EQ(holder.timeAt(i), t);
+        EXPECT_EQ(holder.dataAt(i)(0, 0), t);
+        EXPECT_EQ(holder.dataAt(i)(0, 1), -t);
+    }
+}
+
+// Append a timestep to the ring buffer, whose data are its time for the first sensor
+void pushBack(SensorSharedDataHolder_t       & holder,
+              float64_t                const & t)
+{
+    holder.pushBack(t);
+    holder.dataAt(holder.size_ - 1) << t, -t;
+}
+
+
+TEST(SensorTest, RingBuffer)
+{
+    // Ring buffer of two scalar sensors, storing a single timestep
+    SensorSharedDataHolder_t holder;
+    holder.num_ = 2U;
+    holder.resetBuffer(matrixN_t::Zero(1, 2), 0.0);
+    ASSERT_EQ(holder.size_, 1U);
+    ASSERT_EQ(holder.time_.size(), 1);
+
+    // The buffer grows as soon as it is full, keeping the data of the previous timesteps
+    pushBack(holder, 1.0);
+    Eigen::Index const capacity = holder.time_.size();
+    ASSERT_EQ(capacity, 1 + DELAY_MIN_BUFFER_RESERVE);
+    ASSERT_EQ(holder.data_.cols(), 2 * capacity);
+    checkRingBuffer(holder, 0.0);
+
+    // It is not reallocated until full
+    float64_t const * timePtr = holder.time_.data();
+    float64_t const * dataPtr = holder.data_.data();
+    for (Eigen::Index i = 2; i < capacity; ++i)
+    {
+        pushBack(holder, static_cast<float64_t>(i));
+    }
+    EXPECT_EQ(holder.time_.data(), timePtr);
+    EXPECT_EQ(holder.data_.data(), dataPtr);
+    ASSERT_EQ(holder.size_, static_cast<std::size_t>(capacity));
+    checkRingBuffer(holder, 0.0);
+
+    // Wrap around after removing the oldest timesteps, still without reallocation
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        holder.popFront();
+    }
+    EXPECT_EQ(holder.head_, 3U);
+    for (Eigen::Index i = capacity; i < capacity + 3; ++i)
+    {
+        pushBack(holder, static_cast<float64_t>(i));
+    }
+    EXPECT_EQ(holder.time_.data(), timePtr);
+    EXPECT_EQ(holder.data_.data(), dataPtr);
+    ASSERT_EQ(holder.size_, static_cast<std::size_t>(capacity));
+    checkRingBuffer(holder, 3.0);
+
+    // Bisection across the end of the underlying storage
+    EXPECT_EQ(holder.bisectLeft(2.0), -1);
+    EXPECT_EQ(holder.bisectLeft(3.0), 0);
+    EXPECT_EQ(holder.bisectLeft(capacity + 0.5), capacity - 3);
+    EXPECT_EQ(holder.bisectLeft(capacity + 10.0), capacity - 1);
+
+    // Growing while wrapped around moves the oldest timestep at the beginning of the storage
+    pushBack(holder, static_cast<float64_t>(capacity + 3));
+    EXPECT_EQ(holder.time_.size(), capacity + DELAY_MIN_BUFFER_RESERVE);
+    EXPECT_EQ(holder.head_, 0U);
+    ASSERT_EQ(holder.size_, static_cast<std::size_t>(capacity + 1));
+    checkRingBuffer(holder, 3.0);
+
+    // Removing the most recent timestep
+    holder.popBack();
+    ASSERT_EQ(holder.size_, static_cast<std::size_t>(capacity));
+    checkRingBuffer(holder, 3.0);
+}
+
+TEST(SensorTest, DelayedEncoders)
+{
+    // Double pendulum with an encoder on each joint
+    std::string const dataDirPath(UNIT_TEST_DATA_DIR);
+    auto const urdfPath = dataDirPath + "/double_pendulum_rigid.urdf";
+    std::vector<std::string> const jointNames{"PendulumJoint", "SecondPendulumJoint"};
+    auto robot = std::make_shared<Robot>();
+    ASSERT_EQ(robot->initialize(urdfPath, false), hresult_t::SUCCESS);
+    std::vector<std::shared_ptr<EncoderSensor> > sensors;
+    for (std::string const & jointName : jointNames)
+    {
+        auto sensor = std::make_shared<EncoderSensor>(jointName);
+        ASSERT_EQ(robot->attachSensor(sensor), hresult_t::SUCCESS);
+        ASSERT_EQ(sensor->initialize(jointName), hresult_t::SUCCESS);
+        sensors.push_back(sensor);
+    }
+
+    // Smooth motion of the joints, sampled at a fixed period that does not divide the delays
+    float64_t const dt = 0.01;
+    auto const position = [](float64_t const & t, std::size_t const & i) { return std::sin(t + i); };
+    auto const velocity = [](float64_t const & t, std::size_t const & i) { return std::cos(t + i); };
+
+    // Value of the samples at a given time, interpolated linearly or taken on the left
+    auto const interpolate =
+        [&dt](auto const & fct, float64_t const & t, std::size_t const & i, uint32_t const & order)
+        {
+            float64_t const k = std::floor(t / dt);
+            float64_t const ratio = (order == 0U) ? 0.0 : t / dt - k;
+            return (1.0 - ratio) * fct(k * dt, i) + ratio * fct((k + 1.0) * dt, i);
+        };
+
+    /* The delays of the sensors are either the same, so that their data are interpolated at
+       once, or different, so that they are interpolated one by one. The first sensor must be
+       delayed the same way in both cases. */
+    std::vector<std::pair<float64_t, uint32_t> > const delaysShared{{0.055, 1U}, {0.055, 1U}};
+    std::vector<std::pair<float64_t, uint32_t> > const delaysDifferent{{0.055, 1U}, {0.035, 0U}};
+    std::vector<vectorN_t> dataFirstSensor;
+    for (auto const & delays : {delaysShared, delaysDifferent})
+    {
+        for (std::size_t i = 0; i < sensors.size(); ++i)
+        {
+            configHolder_t sensorOptions = sensors[i]->getOptions();
+            boost::get<float64_t>(sensorOptions.at("delay")) = delays[i].first;
+            boost::get<uint32_t>(sensorOptions.at("delayInterpolationOrder")) = delays[i].second;
+            ASSERT_EQ(sensors[i]->setOptions(sensorOptions), hresult_t::SUCCESS);
+        }
+        robot->reset();
+
+        // Feed the sensors long enough for the ring buffer to wrap around several times
+        vectorN_t q(robot->nq()), v(robot->nv());
+        vectorN_t const a = vectorN_t::Zero(robot->nv());
+        vectorN_t const uMotor = vectorN_t::Zero(robot->getMotorsNames().size());
+        forceVector_t const fext(robot->pncModel_.njoints, pinocchio::Force::Zero());
+        vectorN_t data(2 * 300);
+        for (uint32_t n = 0; n < 300; ++n)
+        {
+            float64_t const t = n * dt;
+            for (std::size_t i = 0; i < sensors.size(); ++i)
+            {
+                q[i] = position(t, i);
+                v[i] = velocity(t, i);
+            }
+            robot->setSensorsData(t, q, v, a, uMotor, fext);
+            EncoderSensor const & sensorFirst = *sensors[0];
+            data.segment<2>(2 * n) = sensorFirst.get();
+
+            // Check the measurements once enough data are available
+            if (t < 0.1)
+            {
+                continue;
+            }
+            for (std::size_t i = 0; i < sensors.size(); ++i)
+            {
+                auto const & [delay, order] = delays[i];
+                float64_t const tDelayed = t - delay + STEPPER_MIN_TIMESTEP;
+                EncoderSensor const & sensor = *sensors[i];
+                Eigen::Ref<vectorN_t const> const value = sensor.get();
+                EXPECT_NEAR(value[0], interpolate(position, tDelayed, i, order), 1e-8) << "t: " << t;
+                EXPECT_NEAR(value[1], interpolate(velocity, tDelayed, i, order), 1e-8) << "t: " << t;
+            }
+        }
+        dataFirstSensor.push_back(data);
+    }
+    EXPECT_TRUE(dataFirstSensor[0].isApprox(dataFirstSensor[1], 1e-12));
+}
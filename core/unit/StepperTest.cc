@@ -0,0 +1,181 @@
+// Test the steppers used to integrate the equation of dynamics.
+// The tests in this file verify that the integration is accurate on a system whose solution is
+// known analytically, and that no memory is allocated by Eigen once the stepper is constructed.
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#define EIGEN_RUNTIME_NO_MALLOC
+
+#include "pinocchio/algorithm/joint-configuration.hpp"
+
+#include "jiminy/core/robot/Robot.h"
+#include "jiminy/core/stepper/EulerExplicitStepper.h"
+#include "jiminy/core/stepper/EulerSemiImplicitStepper.h"
+#include "jiminy/core/stepper/EulerLinearImplicitStepper.h"
+#include "jiminy/core/stepper/RungeKutta4Stepper.h"
+#include "jiminy/core/stepper/RungeKuttaDOPRIStepper.h"
+#include "jiminy/core/Types.h"
+
+
+using namespace jiminy;
+
+
+class StepperTestFixture :
+    public testing::TestWithParam<std::string> {
+};
+
+
+TEST_P(StepperTestFixture, LinearDampingNoAllocation)
+{
+    // Load two robots with a freeflyer, so that the configuration lies in a Lie group
+    std::string const dataDirPath(UNIT_TEST_DATA_DIR);
+    auto const urdfPath = dataDirPath + "/branching_pendulum.urdf";
+    auto robot = std::make_shared<Robot>();
+    ASSERT_EQ(robot->initialize(urdfPath, true), hresult_t::SUCCESS);
+    std::vector<Robot const *> const robots{robot.get(), robot.get()};
+
+    // Linear damping a = -v, whose velocity is known analytically: v(t) = v(0) * exp(-t)
+    systemDynamics const dynamics =
+        [](float64_t              const & /* t */,
+           std::vector<vectorN_t> const & /* qSplit */,
+           std::vector<vectorN_t> const & vSplit,
+           std::vector<vectorN_t>       & aSplit)
+        {
+            for (std::size_t i = 0; i < vSplit.size(); ++i)
+            {
+                aSplit[i] = - vSplit[i];
+            }
+        };
+
+    // Instantiate the stepper
+    std::unique_ptr<AbstractStepper> stepper;
+    if (GetParam() == "runge_kutta_dopri5")
+    {
+        stepper = std::make_unique<RungeKuttaDOPRIStepper>(dynamics, robots, 1.0e-8, 1.0e-8);
+    }
+    else if (GetParam() == "runge_kutta_4")
+    {
+        stepper = std::make_unique<RungeKutta4Stepper>(dynamics, robots);
+    }
+    else if (GetParam() == "euler_semi_implicit")
+    {
+        stepper = std::make_unique<EulerSemiImplicitStepper>(dynamics, robots);
+    }
+    else if (GetParam() == "euler_linear_implicit")
+    {
+        // Unit mass matrix, the damping being the only stiff effort
+        systemLinearization const linearization =
+            [](float64_t              const & /* t */,
+               std::vector<vectorN_t> const & /* qSplit */,
+               std::vector<vectorN_t> const & /* vSplit */,
+               std::vector<matrixN_t>       & massSplit,
+               std::vector<matrixN_t>       & stiffnessSplit,
+               std::vector<matrixN_t>       & dampingSplit)
+            {
+                for (std::size_t i = 0; i < massSplit.size(); ++i)
+                {
+                    massSplit[i].setIdentity();
+                    stiffnessSplit[i].setZero();
+                    dampingSplit[i].setIdentity();
+                }
+            };
+        stepper = std::make_unique<EulerLinearImplicitStepper>(dynamics, linearization, robots);
+    }
+    else
+    {
+        stepper = std::make_unique<EulerExplicitStepper>(dynamics, robots);
+    }
+
+    // Initialize the state
+    std::vector<vectorN_t> qInit, vInit, aInit;
+    for (Robot const * const & system : robots)
+    {
+        qInit.push_back(pinocchio::neutral(system->pncModel_));
+        vInit.push_back(vectorN_t::Random(system->nv()));
+        aInit.push_back(- vInit.back());
+    }
+    state_t state(robots, qInit, vInit);
+    stateDerivative_t stateDerivative(robots, vInit, aInit);
+
+    // Integrate the dynamics, forbidding any allocation after the first step
+    float64_t const stepSize = 1.0e-3;
+    uint32_t const nIter = 100U;
+    float64_t t = 0.0;
+    float64_t dt = stepSize;
+    bool_t isSuccessful = stepper->tryStep(state, stateDerivative, t, dt);
+    Eigen::internal::set_is_malloc_allowed(false);
+    for (uint32_t i = 0; i < nIter; ++i)
+    {
+        dt = stepSize;
+        isSuccessful = isSuccessful && stepper->tryStep(state, stateDerivative, t, dt);
+    }
+    Eigen::internal::set_is_malloc_allowed(true);
+
+    // Make sure that the integration is accurate
+    ASSERT_TRUE(isSuccessful);
+    EXPECT_NEAR(t, (nIter + 1U) * stepSize, 1e-12);
+    for (std::size_t i = 0; i < robots.size(); ++i)
+    {
+        EXPECT_TRUE(state.v[i].isApprox(vInit[i] * std::exp(- t), 1e-3));
+        EXPECT_TRUE(stateDerivative.v[i].isApprox(state.v[i]));
+    }
+}
+
+TEST(StepperTest, DenseOutputDOPRI)
+{
+    // Load a robot with a freeflyer, so that the configuration lies in a Lie group
+    std::string const dataDirPath(UNIT_TEST_DATA_DIR);
+    auto const urdfPath = dataDirPath + "/branching_pendulum.urdf";
+    auto robot = std::make_shared<Robot>();
+    ASSERT_EQ(robot->initialize(urdfPath, true), hresult_t::SUCCESS);
+    std::vector<Robot const *> const robots{robot.get()};
+
+    // Linear damping a = -v, whose velocity is known analytically: v(t) = v(0) * exp(-t)
+    systemDynamics const dynamics =
+        [](float64_t              const & /* t */,
+           std::vector<vectorN_t> const & /* qSplit */,
+           std::vector<vectorN_t> const & vSplit,
+           std::vector<vectorN_t>       & aSplit)
+        {
+            aSplit[0] = - vSplit[0];
+        };
+    RungeKuttaDOPRIStepper stepper(dynamics, robots, 1.0e-8, 1.0e-8);
+    ASSERT_TRUE(stepper.hasDenseOutput());
+
+    // Do a single large step
+    std::vector<vectorN_t> const qInit{pinocchio::neutral(robot->pncModel_)};
+    std::vector<vectorN_t> const vInit{vectorN_t::Random(robot->nv())};
+    std::vector<vectorN_t> const aInit{- vInit[0]};
+    state_t state(robots, qInit, vInit);
+    stateDerivative_t stateDerivative(robots, vInit, aInit);
+    float64_t t = 0.0;
+    float64_t dt = 0.1;
+    ASSERT_TRUE(stepper.tryStep(state, stateDerivative, t, dt));
+
+    // The dense output must match the solution at both ends, and the analytical one in between
+    state_t stateDense(robots);
+    stateDerivative_t stateDerivativeDense(robots);
+    ASSERT_TRUE(stepper.computeDenseOutput(0.0, stateDense, stateDerivativeDense));
+    EXPECT_TRUE(stateDense.q[0].isApprox(qInit[0]));
+    EXPECT_TRUE(stateDense.v[0].isApprox(vInit[0]));
+    ASSERT_TRUE(stepper.computeDenseOutput(t, stateDense, stateDerivativeDense));
+    EXPECT_TRUE(stateDense.q[0].isApprox(state.q[0]));
+    EXPECT_TRUE(stateDense.v[0].isApprox(state.v[0]));
+    for (float64_t const & tDense : {0.025, 0.05, 0.075})
+    {
+        ASSERT_TRUE(stepper.computeDenseOutput(tDense, stateDense, stateDerivativeDense));
+        EXPECT_TRUE(stateDense.v[0].isApprox(vInit[0] * std::exp(- tDense), 1e-6));
+        EXPECT_TRUE(stateDerivativeDense.a[0].isApprox(- vInit[0] * std::exp(- tDense), 1e-3));
+    }
+
+    // It is not defined outside the last step
+    EXPECT_FALSE(stepper.computeDenseOutput(2.0 * t, stateDense, stateDerivativeDense));
+}
+
+INSTANTIATE_TEST_SUITE_P(StepperTests, StepperTestFixture,
+                         testing::Values("euler_explicit",
+                                         "euler_semi_implicit",
+                                         "euler_linear_implicit",
+                                         "runge_kutta_4",
+                                         "runge_kutta_dopri5"));
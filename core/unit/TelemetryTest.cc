@@ -0,0 +1,135 @@
+// Test the telemetry.
+// The tests in this file verify that the variables and constants of a previous simulation
+// are recycled when exactly the same variables are registered again, and that the telemetry
+// is registered from scratch otherwise.
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "jiminy/core/telemetry/TelemetryData.h"
+#include "jiminy/core/telemetry/TelemetrySender.h"
+#include "jiminy/core/Types.h"
+
+
+using namespace jiminy;
+
+
+// Whether a header contains a given string
+bool_t headerContains(std::vector<char_t> const & header,
+                      std::string         const & str)
+{
+    return std::search(header.begin(), header.end(), str.begin(), str.end()) != header.end();
+}
+
+// Float value of the current line of data, made of the time, the integers, then the floats
+float64_t getFloatSnapshot(TelemetryData       & telemetryData,
+                           std::size_t   const & integersNum,
+                           std::size_t   const & index)
+{
+    char_t const * const floatsData = telemetryData.getDataSnapshot() + sizeof(int64_t) * (1U + integersNum);
+    return reinterpret_cast<float64_t const *>(floatsData)[index];
+}
+
+
+TEST(TelemetryTest, RecycleSameVariables)
+{
+    // Nothing to recycle before the header of a first simulation has been formatted
+    auto telemetryData = std::make_shared<TelemetryData>();
+    EXPECT_FALSE(telemetryData->rewind());
+
+    // First simulation
+    TelemetrySender sender;
+    sender.configureObject(telemetryData, "Object");
+    telemetryHandle_t<float64_t> handleFloat;
+    telemetryHandle_t<int64_t> handleInt;
+    ASSERT_EQ(sender.registerVariable("float", 1.0, handleFloat), hresult_t::SUCCESS);
+    ASSERT_EQ(sender.registerVariable("int", int64_t(2), handleInt), hresult_t::SUCCESS);
+    ASSERT_EQ(sender.registerConstant("constant", "value"), hresult_t::SUCCESS);
+    std::vector<char_t> header;
+    telemetryData->formatHeader(header);
+    std::vector<char_t> const headerRef = header;
+    char_t const * const snapshotRef = telemetryData->getDataSnapshot();
+    uint64_t const generation = telemetryData->getGeneration();
+    ASSERT_NE(snapshotRef, nullptr);
+    EXPECT_TRUE(sender.getIsConfigured());
+
+    // Second simulation registering exactly the same variables and constants
+    ASSERT_TRUE(telemetryData->rewind());
+    EXPECT_FALSE(telemetryData->getIsRecycled());
+    telemetryHandle_t<float64_t> handleFloatRecycled;
+    telemetryHandle_t<int64_t> handleIntRecycled;
+    ASSERT_EQ(sender.registerVariable("float", 3.0, handleFloatRecycled), hresult_t::SUCCESS);
+    ASSERT_EQ(sender.registerVariable("int", int64_t(4), handleIntRecycled), hresult_t::SUCCESS);
+    ASSERT_EQ(sender.registerConstant("constant", "value"), hresult_t::SUCCESS);
+    EXPECT_TRUE(telemetryData->getIsRecycled());
+
+    // A constant can only be registered once per simulation, even while recycling
+    EXPECT_NE(sender.registerConstant("constant", "value"), hresult_t::SUCCESS);
+
+    // The buffers and the header are kept as is, but the values are updated
+    EXPECT_EQ(handleFloatRecycled.index, handleFloat.index);
+    EXPECT_EQ(handleIntRecycled.index, handleInt.index);
+    telemetryData->formatHeader(header);
+    EXPECT_EQ(header, headerRef);
+    EXPECT_EQ(telemetryData->getDataSnapshot(), snapshotRef);
+    EXPECT_EQ(getFloatSnapshot(*telemetryData, 1U, handleFloat.index), 3.0);
+    EXPECT_EQ(telemetryData->getGeneration(), generation);
+    EXPECT_TRUE(sender.getIsConfigured());
+
+    // Third simulation with a different value for the constant, which rebuilds the header only
+    ASSERT_TRUE(telemetryData->rewind());
+    ASSERT_EQ(sender.registerVariable("float", 1.0, handleFloatRecycled), hresult_t::SUCCESS);
+    ASSERT_EQ(sender.registerVariable("int", int64_t(2), handleIntRecycled), hresult_t::SUCCESS);
+    ASSERT_EQ(sender.registerConstant("constant", "other value"), hresult_t::SUCCESS);
+    EXPECT_TRUE(telemetryData->getIsRecycled());
+    telemetryData->formatHeader(header);
+    EXPECT_NE(header, headerRef);
+    EXPECT_TRUE(headerContains(header, "other value"));
+    EXPECT_EQ(telemetryData->getDataSnapshot(), snapshotRef);
+    EXPECT_EQ(telemetryData->getGeneration(), generation);
+}
+
+TEST(TelemetryTest, ResetChangedVariables)
+{
+    // First simulation
+    auto telemetryData = std::make_shared<TelemetryData>();
+    TelemetrySender sender;
+    sender.configureObject(telemetryData, "Object");
+    telemetryHandle_t<float64_t> handleFloat;
+    telemetryHandle_t<int64_t> handleInt;
+    ASSERT_EQ(sender.registerVariable("float", 1.0, handleFloat), hresult_t::SUCCESS);
+    ASSERT_EQ(sender.registerVariable("int", int64_t(2), handleInt), hresult_t::SUCCESS);
+    std::vector<char_t> header;
+    telemetryData->formatHeader(header);
+    std::vector<char_t> const headerRef = header;
+    uint64_t const generation = telemetryData->getGeneration();
+
+    // A variable is missing, so the telemetry cannot be recycled
+    ASSERT_TRUE(telemetryData->rewind());
+    ASSERT_EQ(sender.registerVariable("float", 1.0, handleFloat), hresult_t::SUCCESS);
+    EXPECT_FALSE(telemetryData->getIsRecycled());
+
+    // A new variable cannot be registered while recycling
+    ASSERT_TRUE(telemetryData->rewind());
+    ASSERT_EQ(sender.registerVariable("float", 1.0, handleFloat), hresult_t::SUCCESS);
+    ASSERT_EQ(sender.registerVariable("int", int64_t(2), handleInt), hresult_t::SUCCESS);
+    telemetryHandle_t<float64_t> handleNew;
+    EXPECT_NE(sender.registerVariable("new", 5.0, handleNew), hresult_t::SUCCESS);
+
+    // Fallback to a reset, which invalidates the registration of the senders
+    telemetryData->reset();
+    EXPECT_EQ(telemetryData->getGeneration(), generation + 1U);
+    EXPECT_FALSE(sender.getIsConfigured());
+    EXPECT_FALSE(telemetryData->rewind());
+
+    // Register every variable again from scratch, which rebuilds the header
+    sender.configureObject(telemetryData, "Object");
+    EXPECT_TRUE(sender.getIsConfigured());
+    ASSERT_EQ(sender.registerVariable("float", 1.0, handleFloat), hresult_t::SUCCESS);
+    ASSERT_EQ(sender.registerVariable("int", int64_t(2), handleInt), hresult_t::SUCCESS);
+    ASSERT_EQ(sender.registerVariable("new", 5.0, handleNew), hresult_t::SUCCESS);
+    telemetryData->formatHeader(header);
+    EXPECT_NE(header, headerRef);
+    EXPECT_TRUE(headerContains(header, "Object.new"));
+    EXPECT_EQ(getFloatSnapshot(*telemetryData, 1U, handleNew.index), 5.0);
+}
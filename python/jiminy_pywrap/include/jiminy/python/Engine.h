@@ -12,6 +12,7 @@ namespace python
     void exposeSystem(void);
     void exposeEngineMultiRobot(void);
     void exposeEngine(void);
+    void exposeEngineBatch(void);
 }  // End of namespace python.
 }  // End of namespace jiminy.
 
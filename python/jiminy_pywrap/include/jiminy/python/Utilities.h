@@ -52,6 +52,30 @@ namespace python
         Py ## class ## Visitor::expose(); \
     }
 
+    /// \brief  Release the Global Interpreter Lock for the lifetime of the object.
+    ///
+    /// \details  No Python object must be accessed while the lock is released.
+    class GilReleaseGuard
+    {
+    public:
+        GilReleaseGuard(GilReleaseGuard const & other) = delete;
+        GilReleaseGuard & operator = (GilReleaseGuard const & other) = delete;
+
+        GilReleaseGuard(void) :
+        threadState_(PyEval_SaveThread())
+        {
+            // Empty on purpose
+        }
+
+        ~GilReleaseGuard(void)
+        {
+            PyEval_RestoreThread(threadState_);
+        }
+
+    private:
+        PyThreadState * threadState_;
+    };
+
     template<typename R, typename ...Args>
     boost::mpl::vector<R, Args...> functionToMLP(std::function<R(Args...)> /* func */)
     {
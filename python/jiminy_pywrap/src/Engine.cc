@@ -3,6 +3,7 @@
 #include "jiminy/core/robot/Robot.h"
 #include "jiminy/core/engine/Engine.h"
 #include "jiminy/core/engine/EngineMultiRobot.h"
+#include "jiminy/core/engine/EngineBatch.h"
 #include "jiminy/core/telemetry/TelemetryData.h"
 #include "jiminy/core/telemetry/TelemetryRecorder.h"
 #include "jiminy/core/utilities/Json.h"
@@ -116,17 +117,17 @@ namespace python
 
         static bp::list getQ(stepperState_t const & self)
         {
-            return bp::extract<bp::list>(convertToPython(self.qSplit, false));
+            return bp::extract<bp::list>(convertToPython(self.state.q, false));
         }
 
         static bp::list getV(stepperState_t const & self)
         {
-            return bp::extract<bp::list>(convertToPython(self.vSplit, false));
+            return bp::extract<bp::list>(convertToPython(self.state.v, false));
         }
 
         static bp::list getA(stepperState_t const & self)
         {
-            return bp::extract<bp::list>(convertToPython(self.aSplit, false));
+            return bp::extract<bp::list>(convertToPython(self.stateDerivative.a, false));
         }
 
         static std::string repr(stepperState_t const & self)
@@ -138,19 +139,19 @@ namespace python
             s << "\nt:\n    " << self.t;
             s << "\ndt:\n    " << self.dt;
             s << "\nq:";
-            for (std::size_t i = 0; i < self.qSplit.size(); ++i)
+            for (std::size_t i = 0; i < self.state.q.size(); ++i)
             {
-                s << "\n    (" << i << "): " << self.qSplit[i].transpose().format(HeavyFmt);
+                s << "\n    (" << i << "): " << self.state.q[i].transpose().format(HeavyFmt);
             }
             s << "\nv:";
-            for (std::size_t i = 0; i < self.vSplit.size(); ++i)
+            for (std::size_t i = 0; i < self.state.v.size(); ++i)
             {
-                s << "\n    (" << i << "): " << self.vSplit[i].transpose().format(HeavyFmt);
+                s << "\n    (" << i << "): " << self.state.v[i].transpose().format(HeavyFmt);
             }
             s << "\na:";
-            for (std::size_t i = 0; i < self.aSplit.size(); ++i)
+            for (std::size_t i = 0; i < self.stateDerivative.a.size(); ++i)
             {
-                s << "\n    (" << i << "): " << self.aSplit[i].transpose().format(HeavyFmt);
+                s << "\n    (" << i << "): " << self.stateDerivative.a[i].transpose().format(HeavyFmt);
             }
             return s.str();
         }
@@ -300,11 +301,17 @@ namespace python
                 .def("step", &PyEngineMultiRobotVisitor::step,
                              (bp::arg("self"), bp::arg("dt_desired") = -1))
                 .def("stop", &EngineMultiRobot::stop, (bp::arg("self")))
+                .def("save_state", &PyEngineMultiRobotVisitor::saveState, (bp::arg("self")))
+                .def("restore_state", &PyEngineMultiRobotVisitor::restoreState,
+                                      (bp::arg("self"), "state"))
                 .def("simulate", &PyEngineMultiRobotVisitor::simulate,
                                  (bp::arg("self"), "t_end", "q_init_list", "v_init_list",
                                   bp::arg("a_init_list") = bp::object()))
-                .def("compute_forward_kinematics", &EngineMultiRobot::computeForwardKinematics,
-                                                   (bp::arg("system"), "q", "v", "a"))
+                .def("compute_forward_kinematics",
+                    static_cast<
+                        void (*)(systemHolder_t &, vectorN_t const &, vectorN_t const &, vectorN_t const &)
+                    >(&EngineMultiRobot::computeForwardKinematics),
+                    (bp::arg("system"), "q", "v", "a"))
                 .staticmethod("compute_forward_kinematics")
                 .def("compute_systems_dynamics", &PyEngineMultiRobotVisitor::computeSystemsDynamics,
                                                  bp::return_value_policy<result_converter<true> >(),
@@ -555,6 +562,30 @@ namespace python
             return self.step(dtDesired);
         }
 
+        static bp::object saveState(EngineMultiRobot & self)
+        {
+            std::vector<uint8_t> state;
+            if (self.saveState(state) != hresult_t::SUCCESS)
+            {
+                throw std::runtime_error("Impossible to save the state of the simulation.");
+            }
+            return bp::object(bp::handle<>(PyBytes_FromStringAndSize(
+                reinterpret_cast<char_t const *>(state.data()), static_cast<Py_ssize_t>(state.size()))));
+        }
+
+        static hresult_t restoreState(EngineMultiRobot       & self,
+                                      bp::object       const & statePy)
+        {
+            char_t * data;
+            Py_ssize_t size;
+            if (PyBytes_AsStringAndSize(statePy.ptr(), &data, &size) < 0)
+            {
+                bp::throw_error_already_set();
+            }
+            std::vector<uint8_t> const state(data, data + size);
+            return self.restoreState(state);
+        }
+
         static hresult_t simulate(EngineMultiRobot       & self,
                                   float64_t        const & endTime,
                                   bp::dict         const & qInitPy,
@@ -611,8 +642,35 @@ namespace python
         /// \brief      Getters and Setters
         ///////////////////////////////////////////////////////////////////////////////
 
-        static bp::dict formatLogData(logData_t const & logData)
+        /// \brief Get a read-only view of a row of log data, sharing ownership of the log data.
+        template<typename T>
+        static bp::object getLogDataRowView(std::shared_ptr<logData_t const>                   const & logDataPtr,
+                                            Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> const & data,
+                                            Eigen::Index                                       const & rowIdx)
         {
+            // The rows are strided since the data are stored column-wise
+            npy_intp dims[1] = {npy_intp(data.cols())};
+            npy_intp strides[1] = {npy_intp(sizeof(T) * data.rows())};
+            PyObject * array = PyArray_New(&PyArray_Type, 1, dims, getPyType<T>(), strides,
+                                           const_cast<T *>(data.data() + rowIdx), 0,
+                                           NPY_ARRAY_ALIGNED, nullptr);
+
+            // Keep the log data alive as long as the view exists
+            PyObject * capsule = PyCapsule_New(
+                new std::shared_ptr<logData_t const>(logDataPtr), nullptr,
+                [](PyObject * obj)
+                {
+                    delete static_cast<std::shared_ptr<logData_t const> *>(PyCapsule_GetPointer(obj, nullptr));
+                });
+            PyArray_SetBaseObject(reinterpret_cast<PyArrayObject *>(array), capsule);
+
+            return bp::object(bp::handle<>(array));
+        }
+
+        static bp::dict formatLogData(std::shared_ptr<logData_t const> const & logDataPtr)
+        {
+            logData_t const & logData = *logDataPtr;
+
             // Early return if empty
             if (logData.constants.empty())
             {
@@ -622,10 +680,6 @@ namespace python
             // Initialize buffers
             bp::dict variables, constants;
 
-            // Temporary contiguous storage for variables
-            Eigen::Matrix<int64_t, Eigen::Dynamic, 1> intVector;
-            Eigen::Matrix<float64_t, Eigen::Dynamic, 1> floatVector;
-
             // Get the number of integer and float variables
             Eigen::Index const numInt = logData.intData.rows();
             Eigen::Index const numFloat = logData.floatData.rows();
@@ -709,50 +763,17 @@ namespace python
             }
             variables[logData.fieldnames[0]] = timePy;
 
-            // Get integers
-            if (numInt > 0)
-            {
-                for (Eigen::Index i = 0; i < numInt; ++i)
-                {
-                    std::string const & header_i = logData.fieldnames[i + 1];
-                    intVector = logData.intData.row(i);
-                    bp::object array = convertToPython(intVector, true);
-                    PyArray_CLEARFLAGS(reinterpret_cast<PyArrayObject *>(array.ptr()), NPY_ARRAY_WRITEABLE);
-                    variables[header_i] = array;
-                }
-            }
-            else
-            {
-                npy_intp dims[1] = {npy_intp(0)};
-                for (Eigen::Index i = 0; i < numInt; ++i)
-                {
-                    std::string const & header_i = logData.fieldnames[i + 1];
-                    variables[header_i] = bp::object(bp::handle<>(
-                        PyArray_SimpleNew(1, dims, NPY_INT64)));
-                }
-            }
-
-            // Get floats
-            if (numFloat > 0)
+            /* Get integers and floats, as read-only views of the log data to avoid
+               copying them. Note that empty rows are supported. */
+            for (Eigen::Index i = 0; i < numInt; ++i)
             {
-                for (Eigen::Index i = 0; i < numFloat; ++i)
-                {
-                    std::string const & header_i = logData.fieldnames[i + 1 + numInt];
-                    floatVector = logData.floatData.row(i);
-                    bp::object array = convertToPython(floatVector, true);
-                    PyArray_CLEARFLAGS(reinterpret_cast<PyArrayObject *>(array.ptr()), NPY_ARRAY_WRITEABLE);
-                    variables[header_i] = array;
-                }
+                std::string const & header_i = logData.fieldnames[i + 1];
+                variables[header_i] = getLogDataRowView(logDataPtr, logData.intData, i);
             }
-            else
+            for (Eigen::Index i = 0; i < numFloat; ++i)
             {
-                npy_intp dims[1] = {npy_intp(0)};
-                for (Eigen::Index i = 0; i < numFloat; ++i)
-                {
-                    std::string const & header_i = logData.fieldnames[i + 1 + numInt];
-                    variables[header_i] = bp::object(bp::handle<>(
-                        PyArray_SimpleNew(1, dims, NPY_FLOAT64)));
-                }
+                std::string const & header_i = logData.fieldnames[i + 1 + numInt];
+                variables[header_i] = getLogDataRowView(logDataPtr, logData.floatData, i);
             }
 
             // Return aggregated data
@@ -791,7 +812,7 @@ namespace python
                    than 2. Indeed, both the engine and this method holds a single reference
                    at this point. If it was old, this method would holds at least 2
                    references, one for the old reference and one for the new. */
-                logDataPy = std::make_unique<bp::dict>(formatLogData(*logData));
+                logDataPy = std::make_unique<bp::dict>(formatLogData(logData));
 
                 /* Reference counter must be incremented to avoid calling deleter by Boost
                    Python after runtime finalization. */
@@ -836,8 +857,8 @@ namespace python
                         "Please specify it manually.");
                 }
             }
-            logData_t logData;
-            hresult_t returnCode = EngineMultiRobot::readLog(filename, format, logData);
+            auto logData = std::make_shared<logData_t>();
+            hresult_t returnCode = EngineMultiRobot::readLog(filename, format, *logData);
             if (returnCode == hresult_t::SUCCESS)
             {
                 return formatLogData(logData);
@@ -1095,5 +1116,120 @@ namespace python
     };
 
     BOOST_PYTHON_VISITOR_EXPOSE(Engine)
+
+    // ***************************** PyEngineBatchVisitor ***********************************
+
+    struct PyEngineBatchVisitor
+        : public bp::def_visitor<PyEngineBatchVisitor>
+    {
+    public:
+        ///////////////////////////////////////////////////////////////////////////////
+        /// \brief Expose C++ API through the visitor.
+        ///////////////////////////////////////////////////////////////////////////////
+        template<class PyClass>
+        void visit(PyClass & cl) const
+        {
+            cl
+                .def("initialize", &PyEngineBatchVisitor::initialize,
+                                   (bp::arg("self"), "robots", bp::arg("threads_num") = 0U))
+                .def("set_options", &PyEngineBatchVisitor::setOptions)
+                .def("get_options", &EngineBatch::getOptions)
+
+                .def("start", &PyEngineBatchVisitor::start,
+                              (bp::arg("self"), "q_init", "v_init"))
+                .def("step_batch", &PyEngineBatchVisitor::stepBatch,
+                                   (bp::arg("self"), "actions", bp::arg("dt_desired") = -1))
+                .def("reset_batch", &PyEngineBatchVisitor::resetBatch,
+                                    (bp::arg("self"), "mask", "q_init", "v_init"))
+                .def("stop", &EngineBatch::stop, (bp::arg("self")))
+
+                .def("__len__", &EngineBatch::getBatchSize)
+                .def("__getitem__", &PyEngineBatchVisitor::getEngine,
+                                    (bp::arg("self"), "engine_idx"))
+
+                .ADD_PROPERTY_GET("return_codes", &PyEngineBatchVisitor::getReturnCodes)
+                .ADD_PROPERTY_GET_WITH_POLICY("is_initialized",
+                                              &EngineBatch::getIsInitialized,
+                                              bp::return_value_policy<bp::copy_const_reference>())
+                ;
+        }
+
+        static hresult_t initialize(EngineBatch       & self,
+                                    bp::list    const & robotsPy,
+                                    uint32_t    const & threadsNum)
+        {
+            return self.initialize(
+                convertFromPython<std::vector<std::shared_ptr<Robot> > >(robotsPy), threadsNum);
+        }
+
+        static hresult_t setOptions(EngineBatch       & self,
+                                    bp::dict    const & configPy)
+        {
+            configHolder_t config = self.getOptions();
+            convertFromPython(configPy, config);
+            return self.setOptions(config);
+        }
+
+        static hresult_t start(EngineBatch       & self,
+                               matrixN_t   const & qInit,
+                               matrixN_t   const & vInit)
+        {
+            GilReleaseGuard gilRelease;
+            return self.start(qInit, vInit);
+        }
+
+        static hresult_t stepBatch(EngineBatch       & self,
+                                   matrixN_t   const & actions,
+                                   float64_t   const & dtDesired)
+        {
+            // Every engine is stepped without holding the GIL, so callbacks must be native
+            GilReleaseGuard gilRelease;
+            return self.stepBatch(actions, dtDesired);
+        }
+
+        static hresult_t resetBatch(EngineBatch       & self,
+                                    bp::object  const & maskPy,
+                                    matrixN_t   const & qInit,
+                                    matrixN_t   const & vInit)
+        {
+            std::vector<bool_t> const mask = convertFromPython<std::vector<bool_t> >(maskPy);
+            GilReleaseGuard gilRelease;
+            return self.resetBatch(mask, qInit, vInit);
+        }
+
+        static std::shared_ptr<Engine> getEngine(EngineBatch       & self,
+                                                 std::size_t const & engineIdx)
+        {
+            std::shared_ptr<Engine> engine;
+            if (self.getEngine(engineIdx, engine) != hresult_t::SUCCESS)
+            {
+                throw std::out_of_range("Engine index out of range.");
+            }
+            return engine;
+        }
+
+        static bp::list getReturnCodes(EngineBatch & self)
+        {
+            bp::list returnCodesPy;
+            for (hresult_t const & returnCode : self.getReturnCodes())
+            {
+                returnCodesPy.append(returnCode);
+            }
+            return returnCodesPy;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        /// \brief Expose.
+        ///////////////////////////////////////////////////////////////////////////////
+        static void expose()
+        {
+            bp::class_<EngineBatch,
+                       std::shared_ptr<EngineBatch>,
+                       boost::noncopyable>("EngineBatch")
+                .def(PyEngineBatchVisitor());
+        }
+    };
+
+    BOOST_PYTHON_VISITOR_EXPOSE(EngineBatch)
 }  // End of namespace python.
 }  // End of namespace jiminy.
@@ -1,4 +1,5 @@
 #include "jiminy/core/utilities/Random.h"
+#include "jiminy/core/utilities/GridHeightmap.h"
 
 #include "jiminy/python/Utilities.h"
 #include "jiminy/python/Generators.h"
@@ -16,6 +17,34 @@ namespace python
         return ::jiminy::sumHeightmap(heightmaps);
     }
 
+    heightmapFunctor_t gridHeightmap(matrixN_t                const & heights,
+                                     vector2_t                const & origin,
+                                     float64_t                const & resolution,
+                                     heightmapInterpolation_t const & interpolation)
+    {
+        if (heights.rows() < 2 || heights.cols() < 2)
+        {
+            throw std::invalid_argument("The grid must have at least 2 points along each axis.");
+        }
+        if (resolution < EPS)
+        {
+            throw std::invalid_argument("The resolution of the grid must be strictly positive.");
+        }
+        return GridHeightmap(heights, origin, resolution, interpolation);
+    }
+
+    heightmapFunctor_t discretizeHeightmapGrid(heightmapFunctor_t       const & heightmap,
+                                               float64_t                const & gridSize,
+                                               float64_t                const & gridUnit,
+                                               heightmapInterpolation_t const & interpolation)
+    {
+        if (gridUnit < EPS || gridSize < gridUnit)
+        {
+            throw std::invalid_argument("The grid unit must be strictly positive and smaller than the grid size.");
+        }
+        return GridHeightmap::fromHeightmap(heightmap, gridSize, gridUnit, interpolation);
+    }
+
     heightmapFunctor_t mergeHeightmap(bp::list const & heightmapsPy)
     {
         auto heightmaps = convertFromPython<std::vector<heightmapFunctor_t> >(heightmapsPy);
@@ -41,7 +70,7 @@ namespace python
                    boost::noncopyable>("AbstractPerlinProcess", bp::no_init)
             .def("__call__", &AbstractPerlinProcess::operator(),
                              (bp::arg("self"), bp::arg("time")))
-            .def("reset", &AbstractPerlinProcess::reset)
+            .def("reset", static_cast<void (AbstractPerlinProcess::*)(void)>(&AbstractPerlinProcess::reset))
             .ADD_PROPERTY_GET_WITH_POLICY("wavelength",
                                           &AbstractPerlinProcess::getWavelength,
                                           bp::return_value_policy<bp::copy_const_reference>())
@@ -74,7 +103,7 @@ namespace python
                    (bp::arg("self"), "wavelength", "period", bp::arg("scale") = 1.0)))
             .def("__call__", &PeriodicGaussianProcess::operator(),
                              (bp::arg("self"), bp::arg("time")))
-            .def("reset", &PeriodicGaussianProcess::reset)
+            .def("reset", static_cast<void (PeriodicGaussianProcess::*)(void)>(&PeriodicGaussianProcess::reset))
             .ADD_PROPERTY_GET_WITH_POLICY("wavelength",
                                           &PeriodicGaussianProcess::getWavelength,
                                           bp::return_value_policy<bp::copy_const_reference>())
@@ -92,7 +121,7 @@ namespace python
                    (bp::arg("self"), "wavelength", "period", bp::arg("scale") = 1.0)))
             .def("__call__", &PeriodicFourierProcess::operator(),
                              (bp::arg("self"), bp::arg("time")))
-            .def("reset", &PeriodicFourierProcess::reset)
+            .def("reset", static_cast<void (PeriodicFourierProcess::*)(void)>(&PeriodicFourierProcess::reset))
             .ADD_PROPERTY_GET_WITH_POLICY("wavelength",
                                           &PeriodicFourierProcess::getWavelength,
                                           bp::return_value_policy<bp::copy_const_reference>())
@@ -112,6 +141,12 @@ namespace python
         bp::def("merge_heightmap", &mergeHeightmap, bp::args("heightmaps"));
 
         bp::def("discretize_heightmap", &discretizeHeightmap, bp::args("heightmap", "grid_size", "grid_unit"));
+        bp::def("grid_heightmap", &gridHeightmap,
+                                  (bp::arg("heights"), "origin", "resolution",
+                                   bp::arg("interpolation") = heightmapInterpolation_t::BILINEAR));
+        bp::def("discretize_heightmap_grid", &discretizeHeightmapGrid,
+                                             (bp::arg("heightmap"), "grid_size", "grid_unit",
+                                              bp::arg("interpolation") = heightmapInterpolation_t::BILINEAR));
     }
 
 }  // End of namespace python.
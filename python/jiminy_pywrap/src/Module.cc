@@ -11,6 +11,7 @@
 #include "pinocchio/spatial/force.hpp"  // `Pinocchio::Force`
 
 #include "jiminy/core/utilities/Random.h"
+#include "jiminy/core/utilities/GridHeightmap.h"
 #include "jiminy/core/Types.h"
 
 /* Eigenpy must be imported first, since it sets pre-processor
@@ -97,6 +98,11 @@ namespace python
         .value("STAIRS", heightmapType_t::STAIRS)
         .value("GENERIC", heightmapType_t::GENERIC);
 
+        // Interfaces for heightmapInterpolation_t enum
+        bp::enum_<heightmapInterpolation_t>("heightmapInterpolation_t")
+        .value("BILINEAR", heightmapInterpolation_t::BILINEAR)
+        .value("BICUBIC", heightmapInterpolation_t::BICUBIC);
+
         // Disable CPP docstring
         bp::docstring_options doc_options;
         doc_options.disable_cpp_signatures();
@@ -143,6 +149,7 @@ namespace python
         exposeSystem();
         exposeEngineMultiRobot();
         exposeEngine();
+        exposeEngineBatch();
     }
 
     #undef TIME_STATE_FCT_EXPOSE